@@ -0,0 +1,715 @@
+//*********************************************************************************************************************
+//
+// File: CollisionDiagnostics.cpp
+//
+// Description:
+//    This class checks the collision checker against reference versions of its checks on a corpus of generated
+//    cases. The line and rectangle check is compared with the original version built from four line to line checks,
+//    and the batch versions of the check are compared with the single line version. It also measures how the
+//    collision world performs with many moving objects.
+//
+//*********************************************************************************************************************
+
+#include "CollisionDiagnostics.h"
+#include "DiagnosticsConstants.h"
+#include "../Math/CollisionDetection/CollisionChecker.h"
+#include "../Math/CollisionDetection/CollisionWorld.h"
+#include "../Math/MathConstants.h"
+#include "../Objects/CircleObject.h"
+#include "../Objects/RectangleObject.h"
+#include <allegro5/allegro.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace Bebop { namespace Diagnostics
+{
+   namespace
+   {
+      //***************************************************************************************************************
+      //
+      // Method Name: RandomValue
+      //
+      // Description:
+      //    Returns a random value between zero and the range.
+      //
+      // Arguments:
+      //    apGenerator - The generator the corpus is drawn from.
+      //    aRange      - The largest value that may be returned.
+      //
+      // Return:
+      //    Returns the random value.
+      //
+      //***************************************************************************************************************
+      float RandomValue(std::mt19937* apGenerator, const float aRange)
+      {
+         return static_cast<float>((*apGenerator)()) / static_cast<float>(std::mt19937::max()) * aRange;
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: PointAlongLine
+      //
+      // Description:
+      //    Returns the point a given time along a line, where 0.0 is the origin of the line and 1.0 is the end.
+      //
+      // Arguments:
+      //    aOriginPoint - The origin point of the line.
+      //    aEndPoint    - The end point of the line.
+      //    aTime        - The time along the line.
+      //
+      // Return:
+      //    Returns the point along the line.
+      //
+      //***************************************************************************************************************
+      Math::Vector2D<float> PointAlongLine(const Math::Vector2D<float>& aOriginPoint,
+                                           const Math::Vector2D<float>& aEndPoint,
+                                           const float aTime)
+      {
+         return Math::Vector2D<float>(aOriginPoint.GetComponentX() +
+                                         (aEndPoint.GetComponentX() - aOriginPoint.GetComponentX()) * aTime,
+                                      aOriginPoint.GetComponentY() +
+                                         (aEndPoint.GetComponentY() - aOriginPoint.GetComponentY()) * aTime);
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: IsSamePoint
+      //
+      // Description:
+      //    Checks whether two points are within a tolerance of each other on both axes.
+      //
+      // Arguments:
+      //    aPointOne  - The first point.
+      //    aPointTwo  - The second point.
+      //    aTolerance - How far apart the points may be on each axis.
+      //
+      // Return:
+      //    True  - The points are within the tolerance.
+      //    False - The points are not within the tolerance.
+      //
+      //***************************************************************************************************************
+      bool IsSamePoint(const Math::Vector2D<float>& aPointOne,
+                       const Math::Vector2D<float>& aPointTwo,
+                       const float aTolerance)
+      {
+         return fabsf(aPointOne.GetComponentX() - aPointTwo.GetComponentX()) <= aTolerance &&
+                fabsf(aPointOne.GetComponentY() - aPointTwo.GetComponentY()) <= aTolerance;
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: PointSegmentDistance
+      //
+      // Description:
+      //    Returns the distance from a point to the closest point on a line segment, worked out in double precision.
+      //
+      // Arguments:
+      //    aPointX - The X-Coordinate of the point.
+      //    aPointY - The Y-Coordinate of the point.
+      //    aStartX - The X-Coordinate of the start of the segment.
+      //    aStartY - The Y-Coordinate of the start of the segment.
+      //    aEndX   - The X-Coordinate of the end of the segment.
+      //    aEndY   - The Y-Coordinate of the end of the segment.
+      //
+      // Return:
+      //    Returns the distance from the point to the segment.
+      //
+      //***************************************************************************************************************
+      double PointSegmentDistance(const double aPointX, const double aPointY,
+                                  const double aStartX, const double aStartY,
+                                  const double aEndX, const double aEndY)
+      {
+         double segmentX = aEndX - aStartX;
+         double segmentY = aEndY - aStartY;
+         double lengthSquared = segmentX * segmentX + segmentY * segmentY;
+         double time = 0.0;
+         if (lengthSquared > 0.0)
+         {
+            time = ((aPointX - aStartX) * segmentX + (aPointY - aStartY) * segmentY) / lengthSquared;
+            time = std::min(std::max(time, 0.0), 1.0);
+         }
+
+         return std::hypot(aStartX + segmentX * time - aPointX, aStartY + segmentY * time - aPointY);
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: PointRectangleDistance
+      //
+      // Description:
+      //    Returns the distance from a point to a rectangle, worked out in double precision. The distance is zero when
+      //    the point is inside or on the edge of the rectangle.
+      //
+      // Arguments:
+      //    aPoint      - The point.
+      //    apRectangle - The rectangle.
+      //
+      // Return:
+      //    Returns the distance from the point to the rectangle.
+      //
+      //***************************************************************************************************************
+      double PointRectangleDistance(const Math::Vector2D<float>& aPoint, const Objects::RectangleObject* apRectangle)
+      {
+         double minX = apRectangle->GetCoordinateX();
+         double minY = apRectangle->GetCoordinateY();
+         double outsideX = std::max(std::max(minX - aPoint.GetComponentX(),
+                                             aPoint.GetComponentX() - (minX + apRectangle->GetWidth())),
+                                    0.0);
+         double outsideY = std::max(std::max(minY - aPoint.GetComponentY(),
+                                             aPoint.GetComponentY() - (minY + apRectangle->GetHeight())),
+                                    0.0);
+         return std::hypot(outsideX, outsideY);
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: SegmentCornerDistance
+      //
+      // Description:
+      //    Returns the distance from a line segment to the closest corner of a rectangle, worked out in double
+      //    precision.
+      //
+      // Arguments:
+      //    aOriginPoint - The origin point of the segment.
+      //    aEndPoint    - The end point of the segment.
+      //    apRectangle  - The rectangle.
+      //
+      // Return:
+      //    Returns the distance from the segment to the closest corner.
+      //
+      //***************************************************************************************************************
+      double SegmentCornerDistance(const Math::Vector2D<float>& aOriginPoint,
+                                   const Math::Vector2D<float>& aEndPoint,
+                                   const Objects::RectangleObject* apRectangle)
+      {
+         double minX = apRectangle->GetCoordinateX();
+         double minY = apRectangle->GetCoordinateY();
+         const double cornersX[] = {minX, minX + apRectangle->GetWidth()};
+         const double cornersY[] = {minY, minY + apRectangle->GetHeight()};
+         double distance = std::numeric_limits<double>::max();
+         for (double cornerX : cornersX)
+         {
+            for (double cornerY : cornersY)
+            {
+               distance = std::min(distance,
+                                   PointSegmentDistance(cornerX, cornerY,
+                                                        aOriginPoint.GetComponentX(), aOriginPoint.GetComponentY(),
+                                                        aEndPoint.GetComponentX(), aEndPoint.GetComponentY()));
+            }
+         }
+
+         return distance;
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: SegmentRectangleDistance
+      //
+      // Description:
+      //    Returns the distance between a line segment and a rectangle, worked out in double precision independently
+      //    of both versions of the check. The distance is zero when the segment touches or crosses the rectangle.
+      //
+      // Arguments:
+      //    aOriginPoint - The origin point of the segment.
+      //    aEndPoint    - The end point of the segment.
+      //    apRectangle  - The rectangle.
+      //
+      // Return:
+      //    Returns the distance between the segment and the rectangle.
+      //
+      //***************************************************************************************************************
+      double SegmentRectangleDistance(const Math::Vector2D<float>& aOriginPoint,
+                                      const Math::Vector2D<float>& aEndPoint,
+                                      const Objects::RectangleObject* apRectangle)
+      {
+         double originX = aOriginPoint.GetComponentX();
+         double originY = aOriginPoint.GetComponentY();
+         double endX = aEndPoint.GetComponentX();
+         double endY = aEndPoint.GetComponentY();
+         double minX = apRectangle->GetCoordinateX();
+         double minY = apRectangle->GetCoordinateY();
+         double maxX = minX + apRectangle->GetWidth();
+         double maxY = minY + apRectangle->GetHeight();
+
+         // A segment starting or ending inside the rectangle touches it.
+         if ((originX >= minX && originX <= maxX && originY >= minY && originY <= maxY) ||
+             (endX >= minX && endX <= maxX && endY >= minY && endY <= maxY))
+         {
+            return 0.0;
+         }
+
+         // The corners in order around the rectangle, so each pair of neighbours is an edge.
+         const double cornersX[] = {minX, maxX, maxX, minX};
+         const double cornersY[] = {minY, minY, maxY, maxY};
+         double distance = std::numeric_limits<double>::max();
+         for (unsigned int corner = 0; corner < 4; ++corner)
+         {
+            double startX = cornersX[corner];
+            double startY = cornersY[corner];
+            double edgeEndX = cornersX[(corner + 1) % 4];
+            double edgeEndY = cornersY[(corner + 1) % 4];
+
+            // The segment crosses the edge if each lies strictly either side of the other.
+            double sideOne = (endX - originX) * (startY - originY) - (endY - originY) * (startX - originX);
+            double sideTwo = (endX - originX) * (edgeEndY - originY) - (endY - originY) * (edgeEndX - originX);
+            double sideThree = (edgeEndX - startX) * (originY - startY) - (edgeEndY - startY) * (originX - startX);
+            double sideFour = (edgeEndX - startX) * (endY - startY) - (edgeEndY - startY) * (endX - startX);
+            if (sideOne * sideTwo < 0.0 && sideThree * sideFour < 0.0)
+            {
+               return 0.0;
+            }
+
+            // Otherwise the closest points include an end of the segment or an end of the edge.
+            distance = std::min(distance, PointSegmentDistance(startX, startY, originX, originY, endX, endY));
+            distance = std::min(distance, PointSegmentDistance(originX, originY, startX, startY, edgeEndX, edgeEndY));
+            distance = std::min(distance, PointSegmentDistance(endX, endY, startX, startY, edgeEndX, edgeEndY));
+         }
+
+         return distance;
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: ReferenceLineRectangleCollision
+      //
+      // Description:
+      //    The original line and rectangle check. A line starting inside the rectangle collides at its origin,
+      //    otherwise the line is checked against each of the four sides and the collision closest to the origin is
+      //    kept.
+      //
+      // Arguments:
+      //    aOriginPoint     - The origin point of the line being tested.
+      //    aEndPoint        - The end point of the line being tested.
+      //    apRectangle      - The rectangle being tested against.
+      //    apCollisionPoint - The collision point closest to the origin.
+      //
+      // Return:
+      //    True  - The line collides with the rectangle.
+      //    False - The line does not collide with the rectangle.
+      //
+      //***************************************************************************************************************
+      bool ReferenceLineRectangleCollision(const Math::Vector2D<float>& aOriginPoint,
+                                           const Math::Vector2D<float>& aEndPoint,
+                                           Objects::RectangleObject* apRectangle,
+                                           Math::Vector2D<float>* apCollisionPoint)
+      {
+         if (aOriginPoint.GetComponentX() >= apRectangle->GetCoordinateX() &&
+             aOriginPoint.GetComponentX() <= apRectangle->GetCoordinateX() + apRectangle->GetWidth() &&
+             aOriginPoint.GetComponentY() >= apRectangle->GetCoordinateY() &&
+             aOriginPoint.GetComponentY() <= apRectangle->GetCoordinateY() + apRectangle->GetHeight())
+         {
+            *apCollisionPoint = aOriginPoint;
+            return true;
+         }
+
+         // Sides that do not collide keep a point too far away to ever be the closest.
+         Math::Vector2D<float> sidePoints[] =
+         {
+            Math::Vector2D<float>(std::numeric_limits<float>::max(), std::numeric_limits<float>::max()),
+            Math::Vector2D<float>(std::numeric_limits<float>::max(), std::numeric_limits<float>::max()),
+            Math::Vector2D<float>(std::numeric_limits<float>::max(), std::numeric_limits<float>::max()),
+            Math::Vector2D<float>(std::numeric_limits<float>::max(), std::numeric_limits<float>::max())
+         };
+
+         // The left, top, right and bottom sides in the order the original check tested them.
+         bool collided = false;
+         collided |= Math::LineLineCollision(aOriginPoint, aEndPoint,
+                                             apRectangle->GetTopLeftCorner(), apRectangle->GetBottomLeftCorner(),
+                                             &sidePoints[0]);
+         collided |= Math::LineLineCollision(aOriginPoint, aEndPoint,
+                                             apRectangle->GetTopLeftCorner(), apRectangle->GetTopRightCorner(),
+                                             &sidePoints[1]);
+         collided |= Math::LineLineCollision(aOriginPoint, aEndPoint,
+                                             apRectangle->GetTopRightCorner(), apRectangle->GetBottomRightCorner(),
+                                             &sidePoints[2]);
+         collided |= Math::LineLineCollision(aOriginPoint, aEndPoint,
+                                             apRectangle->GetBottomLeftCorner(), apRectangle->GetBottomRightCorner(),
+                                             &sidePoints[3]);
+         if (collided == false)
+         {
+            return false;
+         }
+
+         unsigned int closestSide = 0;
+         float closestDistance = Math::PointDistances(aOriginPoint, sidePoints[0]);
+         for (unsigned int side = 1; side < 4; ++side)
+         {
+            float distance = Math::PointDistances(aOriginPoint, sidePoints[side]);
+            if (distance < closestDistance)
+            {
+               closestSide = side;
+               closestDistance = distance;
+            }
+         }
+
+         *apCollisionPoint = sidePoints[closestSide];
+         return true;
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: GrownLineRectangleCollision
+      //
+      // Description:
+      //    Checks a line against a rectangle grown or shrunk on each side, to tell lines that only graze the
+      //    rectangle from lines that clearly hit or miss it.
+      //
+      // Arguments:
+      //    aOriginPoint - The origin point of the line being tested.
+      //    aEndPoint    - The end point of the line being tested.
+      //    apRectangle  - The rectangle being tested against.
+      //    aGrowth      - How far the rectangle is grown on each side. Negative values shrink it.
+      //
+      // Return:
+      //    True  - The line collides with the grown rectangle.
+      //    False - The line does not collide with the grown rectangle.
+      //
+      //***************************************************************************************************************
+      bool GrownLineRectangleCollision(const Math::Vector2D<float>& aOriginPoint,
+                                       const Math::Vector2D<float>& aEndPoint,
+                                       const Objects::RectangleObject* apRectangle,
+                                       const float aGrowth)
+      {
+         float minX = apRectangle->GetCoordinateX() - aGrowth;
+         float minY = apRectangle->GetCoordinateY() - aGrowth;
+         float maxX = apRectangle->GetCoordinateX() + apRectangle->GetWidth() + aGrowth;
+         float maxY = apRectangle->GetCoordinateY() + apRectangle->GetHeight() + aGrowth;
+         float collisionTime = Math::NO_COLLISION_TIME;
+         Math::LineRectanglesCollision(aOriginPoint, aEndPoint, &minX, &minY, &maxX, &maxY, 1, &collisionTime);
+         return collisionTime != Math::NO_COLLISION_TIME;
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: IsBatchSame
+      //
+      // Description:
+      //    Runs a case through both batch checks and compares every result with the single line check.
+      //
+      // Arguments:
+      //    aOriginPoint    - The origin point of the line being tested.
+      //    aEndPoint       - The end point of the line being tested.
+      //    apRectangle     - The rectangle being tested against.
+      //    aCollided       - Whether the single line check found a collision.
+      //    aCollisionPoint - The collision point the single line check found.
+      //
+      // Return:
+      //    True  - Both batch checks agree with the single line check.
+      //    False - A batch check disagrees with the single line check.
+      //
+      //***************************************************************************************************************
+      bool IsBatchSame(const Math::Vector2D<float>& aOriginPoint,
+                       const Math::Vector2D<float>& aEndPoint,
+                       const Objects::RectangleObject* apRectangle,
+                       const bool aCollided,
+                       const Math::Vector2D<float>& aCollisionPoint)
+      {
+         float minX[LINE_CORPUS_BATCH_SIZE];
+         float minY[LINE_CORPUS_BATCH_SIZE];
+         float maxX[LINE_CORPUS_BATCH_SIZE];
+         float maxY[LINE_CORPUS_BATCH_SIZE];
+         float endPointX[LINE_CORPUS_BATCH_SIZE];
+         float endPointY[LINE_CORPUS_BATCH_SIZE];
+         for (unsigned int i = 0; i < LINE_CORPUS_BATCH_SIZE; ++i)
+         {
+            minX[i] = apRectangle->GetCoordinateX();
+            minY[i] = apRectangle->GetCoordinateY();
+            maxX[i] = apRectangle->GetCoordinateX() + apRectangle->GetWidth();
+            maxY[i] = apRectangle->GetCoordinateY() + apRectangle->GetHeight();
+            endPointX[i] = aEndPoint.GetComponentX();
+            endPointY[i] = aEndPoint.GetComponentY();
+         }
+
+         float rectanglesTimes[LINE_CORPUS_BATCH_SIZE];
+         float linesTimes[LINE_CORPUS_BATCH_SIZE];
+         Math::LineRectanglesCollision(aOriginPoint, aEndPoint, minX, minY, maxX, maxY, LINE_CORPUS_BATCH_SIZE,
+                                       rectanglesTimes);
+         Math::LinesRectangleCollision(aOriginPoint, endPointX, endPointY, LINE_CORPUS_BATCH_SIZE, apRectangle,
+                                       linesTimes);
+
+         for (unsigned int i = 0; i < LINE_CORPUS_BATCH_SIZE; ++i)
+         {
+            for (float collisionTime : {rectanglesTimes[i], linesTimes[i]})
+            {
+               if ((collisionTime != Math::NO_COLLISION_TIME) != aCollided)
+               {
+                  return false;
+               }
+               if (aCollided == true &&
+                   IsSamePoint(PointAlongLine(aOriginPoint, aEndPoint, collisionTime), aCollisionPoint,
+                               LINE_CORPUS_POINT_TOLERANCE) == false)
+               {
+                  return false;
+               }
+            }
+         }
+
+         return true;
+      }
+   }
+
+//*********************************************************************************************************************
+// Public Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: CheckLineRectangleCorpus
+   //
+   // Description:
+   //    Compares the line and rectangle check with the original version built from four line to line checks on a
+   //    corpus of generated cases. The corpus holds lines in any direction, horizontal and vertical lines, lines aimed
+   //    through a corner of the rectangle and lines lying along an edge of the rectangle. Each case is also run
+   //    through both batch checks, which must agree with the single line check.
+   //
+   // Arguments:
+   //    aSeed    - The seed the corpus is generated from.
+   //    aCount   - The number of cases in the corpus.
+   //    apResult - The counts of each outcome.
+   //
+   // Return:
+   //    True  - Every case matched or only grazed the rectangle.
+   //    False - At least one case did not match.
+   //
+   //******************************************************************************************************************
+   bool CollisionDiagnostics::CheckLineRectangleCorpus(const unsigned int aSeed,
+                                                       const unsigned int aCount,
+                                                       LineRectangleCorpusResult* apResult)
+   {
+      LineRectangleCorpusResult result = {0, 0, 0, 0, 0};
+      std::mt19937 generator(aSeed);
+
+      for (unsigned int i = 0; i < aCount; ++i)
+      {
+         // The original check works on whole pixels, so the rectangles are placed on them as the game does.
+         float x = std::floor(RandomValue(&generator, LINE_CORPUS_RECTANGLE_RANGE)) + LINE_CORPUS_RECTANGLE_OFFSET;
+         float y = std::floor(RandomValue(&generator, LINE_CORPUS_RECTANGLE_RANGE)) + LINE_CORPUS_RECTANGLE_OFFSET;
+         int width = static_cast<int>(RandomValue(&generator, LINE_CORPUS_RECTANGLE_MAXIMUM_SIZE)) + 1;
+         int height = static_cast<int>(RandomValue(&generator, LINE_CORPUS_RECTANGLE_MAXIMUM_SIZE)) + 1;
+         Objects::RectangleObject rectangle(Math::Vector2D<float>(x, y), width, height, Graphics::Color(0, 0, 0, 0));
+
+         Math::Vector2D<float> originPoint(RandomValue(&generator, LINE_CORPUS_POINT_RANGE),
+                                           RandomValue(&generator, LINE_CORPUS_POINT_RANGE));
+         Math::Vector2D<float> endPoint(RandomValue(&generator, LINE_CORPUS_POINT_RANGE),
+                                        RandomValue(&generator, LINE_CORPUS_POINT_RANGE));
+         switch (i % LINE_CORPUS_KINDS)
+         {
+            // Horizontal lines.
+            case 1:
+               endPoint.SetComponentY(originPoint.GetComponentY());
+               break;
+            // Vertical lines.
+            case 2:
+               endPoint.SetComponentX(originPoint.GetComponentX());
+               break;
+            // Lines aimed through the top left or bottom right corner, which they reach half way along.
+            case 3:
+            {
+               Math::Vector2D<float> corner = ((i / LINE_CORPUS_KINDS) % 2 == 0) ? rectangle.GetTopLeftCorner() :
+                                                                                   rectangle.GetBottomRightCorner();
+               endPoint = PointAlongLine(originPoint, corner, 2.0F);
+               break;
+            }
+            // Lines lying along the line of the top or bottom edge.
+            case 4:
+            {
+               float edgeY = ((i / LINE_CORPUS_KINDS) % 2 == 0) ? y : y + height;
+               originPoint.SetComponentY(edgeY);
+               endPoint.SetComponentY(edgeY);
+               break;
+            }
+            default:
+               break;
+         }
+
+         Math::Vector2D<float> referencePoint(0.0F, 0.0F);
+         Math::Vector2D<float> collisionPoint(0.0F, 0.0F);
+         bool referenceCollided = ReferenceLineRectangleCollision(originPoint, endPoint, &rectangle, &referencePoint);
+         bool collided = Math::LineRectangleCollision(originPoint, endPoint, &rectangle, &collisionPoint);
+
+         // The original check rounds the cross products of its orientation tests to whole numbers, so it accepts
+         // lines passing up to one over the length of the line or of an edge outside the rectangle. A collision only
+         // the original version finds counts as grazing when the line really passes outside the rectangle by no more
+         // than that, and a collision only the new version finds when the line misses the rectangle shrunk by that.
+         // Lines passing that close to a corner can also be given a point by the original version on the line of an
+         // edge but outside the rectangle, which counts as grazing when the new point is on the rectangle.
+         float shortestLength = std::min(Math::PointDistances(originPoint, endPoint),
+                                         static_cast<float>(std::min(width, height)));
+         float grazingDistance = LINE_CORPUS_GRAZING_CROSS_PRODUCT / shortestLength;
+         if (collided == referenceCollided &&
+             (collided == false || IsSamePoint(collisionPoint, referencePoint, LINE_CORPUS_POINT_TOLERANCE) == true))
+         {
+            ++result.matched;
+         }
+         else if ((collided == true && referenceCollided == true &&
+                   IsSamePoint(collisionPoint, referencePoint, LINE_CORPUS_GRAZING_POINT_TOLERANCE) == true) ||
+                  (collided == true && referenceCollided == true &&
+                   SegmentCornerDistance(originPoint, endPoint, &rectangle) <= grazingDistance &&
+                   PointRectangleDistance(collisionPoint, &rectangle) <= LINE_CORPUS_POINT_TOLERANCE) ||
+                  (referenceCollided == true &&
+                   SegmentRectangleDistance(originPoint, endPoint, &rectangle) > 0.0 &&
+                   SegmentRectangleDistance(originPoint, endPoint, &rectangle) <= grazingDistance) ||
+                  (referenceCollided == false &&
+                   GrownLineRectangleCollision(originPoint, endPoint, &rectangle, -grazingDistance) == false))
+         {
+            ++result.grazing;
+         }
+         else
+         {
+            ++result.mismatched;
+         }
+
+         if (IsBatchSame(originPoint, endPoint, &rectangle, collided, collisionPoint) == false)
+         {
+            ++result.batchMismatched;
+         }
+
+         ++result.checked;
+      }
+
+      if (apResult != nullptr)
+      {
+         *apResult = result;
+      }
+
+      return result.mismatched == 0 && result.batchMismatched == 0;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: BenchmarkWorldStep
+   //
+   // Description:
+   //    Times stepping a collision world of rectangles and circles scattered over an area and moving in random
+   //    directions, bouncing off the edges of the area. Every object is moved before each step. Once the steps are done
+   //    the objects are removed in a shuffled order, which is timed as well. Allegro has to be initialized for the
+   //    timer.
+   //
+   // Arguments:
+   //    aObjectCount - The number of objects in the world.
+   //    aSteps       - The number of steps.
+   //    apResult     - The timing and counts of the steps.
+   //
+   // Return:
+   //    True  - The world was timed.
+   //    False - There were no objects or no steps to time.
+   //
+   //******************************************************************************************************************
+   bool CollisionDiagnostics::BenchmarkWorldStep(const unsigned int aObjectCount,
+                                                 const unsigned int aSteps,
+                                                 CollisionWorldBenchmarkResult* apResult)
+   {
+      if (aObjectCount == 0 || aSteps == 0 || apResult == nullptr)
+      {
+         return false;
+      }
+
+      // The area is sized so each object has the same room however many there are.
+      std::mt19937 generator(WORLD_BENCHMARK_SEED);
+      float areaSize = std::sqrt(static_cast<float>(aObjectCount)) * WORLD_BENCHMARK_OBJECT_SPACING;
+      std::vector<std::unique_ptr<Objects::Object>> objects;
+      std::vector<Math::Vector2D<float>> velocities;
+      for (unsigned int i = 0; i < aObjectCount; ++i)
+      {
+         Math::Vector2D<float> coordinates(RandomValue(&generator, areaSize), RandomValue(&generator, areaSize));
+         if (i % WORLD_BENCHMARK_CIRCLE_INTERVAL == 0)
+         {
+            objects.emplace_back(new Objects::CircleObject(coordinates, WORLD_BENCHMARK_OBJECT_SIZE / 2,
+                                                           Graphics::Color(0, 0, 0, 0)));
+         }
+         else
+         {
+            objects.emplace_back(new Objects::RectangleObject(coordinates, WORLD_BENCHMARK_OBJECT_SIZE,
+                                                              WORLD_BENCHMARK_OBJECT_SIZE,
+                                                              Graphics::Color(0, 0, 0, 0)));
+         }
+         velocities.push_back(Math::Vector2D<float>(
+            RandomValue(&generator, WORLD_BENCHMARK_MAXIMUM_SPEED * 2.0F) - WORLD_BENCHMARK_MAXIMUM_SPEED,
+            RandomValue(&generator, WORLD_BENCHMARK_MAXIMUM_SPEED * 2.0F) - WORLD_BENCHMARK_MAXIMUM_SPEED));
+      }
+
+      Math::CollisionWorld world;
+      for (auto iterator = objects.begin(); iterator != objects.end(); ++iterator)
+      {
+         world.AddObject(iterator->get());
+      }
+
+      unsigned long long candidatePairs = 0;
+      unsigned long long collisionPairs = 0;
+      double stepTime = 0.0;
+      for (unsigned int step = 0; step < aSteps; ++step)
+      {
+         for (unsigned int i = 0; i < aObjectCount; ++i)
+         {
+            Objects::Object* object = objects[i].get();
+            float x = object->GetCoordinateX() + velocities[i].GetComponentX();
+            float y = object->GetCoordinateY() + velocities[i].GetComponentY();
+            if (x < 0.0F || x > areaSize)
+            {
+               velocities[i].SetComponentX(-velocities[i].GetComponentX());
+            }
+            if (y < 0.0F || y > areaSize)
+            {
+               velocities[i].SetComponentY(-velocities[i].GetComponentY());
+            }
+            object->SetCoordinateX(x);
+            object->SetCoordinateY(y);
+         }
+
+         double startTime = al_get_time();
+         world.Step();
+         stepTime += al_get_time() - startTime;
+         candidatePairs += world.GetCandidatePairCount();
+         collisionPairs += world.GetCollisionPairs().size();
+      }
+
+      std::vector<Objects::Object*> removalOrder;
+      for (auto iterator = objects.begin(); iterator != objects.end(); ++iterator)
+      {
+         removalOrder.push_back(iterator->get());
+      }
+      std::shuffle(removalOrder.begin(), removalOrder.end(), generator);
+
+      double startTime = al_get_time();
+      for (auto iterator = removalOrder.begin(); iterator != removalOrder.end(); ++iterator)
+      {
+         world.RemoveObject(*iterator);
+      }
+      double removeTime = al_get_time() - startTime;
+
+      apResult->objects = aObjectCount;
+      apResult->millisecondsPerStep = stepTime * MILLISECONDS_PER_SECOND / aSteps;
+      apResult->candidatePairs = static_cast<unsigned int>(candidatePairs / aSteps);
+      apResult->collisionPairs = static_cast<unsigned int>(collisionPairs / aSteps);
+      apResult->millisecondsToRemove = removeTime * MILLISECONDS_PER_SECOND;
+      return true;
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no private methods for this class.
+
+//*********************************************************************************************************************
+// Private Methods - End
+//*********************************************************************************************************************
+}}
@@ -0,0 +1,147 @@
+//*********************************************************************************************************************
+//
+// File: CollisionDiagnostics.h
+//
+// Description:
+//    This class checks the collision checker against reference versions of its checks on a corpus of generated
+//    cases. The line and rectangle check is compared with the original version built from four line to line checks,
+//    and the batch versions of the check are compared with the single line version. It also measures how the
+//    collision world performs with many moving objects.
+//
+//*********************************************************************************************************************
+
+#ifndef CollisionDiagnostics_H
+#define CollisionDiagnostics_H
+
+namespace Bebop { namespace Diagnostics
+{
+   // The outcome of checking the line and rectangle check on a corpus.
+   struct LineRectangleCorpusResult
+   {
+      // The number of cases checked.
+      unsigned int checked;
+
+      // The cases where both versions agree on the collision and the collision point.
+      unsigned int matched;
+
+      // The cases where the line only grazes the rectangle and the versions round it differently, but agree within
+      // the rounding of the original version.
+      unsigned int grazing;
+
+      // The cases where the versions disagree.
+      unsigned int mismatched;
+
+      // The cases where a batch check disagrees with the single line check.
+      unsigned int batchMismatched;
+   };
+
+   // The outcome of timing a collision world full of moving objects.
+   struct CollisionWorldBenchmarkResult
+   {
+      // The number of objects in the world.
+      unsigned int objects;
+
+      // The average milliseconds a step of the world took.
+      double millisecondsPerStep;
+
+      // The average number of pairs handed to the narrow phase in each step.
+      unsigned int candidatePairs;
+
+      // The average number of colliding pairs found in each step.
+      unsigned int collisionPairs;
+
+      // The milliseconds removing every object from the world took.
+      double millisecondsToRemove;
+   };
+
+   class CollisionDiagnostics
+   {
+      //***************************************************************************************************************
+      // Methods - Start
+      //***************************************************************************************************************
+
+      public:
+
+         //************************************************************************************************************
+         //
+         // Method: CheckLineRectangleCorpus
+         //
+         // Description:
+         //    Compares the line and rectangle check with the original version built from four line to line checks on
+         //    a corpus of generated cases. The corpus holds lines in any direction, horizontal and vertical lines,
+         //    lines aimed through a corner of the rectangle and lines lying along an edge of the rectangle. Each case
+         //    is also run through both batch checks, which must agree with the single line check.
+         //
+         // Arguments:
+         //    aSeed    - The seed the corpus is generated from.
+         //    aCount   - The number of cases in the corpus.
+         //    apResult - The counts of each outcome.
+         //
+         // Return:
+         //    True  - Every case matched or only grazed the rectangle.
+         //    False - At least one case did not match.
+         //
+         //************************************************************************************************************
+         static bool CheckLineRectangleCorpus(const unsigned int aSeed,
+                                              const unsigned int aCount,
+                                              LineRectangleCorpusResult* apResult);
+
+         //************************************************************************************************************
+         //
+         // Method: BenchmarkWorldStep
+         //
+         // Description:
+         //    Times stepping a collision world of rectangles and circles scattered over an area and moving in random
+         //    directions, bouncing off the edges of the area. Every object is moved before each step. Once the steps
+         //    are done the objects are removed in a shuffled order, which is timed as well. Allegro has to be
+         //    initialized for the timer.
+         //
+         // Arguments:
+         //    aObjectCount - The number of objects in the world.
+         //    aSteps       - The number of steps.
+         //    apResult     - The timing and counts of the steps.
+         //
+         // Return:
+         //    True  - The world was timed.
+         //    False - There were no objects or no steps to time.
+         //
+         //************************************************************************************************************
+         static bool BenchmarkWorldStep(const unsigned int aObjectCount,
+                                        const unsigned int aSteps,
+                                        CollisionWorldBenchmarkResult* apResult);
+
+      protected:
+
+         // There are currently no protected methods for this class.
+
+      private:
+
+         // There are currently no private methods for this class.
+
+      //***************************************************************************************************************
+      // Methods - End
+      //***************************************************************************************************************
+
+      //***************************************************************************************************************
+      // Member Variables - Start
+      //***************************************************************************************************************
+
+      public:
+
+         // There are currently no public member variables for this class.
+
+      protected:
+
+         // There are currently no protected member variables for this class.
+
+      private:
+
+         // There are currently no private member variables for this class.
+
+      //***************************************************************************************************************
+      // Member Variables - End
+      //***************************************************************************************************************
+   };
+}}
+
+#endif // CollisionDiagnostics_H
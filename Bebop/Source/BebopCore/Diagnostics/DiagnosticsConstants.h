@@ -0,0 +1,100 @@
+//*********************************************************************************************************************
+//
+// File: DiagnosticsConstants.h
+//
+// Description:
+//    This files handles all the constants for the diagnostics namespace.
+//
+//*********************************************************************************************************************
+
+#ifndef DiagnosticsConstants_H
+#define DiagnosticsConstants_H
+
+#include <limits>
+
+namespace Bebop { namespace Diagnostics
+{
+   // The number of kinds of line in the line and rectangle corpus: any direction, horizontal, vertical, aimed through
+   // a corner and lying along an edge.
+   const unsigned int LINE_CORPUS_KINDS = 5;
+
+   // The range of the corners of the rectangles in the line corpus, and the largest width and height.
+   const unsigned int LINE_CORPUS_RECTANGLE_OFFSET = 50;
+   const unsigned int LINE_CORPUS_RECTANGLE_RANGE = 100;
+   const unsigned int LINE_CORPUS_RECTANGLE_MAXIMUM_SIZE = 60;
+
+   // The range of the end points of the lines in the line corpus.
+   const float LINE_CORPUS_POINT_RANGE = 300.0F;
+
+   // How far apart in pixels two collision points may be and still match.
+   const float LINE_CORPUS_POINT_TOLERANCE = 0.01F;
+
+   // The largest cross product the original line and rectangle check rounds down to zero, and how far apart in
+   // pixels the collision points of a line grazing the rectangle may be.
+   const float LINE_CORPUS_GRAZING_CROSS_PRODUCT = 1.0F;
+   const float LINE_CORPUS_GRAZING_POINT_TOLERANCE = 0.1F;
+
+   // The number of copies of each case passed to the batch checks, enough to fill a group of SIMD lanes and leave one
+   // for the scalar path.
+   const unsigned int LINE_CORPUS_BATCH_SIZE = 5;
+
+   // The seed of the collision world benchmark scene.
+   const unsigned int WORLD_BENCHMARK_SEED = 1;
+
+   // The average pixels between the objects of the collision world benchmark along each axis, the size of each
+   // object and the fastest an object moves on each axis in a step.
+   const float WORLD_BENCHMARK_OBJECT_SPACING = 12.0F;
+   const int WORLD_BENCHMARK_OBJECT_SIZE = 8;
+   const float WORLD_BENCHMARK_MAXIMUM_SPEED = 2.0F;
+
+   // Every this many objects of the collision world benchmark is a circle instead of a rectangle.
+   const unsigned int WORLD_BENCHMARK_CIRCLE_INTERVAL = 3;
+
+   // The largest magnitude of a component of the vectors in the vector array check, and every this many vectors is
+   // zero length.
+   const float VECTOR_ARRAY_COMPONENT_RANGE = 100.0F;
+   const unsigned int VECTOR_ARRAY_ZERO_INTERVAL = 7;
+
+   // How far a result of a bulk vector operation may be from working one vector at a time, relative to the size of
+   // the result once it is past 1.0.
+   const float VECTOR_ARRAY_TOLERANCE = 1.0e-5F;
+
+   // The value the dot product results of the vector array check start as, to catch results that should not have
+   // been written.
+   const float VECTOR_ARRAY_UNWRITTEN_MARKER = std::numeric_limits<float>::max();
+
+   // The pixels between the blockers of the light benchmark scene, and the size of each blocker.
+   const float LIGHT_BENCHMARK_BLOCKER_SPACING = 25.0F;
+   const int LIGHT_BENCHMARK_BLOCKER_SIZE = 8;
+
+   // Every this many blockers of the light benchmark scene is a circle instead of a rectangle.
+   const unsigned int LIGHT_BENCHMARK_CIRCLE_INTERVAL = 3;
+
+   // The intensity of the light in the light benchmark scene, and the offset either side of its center that makes it
+   // shine all the way around.
+   const int LIGHT_BENCHMARK_INTENSITY = 200;
+   const int LIGHT_BENCHMARK_FULL_OFFSET = 180;
+
+   // The pixels from the light to the crate that moves in the moving blocker benchmark, and the size of the crate.
+   const float LIGHT_BENCHMARK_CRATE_DISTANCE = 50.0F;
+   const int LIGHT_BENCHMARK_CRATE_SIZE = 4;
+
+   // The offset either side of its center of each spot light in the cone benchmark, and the degrees in a circle the
+   // lights are spread around.
+   const int LIGHT_BENCHMARK_CONE_OFFSET = 15;
+   const unsigned int LIGHT_BENCHMARK_FULL_CIRCLE = 360;
+
+   // The seed of the order particles are removed in by the scene churn benchmark.
+   const unsigned int SCENE_CHURN_SEED = 1;
+
+   // The number of columns the particles of the scene churn benchmark are laid out in, along with their size and how
+   // long they live.
+   const unsigned int SCENE_CHURN_COLUMNS = 1000;
+   const int SCENE_CHURN_PARTICLE_RADIUS = 2;
+   const float SCENE_CHURN_TIME_TO_LIVE = 1.0F;
+
+   // The milliseconds in a second.
+   const double MILLISECONDS_PER_SECOND = 1000.0;
+}}
+
+#endif // DiagnosticsConstants_H
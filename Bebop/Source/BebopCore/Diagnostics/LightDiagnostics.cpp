@@ -0,0 +1,408 @@
+//*********************************************************************************************************************
+//
+// File: LightDiagnostics.cpp
+//
+// Description:
+//    This class measures how lights perform in generated scenes, so changes to the light calculation can be compared
+//    on the same work.
+//
+//*********************************************************************************************************************
+
+#include "LightDiagnostics.h"
+#include "DiagnosticsConstants.h"
+#include "../Graphics/Light.h"
+#include "../Objects/CircleObject.h"
+#include "../Objects/RectangleObject.h"
+#include <allegro5/allegro.h>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace Bebop { namespace Diagnostics
+{
+   namespace
+   {
+      //***************************************************************************************************************
+      //
+      // Method Name: MakeBlockerGrid
+      //
+      // Description:
+      //    Lays blockers out in the smallest square grid that holds them all. Every few blockers is a circle and the
+      //    rest are rectangles.
+      //
+      // Arguments:
+      //    aBlockerCount     - The number of blockers in the grid.
+      //    apBlockers        - The blockers made, which are kept until the benchmark is done with them.
+      //    apBlockingObjects - The blockers as handed to the lights.
+      //
+      // Return:
+      //    Returns the number of columns of the grid.
+      //
+      //***************************************************************************************************************
+      unsigned int MakeBlockerGrid(const unsigned int aBlockerCount,
+                                   std::vector<std::unique_ptr<Objects::Object>>* apBlockers,
+                                   std::vector<Objects::Object*>* apBlockingObjects)
+      {
+         unsigned int columns = static_cast<unsigned int>(std::ceil(std::sqrt(static_cast<float>(aBlockerCount))));
+         for (unsigned int i = 0; i < aBlockerCount; ++i)
+         {
+            float x = static_cast<float>(i % columns) * LIGHT_BENCHMARK_BLOCKER_SPACING;
+            float y = static_cast<float>(i / columns) * LIGHT_BENCHMARK_BLOCKER_SPACING;
+            if (i % LIGHT_BENCHMARK_CIRCLE_INTERVAL == 0)
+            {
+               apBlockers->emplace_back(new Objects::CircleObject(Math::Vector2D<float>(x, y),
+                                                                  LIGHT_BENCHMARK_BLOCKER_SIZE / 2,
+                                                                  Graphics::Color(0, 0, 0, 0)));
+            }
+            else
+            {
+               apBlockers->emplace_back(new Objects::RectangleObject(Math::Vector2D<float>(x, y),
+                                                                     LIGHT_BENCHMARK_BLOCKER_SIZE,
+                                                                     LIGHT_BENCHMARK_BLOCKER_SIZE,
+                                                                     Graphics::Color(0, 0, 0, 0)));
+            }
+            apBlockingObjects->push_back(apBlockers->back().get());
+         }
+
+         return columns;
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: GetGridGapCenter
+      //
+      // Description:
+      //    Returns the middle of the gap before the middle blocker of a grid, along either axis. A light placed there
+      //    on both axes sits in the open between four blockers.
+      //
+      // Arguments:
+      //    aColumns - The number of columns of the grid.
+      //
+      // Return:
+      //    Returns the coordinate of the middle of the gap.
+      //
+      //***************************************************************************************************************
+      float GetGridGapCenter(const unsigned int aColumns)
+      {
+         return static_cast<float>(aColumns / 2) * LIGHT_BENCHMARK_BLOCKER_SPACING -
+                (LIGHT_BENCHMARK_BLOCKER_SPACING - LIGHT_BENCHMARK_BLOCKER_SIZE) / 2.0F;
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: IsSamePoints
+      //
+      // Description:
+      //    Checks whether two lights found exactly the same points at exactly the same angles.
+      //
+      // Arguments:
+      //    aLight    - The light being checked.
+      //    aExpected - The light worked out from scratch.
+      //
+      // Return:
+      //    True  - The points are the same.
+      //    False - The points differ in number, angle or position.
+      //
+      //***************************************************************************************************************
+      bool IsSamePoints(const Graphics::Light& aLight, const Graphics::Light& aExpected)
+      {
+         const std::vector<std::pair<float, Math::Vector2D<float>>>& points = aLight.GetPoints();
+         const std::vector<std::pair<float, Math::Vector2D<float>>>& expected = aExpected.GetPoints();
+         if (points.size() != expected.size())
+         {
+            return false;
+         }
+
+         for (std::size_t i = 0; i < points.size(); ++i)
+         {
+            if (points[i].first != expected[i].first ||
+                points[i].second.GetComponentX() != expected[i].second.GetComponentX() ||
+                points[i].second.GetComponentY() != expected[i].second.GetComponentY())
+            {
+               return false;
+            }
+         }
+
+         return true;
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: GetPointChecksum
+      //
+      // Description:
+      //    Adds up the angle and position of every point of a light, so two runs can be compared at a glance.
+      //
+      // Arguments:
+      //    aLight - The light whose points are added up.
+      //
+      // Return:
+      //    Returns the sum of the angles and coordinates of the points.
+      //
+      //***************************************************************************************************************
+      double GetPointChecksum(const Graphics::Light& aLight)
+      {
+         double checksum = 0.0;
+         const std::vector<std::pair<float, Math::Vector2D<float>>>& points = aLight.GetPoints();
+         for (auto iterator = points.begin(); iterator != points.end(); ++iterator)
+         {
+            checksum += iterator->first + iterator->second.GetComponentX() + iterator->second.GetComponentY();
+         }
+
+         return checksum;
+      }
+   }
+
+//*********************************************************************************************************************
+// Public Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: BenchmarkBlockerScene
+   //
+   // Description:
+   //    Times a light shining all the way around in the middle of a square grid of rectangle and circle blockers. The
+   //    light is moved a pixel back and forth between calculations so each one is worked out from scratch. Allegro has
+   //    to be initialized for the timer.
+   //
+   // Arguments:
+   //    aBlockerCount - The number of blockers in the grid.
+   //    aCalculations - The number of times the light is calculated.
+   //    apResult      - The timing and counts of the calculations.
+   //
+   // Return:
+   //    True  - The light was timed.
+   //    False - There were no blockers or no calculations to time.
+   //
+   //******************************************************************************************************************
+   bool LightDiagnostics::BenchmarkBlockerScene(const unsigned int aBlockerCount,
+                                                const unsigned int aCalculations,
+                                                LightBenchmarkResult* apResult)
+   {
+      if (aBlockerCount == 0 || aCalculations == 0 || apResult == nullptr)
+      {
+         return false;
+      }
+
+      std::vector<std::unique_ptr<Objects::Object>> blockers;
+      std::vector<Objects::Object*> blockingObjects;
+      unsigned int columns = MakeBlockerGrid(aBlockerCount, &blockers, &blockingObjects);
+
+      // The light sits in the gap before the middle blocker of the grid and reaches the edge of the grid.
+      float gridSize = static_cast<float>(columns) * LIGHT_BENCHMARK_BLOCKER_SPACING;
+      float center = GetGridGapCenter(columns);
+      Graphics::Light light(Math::Vector2D<float>(center, center), gridSize / 2.0F, Graphics::Color(255, 255, 255, 255),
+                            LIGHT_BENCHMARK_INTENSITY, 0, LIGHT_BENCHMARK_FULL_OFFSET);
+
+      unsigned long long distanceComparisons = 0;
+      double startTime = al_get_time();
+      for (unsigned int calculation = 0; calculation < aCalculations; ++calculation)
+      {
+         light.SetCoordinateX(center + static_cast<float>(calculation % 2));
+         light.CalculateLight(blockingObjects);
+         distanceComparisons += light.GetDistanceComparisons();
+      }
+      double elapsedTime = al_get_time() - startTime;
+
+      apResult->blockers = aBlockerCount;
+      apResult->millisecondsPerCalculation = elapsedTime * MILLISECONDS_PER_SECOND / aCalculations;
+      apResult->distanceComparisons = static_cast<unsigned int>(distanceComparisons / aCalculations);
+
+      // Each comparison is between two distances, or a distance and the radius, that each took a square root.
+      apResult->savedSquareRoots = apResult->distanceComparisons * 2;
+      return true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: BenchmarkMovingBlocker
+   //
+   // Description:
+   //    Times a light shining all the way around in the middle of a square grid of static blockers while a single
+   //    crate moves a pixel back and forth beside it. The light keeps its points between calculations, so only the
+   //    sectors the crate covered are worked out again. A new light is worked out from scratch over the same scene
+   //    after every move, timed on its own, and its points have to match. Allegro has to be initialized for the
+   //    timer.
+   //
+   // Arguments:
+   //    aBlockerCount - The number of static blockers in the grid.
+   //    aCalculations - The number of times the crate is moved and the light calculated.
+   //    apResult      - The timing of the calculations and the number that did not match.
+   //
+   // Return:
+   //    True  - Every calculation of the changed sectors matched working the light out from scratch.
+   //    False - There were no blockers or no calculations to time, or at least one calculation did not match.
+   //
+   //******************************************************************************************************************
+   bool LightDiagnostics::BenchmarkMovingBlocker(const unsigned int aBlockerCount,
+                                                 const unsigned int aCalculations,
+                                                 LightSectorBenchmarkResult* apResult)
+   {
+      if (aBlockerCount == 0 || aCalculations == 0 || apResult == nullptr)
+      {
+         return false;
+      }
+
+      std::vector<std::unique_ptr<Objects::Object>> blockers;
+      std::vector<Objects::Object*> blockingObjects;
+      unsigned int columns = MakeBlockerGrid(aBlockerCount, &blockers, &blockingObjects);
+
+      // The crate sits in the same gap between rows as the light, a few blockers along, so it never overlaps the
+      // grid or the light origin as it moves.
+      float gridSize = static_cast<float>(columns) * LIGHT_BENCHMARK_BLOCKER_SPACING;
+      float center = GetGridGapCenter(columns);
+      float crateX = center + LIGHT_BENCHMARK_CRATE_DISTANCE;
+      Objects::RectangleObject crate(Math::Vector2D<float>(crateX, center - LIGHT_BENCHMARK_CRATE_SIZE / 2),
+                                     LIGHT_BENCHMARK_CRATE_SIZE, LIGHT_BENCHMARK_CRATE_SIZE,
+                                     Graphics::Color(0, 0, 0, 0));
+      blockingObjects.push_back(&crate);
+
+      Graphics::Light light(Math::Vector2D<float>(center, center), gridSize / 2.0F, Graphics::Color(255, 255, 255, 255),
+                            LIGHT_BENCHMARK_INTENSITY, 0, LIGHT_BENCHMARK_FULL_OFFSET);
+      light.CalculateLight(blockingObjects);
+
+      double sectorTime = 0.0;
+      double fullTime = 0.0;
+      unsigned int mismatches = 0;
+      for (unsigned int calculation = 0; calculation < aCalculations; ++calculation)
+      {
+         crate.SetCoordinateX(crateX + static_cast<float>((calculation + 1) % 2));
+
+         double startTime = al_get_time();
+         light.CalculateLight(blockingObjects);
+         sectorTime += al_get_time() - startTime;
+
+         Graphics::Light fullLight(Math::Vector2D<float>(center, center), gridSize / 2.0F,
+                                   Graphics::Color(255, 255, 255, 255), LIGHT_BENCHMARK_INTENSITY, 0,
+                                   LIGHT_BENCHMARK_FULL_OFFSET);
+         startTime = al_get_time();
+         fullLight.CalculateLight(blockingObjects);
+         fullTime += al_get_time() - startTime;
+
+         if (IsSamePoints(light, fullLight) == false)
+         {
+            ++mismatches;
+         }
+      }
+
+      apResult->blockers = aBlockerCount;
+      apResult->millisecondsPerSectorCalculation = sectorTime * MILLISECONDS_PER_SECOND / aCalculations;
+      apResult->millisecondsPerFullCalculation = fullTime * MILLISECONDS_PER_SECOND / aCalculations;
+      apResult->mismatchedCalculations = mismatches;
+      return mismatches == 0;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: BenchmarkConeScene
+   //
+   // Description:
+   //    Times narrow spot lights in the middle of a square grid of rectangle and circle blockers, pointed at angles
+   //    spread evenly around the circle. Each light is timed with cone rejection on and again with it off, moved a
+   //    pixel back and forth between calculations so each one is worked out from scratch. The points of both runs and
+   //    their checksums have to match. Allegro has to be initialized for the timer.
+   //
+   // Arguments:
+   //    aBlockerCount - The number of blockers in the grid.
+   //    aLightCount   - The number of spot lights.
+   //    aCalculations - The number of times each light is calculated in each run.
+   //    apResult      - The timing of both runs, the points and checksum found, and the lights that did not match.
+   //
+   // Return:
+   //    True  - Every light found the same points with cone rejection on and off.
+   //    False - There were no blockers, lights or calculations to time, or at least one light did not match.
+   //
+   //******************************************************************************************************************
+   bool LightDiagnostics::BenchmarkConeScene(const unsigned int aBlockerCount,
+                                             const unsigned int aLightCount,
+                                             const unsigned int aCalculations,
+                                             LightConeBenchmarkResult* apResult)
+   {
+      if (aBlockerCount == 0 || aLightCount == 0 || aCalculations == 0 || apResult == nullptr)
+      {
+         return false;
+      }
+
+      std::vector<std::unique_ptr<Objects::Object>> blockers;
+      std::vector<Objects::Object*> blockingObjects;
+      unsigned int columns = MakeBlockerGrid(aBlockerCount, &blockers, &blockingObjects);
+      float gridSize = static_cast<float>(columns) * LIGHT_BENCHMARK_BLOCKER_SPACING;
+      float center = GetGridGapCenter(columns);
+
+      double rejectionTime = 0.0;
+      double fullTime = 0.0;
+      unsigned int points = 0;
+      double checksum = 0.0;
+      unsigned int mismatches = 0;
+      for (unsigned int lightIndex = 0; lightIndex < aLightCount; ++lightIndex)
+      {
+         int angleCenter = static_cast<int>(lightIndex * LIGHT_BENCHMARK_FULL_CIRCLE / aLightCount);
+         Graphics::Light rejectingLight(Math::Vector2D<float>(center, center), gridSize / 2.0F,
+                                        Graphics::Color(255, 255, 255, 255), LIGHT_BENCHMARK_INTENSITY, angleCenter,
+                                        LIGHT_BENCHMARK_CONE_OFFSET);
+         Graphics::Light fullLight(Math::Vector2D<float>(center, center), gridSize / 2.0F,
+                                   Graphics::Color(255, 255, 255, 255), LIGHT_BENCHMARK_INTENSITY, angleCenter,
+                                   LIGHT_BENCHMARK_CONE_OFFSET);
+         fullLight.SetConeRejection(false);
+
+         double startTime = al_get_time();
+         for (unsigned int calculation = 0; calculation < aCalculations; ++calculation)
+         {
+            rejectingLight.SetCoordinateX(center + static_cast<float>(calculation % 2));
+            rejectingLight.CalculateLight(blockingObjects);
+         }
+         rejectionTime += al_get_time() - startTime;
+
+         startTime = al_get_time();
+         for (unsigned int calculation = 0; calculation < aCalculations; ++calculation)
+         {
+            fullLight.SetCoordinateX(center + static_cast<float>(calculation % 2));
+            fullLight.CalculateLight(blockingObjects);
+         }
+         fullTime += al_get_time() - startTime;
+
+         double lightChecksum = GetPointChecksum(rejectingLight);
+         if (IsSamePoints(rejectingLight, fullLight) == false || lightChecksum != GetPointChecksum(fullLight))
+         {
+            ++mismatches;
+         }
+         points += static_cast<unsigned int>(rejectingLight.GetPoints().size());
+         checksum += lightChecksum;
+      }
+
+      unsigned int calculations = aLightCount * aCalculations;
+      apResult->blockers = aBlockerCount;
+      apResult->lights = aLightCount;
+      apResult->millisecondsWithRejection = rejectionTime * MILLISECONDS_PER_SECOND / calculations;
+      apResult->millisecondsWithoutRejection = fullTime * MILLISECONDS_PER_SECOND / calculations;
+      apResult->points = points;
+      apResult->checksum = checksum;
+      apResult->mismatchedLights = mismatches;
+      return mismatches == 0;
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no private methods for this class.
+
+//*********************************************************************************************************************
+// Private Methods - End
+//*********************************************************************************************************************
+}}
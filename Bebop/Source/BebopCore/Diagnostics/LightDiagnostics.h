@@ -0,0 +1,189 @@
+//*********************************************************************************************************************
+//
+// File: LightDiagnostics.h
+//
+// Description:
+//    This class measures how lights perform in generated scenes, so changes to the light calculation can be compared
+//    on the same work.
+//
+//*********************************************************************************************************************
+
+#ifndef LightDiagnostics_H
+#define LightDiagnostics_H
+
+namespace Bebop { namespace Diagnostics
+{
+   // The outcome of timing a light in a scene of blockers.
+   struct LightBenchmarkResult
+   {
+      // The number of blockers in the scene.
+      unsigned int blockers;
+
+      // The average milliseconds a full calculation of the light took.
+      double millisecondsPerCalculation;
+
+      // The squared distance comparisons in each calculation of the light.
+      unsigned int distanceComparisons;
+
+      // The square roots each calculation of the light avoids by comparing squared distances.
+      unsigned int savedSquareRoots;
+   };
+
+   // The outcome of timing a light that only works out the sectors a moving blocker covered against working it out
+   // from scratch.
+   struct LightSectorBenchmarkResult
+   {
+      // The number of static blockers in the scene.
+      unsigned int blockers;
+
+      // The average milliseconds a calculation of only the changed sectors took.
+      double millisecondsPerSectorCalculation;
+
+      // The average milliseconds a full calculation of the same scene took.
+      double millisecondsPerFullCalculation;
+
+      // The number of calculations whose points did not match the full calculation.
+      unsigned int mismatchedCalculations;
+   };
+
+   // The outcome of timing narrow spot lights with and without skipping the blockers outside of their cones.
+   struct LightConeBenchmarkResult
+   {
+      // The number of blockers in the scene.
+      unsigned int blockers;
+
+      // The number of spot lights timed.
+      unsigned int lights;
+
+      // The average milliseconds a calculation of a light took while skipping blockers outside of its cone.
+      double millisecondsWithRejection;
+
+      // The average milliseconds a calculation of a light took while working out the points of every blocker.
+      double millisecondsWithoutRejection;
+
+      // The number of points the lights found and the sum of their angles and coordinates.
+      unsigned int points;
+      double checksum;
+
+      // The number of lights whose points or checksum differed between the two runs.
+      unsigned int mismatchedLights;
+   };
+
+   class LightDiagnostics
+   {
+      //***************************************************************************************************************
+      // Methods - Start
+      //***************************************************************************************************************
+
+      public:
+
+         //************************************************************************************************************
+         //
+         // Method: BenchmarkBlockerScene
+         //
+         // Description:
+         //    Times a light shining all the way around in the middle of a square grid of rectangle and circle
+         //    blockers. The light is moved a pixel back and forth between calculations so each one is worked out
+         //    from scratch. Allegro has to be initialized for the timer.
+         //
+         // Arguments:
+         //    aBlockerCount - The number of blockers in the grid.
+         //    aCalculations - The number of times the light is calculated.
+         //    apResult      - The timing and counts of the calculations.
+         //
+         // Return:
+         //    True  - The light was timed.
+         //    False - There were no blockers or no calculations to time.
+         //
+         //************************************************************************************************************
+         static bool BenchmarkBlockerScene(const unsigned int aBlockerCount,
+                                           const unsigned int aCalculations,
+                                           LightBenchmarkResult* apResult);
+
+         //************************************************************************************************************
+         //
+         // Method: BenchmarkMovingBlocker
+         //
+         // Description:
+         //    Times a light shining all the way around in the middle of a square grid of static blockers while a
+         //    single crate moves a pixel back and forth beside it. The light keeps its points between calculations,
+         //    so only the sectors the crate covered are worked out again. A new light is worked out from scratch over
+         //    the same scene after every move, timed on its own, and its points have to match. Allegro has to be
+         //    initialized for the timer.
+         //
+         // Arguments:
+         //    aBlockerCount - The number of static blockers in the grid.
+         //    aCalculations - The number of times the crate is moved and the light calculated.
+         //    apResult      - The timing of the calculations and the number that did not match.
+         //
+         // Return:
+         //    True  - Every calculation of the changed sectors matched working the light out from scratch.
+         //    False - There were no blockers or no calculations to time, or at least one calculation did not match.
+         //
+         //************************************************************************************************************
+         static bool BenchmarkMovingBlocker(const unsigned int aBlockerCount,
+                                            const unsigned int aCalculations,
+                                            LightSectorBenchmarkResult* apResult);
+
+         //************************************************************************************************************
+         //
+         // Method: BenchmarkConeScene
+         //
+         // Description:
+         //    Times narrow spot lights in the middle of a square grid of rectangle and circle blockers, pointed at
+         //    angles spread evenly around the circle. Each light is timed with cone rejection on and again with it
+         //    off, moved a pixel back and forth between calculations so each one is worked out from scratch. The
+         //    points of both runs and their checksums have to match. Allegro has to be initialized for the timer.
+         //
+         // Arguments:
+         //    aBlockerCount - The number of blockers in the grid.
+         //    aLightCount   - The number of spot lights.
+         //    aCalculations - The number of times each light is calculated in each run.
+         //    apResult      - The timing of both runs, the points and checksum found, and the lights that did not
+         //                    match.
+         //
+         // Return:
+         //    True  - Every light found the same points with cone rejection on and off.
+         //    False - There were no blockers, lights or calculations to time, or at least one light did not match.
+         //
+         //************************************************************************************************************
+         static bool BenchmarkConeScene(const unsigned int aBlockerCount,
+                                        const unsigned int aLightCount,
+                                        const unsigned int aCalculations,
+                                        LightConeBenchmarkResult* apResult);
+
+      protected:
+
+         // There are currently no protected methods for this class.
+
+      private:
+
+         // There are currently no private methods for this class.
+
+      //***************************************************************************************************************
+      // Methods - End
+      //***************************************************************************************************************
+
+      //***************************************************************************************************************
+      // Member Variables - Start
+      //***************************************************************************************************************
+
+      public:
+
+         // There are currently no public member variables for this class.
+
+      protected:
+
+         // There are currently no protected member variables for this class.
+
+      private:
+
+         // There are currently no private member variables for this class.
+
+      //***************************************************************************************************************
+      // Member Variables - End
+      //***************************************************************************************************************
+   };
+}}
+
+#endif // LightDiagnostics_H
@@ -0,0 +1,286 @@
+//*********************************************************************************************************************
+//
+// File: MathDiagnostics.cpp
+//
+// Description:
+//    This class checks the bulk operations of the math namespace against working one value at a time. The SIMD
+//    operations of the vector array are compared with the same operations on each Vector2D in turn.
+//
+//*********************************************************************************************************************
+
+#include "MathDiagnostics.h"
+#include "DiagnosticsConstants.h"
+#include "../Math/Vector2D.h"
+#include "../Math/Vector2DArray.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace Bebop { namespace Diagnostics
+{
+   namespace
+   {
+      //***************************************************************************************************************
+      //
+      // Method Name: RandomComponent
+      //
+      // Description:
+      //    Returns a random vector component between the negative and positive component range.
+      //
+      // Arguments:
+      //    apGenerator - The generator the vectors are drawn from.
+      //
+      // Return:
+      //    Returns the random component.
+      //
+      //***************************************************************************************************************
+      float RandomComponent(std::mt19937* apGenerator)
+      {
+         return (static_cast<float>((*apGenerator)()) / static_cast<float>(std::mt19937::max()) * 2.0F - 1.0F) *
+                VECTOR_ARRAY_COMPONENT_RANGE;
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: IsSameValue
+      //
+      // Description:
+      //    Checks whether a value is within the tolerance of the expected value, relative to the size of the expected
+      //    value once it is past 1.0. The NEON path refines an estimate of the square root and may fuse a multiply
+      //    and add, so its results can differ in the last bits.
+      //
+      // Arguments:
+      //    aValue    - The value being checked.
+      //    aExpected - The value worked out one vector at a time.
+      //
+      // Return:
+      //    True  - The value is within the tolerance.
+      //    False - The value is not within the tolerance.
+      //
+      //***************************************************************************************************************
+      bool IsSameValue(const float aValue, const float aExpected)
+      {
+         return fabsf(aValue - aExpected) <= VECTOR_ARRAY_TOLERANCE * std::max(1.0F, fabsf(aExpected));
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: IsSameArray
+      //
+      // Description:
+      //    Checks whether every vector of an array is within the tolerance of the expected vectors.
+      //
+      // Arguments:
+      //    aArray    - The array being checked.
+      //    aExpected - The vectors worked out one at a time.
+      //
+      // Return:
+      //    True  - Every vector is within the tolerance.
+      //    False - At least one vector is not within the tolerance.
+      //
+      //***************************************************************************************************************
+      bool IsSameArray(const Math::Vector2DArray& aArray, const std::vector<Math::Vector2D<float>>& aExpected)
+      {
+         if (aArray.GetSize() != aExpected.size())
+         {
+            return false;
+         }
+
+         for (unsigned int i = 0; i < aArray.GetSize(); ++i)
+         {
+            if (IsSameValue(aArray.GetComponentsX()[i], aExpected[i].GetComponentX()) == false ||
+                IsSameValue(aArray.GetComponentsY()[i], aExpected[i].GetComponentY()) == false)
+            {
+               return false;
+            }
+         }
+
+         return true;
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: MakeArray
+      //
+      // Description:
+      //    Fills a vector array with the passed in vectors.
+      //
+      // Arguments:
+      //    aVectors - The vectors the array holds.
+      //
+      // Return:
+      //    Returns the filled array.
+      //
+      //***************************************************************************************************************
+      Math::Vector2DArray MakeArray(const std::vector<Math::Vector2D<float>>& aVectors)
+      {
+         Math::Vector2DArray array;
+         for (auto iterator = aVectors.begin(); iterator != aVectors.end(); ++iterator)
+         {
+            array.AddVector(*iterator);
+         }
+
+         return array;
+      }
+   }
+
+//*********************************************************************************************************************
+// Public Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: CheckVector2DArrayKernels
+   //
+   // Description:
+   //    Compares AddArray, AddScaledArray, Scale, Dot and Normalize of the vector array with the same operation on each
+   //    vector in turn. Arrays of every size up to the maximum are checked, so every number of vectors left over for
+   //    the scalar path after the SIMD lanes is covered. Some of the vectors are zero length, which Normalize has to
+   //    leave as is.
+   //
+   // Arguments:
+   //    aSeed        - The seed the vectors are generated from.
+   //    aMaximumSize - The size of the largest array checked.
+   //    apResult     - The counts of each outcome.
+   //
+   // Return:
+   //    True  - Every operation matched on every array.
+   //    False - At least one operation did not match.
+   //
+   //******************************************************************************************************************
+   bool MathDiagnostics::CheckVector2DArrayKernels(const unsigned int aSeed,
+                                                   const unsigned int aMaximumSize,
+                                                   Vector2DArrayCheckResult* apResult)
+   {
+      Vector2DArrayCheckResult result = {0, 0, 0, 0, 0, 0};
+      std::mt19937 generator(aSeed);
+
+      for (unsigned int size = 0; size <= aMaximumSize; ++size)
+      {
+         std::vector<Math::Vector2D<float>> vectors;
+         std::vector<Math::Vector2D<float>> others;
+         for (unsigned int i = 0; i < size; ++i)
+         {
+            if (i % VECTOR_ARRAY_ZERO_INTERVAL == 0)
+            {
+               vectors.push_back(Math::Vector2D<float>(0.0F, 0.0F));
+            }
+            else
+            {
+               vectors.push_back(Math::Vector2D<float>(RandomComponent(&generator), RandomComponent(&generator)));
+            }
+            others.push_back(Math::Vector2D<float>(RandomComponent(&generator), RandomComponent(&generator)));
+         }
+         const float scale = RandomComponent(&generator);
+         const Math::Vector2D<float> scaleVector(scale, scale);
+         const Math::Vector2DArray otherArray = MakeArray(others);
+
+         // An array one vector larger must be refused without changing anything.
+         std::vector<Math::Vector2D<float>> largerVectors = others;
+         largerVectors.push_back(Math::Vector2D<float>(0.0F, 0.0F));
+         const Math::Vector2DArray largerArray = MakeArray(largerVectors);
+
+         std::vector<Math::Vector2D<float>> expected;
+         for (unsigned int i = 0; i < size; ++i)
+         {
+            expected.push_back(vectors[i] + others[i]);
+         }
+         Math::Vector2DArray array = MakeArray(vectors);
+         if (array.AddArray(otherArray) == false || IsSameArray(array, expected) == false ||
+             array.AddArray(largerArray) == true || IsSameArray(array, expected) == false)
+         {
+            ++result.addMismatched;
+         }
+
+         expected.clear();
+         for (unsigned int i = 0; i < size; ++i)
+         {
+            expected.push_back(vectors[i] + others[i] * scaleVector);
+         }
+         array = MakeArray(vectors);
+         if (array.AddScaledArray(otherArray, scale) == false || IsSameArray(array, expected) == false ||
+             array.AddScaledArray(largerArray, scale) == true || IsSameArray(array, expected) == false)
+         {
+            ++result.addScaledMismatched;
+         }
+
+         expected.clear();
+         for (unsigned int i = 0; i < size; ++i)
+         {
+            expected.push_back(vectors[i] * scaleVector);
+         }
+         array = MakeArray(vectors);
+         array.Scale(scale);
+         if (IsSameArray(array, expected) == false)
+         {
+            ++result.scaleMismatched;
+         }
+
+         // The refused call must write no results, and the other call must write no more than one for each vector.
+         array = MakeArray(vectors);
+         std::vector<float> dotProducts(size + 1, VECTOR_ARRAY_UNWRITTEN_MARKER);
+         bool dotMatched = array.Dot(largerArray, dotProducts.data()) == false &&
+                           std::all_of(dotProducts.begin(), dotProducts.end(), [](const float aDotProduct)
+                           {
+                              return aDotProduct == VECTOR_ARRAY_UNWRITTEN_MARKER;
+                           });
+         dotMatched = dotMatched == true && array.Dot(otherArray, dotProducts.data()) == true &&
+                      dotProducts[size] == VECTOR_ARRAY_UNWRITTEN_MARKER;
+         for (unsigned int i = 0; i < size && dotMatched == true; ++i)
+         {
+            dotMatched = IsSameValue(dotProducts[i], vectors[i].Dot(others[i]));
+         }
+         if (dotMatched == false)
+         {
+            ++result.dotMismatched;
+         }
+
+         expected.clear();
+         for (unsigned int i = 0; i < size; ++i)
+         {
+            expected.push_back(vectors[i].GetNormalized());
+         }
+         array = MakeArray(vectors);
+         array.Normalize();
+         if (IsSameArray(array, expected) == false)
+         {
+            ++result.normalizeMismatched;
+         }
+
+         ++result.checked;
+      }
+
+      if (apResult != nullptr)
+      {
+         *apResult = result;
+      }
+
+      return result.addMismatched == 0 && result.addScaledMismatched == 0 && result.scaleMismatched == 0 &&
+             result.dotMismatched == 0 && result.normalizeMismatched == 0;
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no private methods for this class.
+
+//*********************************************************************************************************************
+// Private Methods - End
+//*********************************************************************************************************************
+}}
@@ -0,0 +1,97 @@
+//*********************************************************************************************************************
+//
+// File: MathDiagnostics.h
+//
+// Description:
+//    This class checks the bulk operations of the math namespace against working one value at a time. The SIMD
+//    operations of the vector array are compared with the same operations on each Vector2D in turn.
+//
+//*********************************************************************************************************************
+
+#ifndef MathDiagnostics_H
+#define MathDiagnostics_H
+
+namespace Bebop { namespace Diagnostics
+{
+   // The outcome of checking the bulk operations of the vector array.
+   struct Vector2DArrayCheckResult
+   {
+      // The number of arrays checked with each operation.
+      unsigned int checked;
+
+      // The arrays where an operation disagrees with working one vector at a time, or where an operation on arrays of
+      // different sizes did not refuse them.
+      unsigned int addMismatched;
+      unsigned int addScaledMismatched;
+      unsigned int scaleMismatched;
+      unsigned int dotMismatched;
+      unsigned int normalizeMismatched;
+   };
+
+   class MathDiagnostics
+   {
+      //***************************************************************************************************************
+      // Methods - Start
+      //***************************************************************************************************************
+
+      public:
+
+         //************************************************************************************************************
+         //
+         // Method: CheckVector2DArrayKernels
+         //
+         // Description:
+         //    Compares AddArray, AddScaledArray, Scale, Dot and Normalize of the vector array with the same
+         //    operation on each vector in turn. Arrays of every size up to the maximum are checked, so every number
+         //    of vectors left over for the scalar path after the SIMD lanes is covered. Some of the vectors are zero
+         //    length, which Normalize has to leave as is.
+         //
+         // Arguments:
+         //    aSeed        - The seed the vectors are generated from.
+         //    aMaximumSize - The size of the largest array checked.
+         //    apResult     - The counts of each outcome.
+         //
+         // Return:
+         //    True  - Every operation matched on every array.
+         //    False - At least one operation did not match.
+         //
+         //************************************************************************************************************
+         static bool CheckVector2DArrayKernels(const unsigned int aSeed,
+                                               const unsigned int aMaximumSize,
+                                               Vector2DArrayCheckResult* apResult);
+
+      protected:
+
+         // There are currently no protected methods for this class.
+
+      private:
+
+         // There are currently no private methods for this class.
+
+      //***************************************************************************************************************
+      // Methods - End
+      //***************************************************************************************************************
+
+      //***************************************************************************************************************
+      // Member Variables - Start
+      //***************************************************************************************************************
+
+      public:
+
+         // There are currently no public member variables for this class.
+
+      protected:
+
+         // There are currently no protected member variables for this class.
+
+      private:
+
+         // There are currently no private member variables for this class.
+
+      //***************************************************************************************************************
+      // Member Variables - End
+      //***************************************************************************************************************
+   };
+}}
+
+#endif // MathDiagnostics_H
@@ -0,0 +1,124 @@
+//*********************************************************************************************************************
+//
+// File: SceneDiagnostics.cpp
+//
+// Description:
+//    This class measures how scene layers perform when many items come and go, so changes to how a layer stores its
+//    items can be compared on the same work.
+//
+//*********************************************************************************************************************
+
+#include "SceneDiagnostics.h"
+#include "DiagnosticsConstants.h"
+#include "../Graphics/SceneLayer.h"
+#include "../Objects/CircleObject.h"
+#include <allegro5/allegro.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace Bebop { namespace Diagnostics
+{
+//*********************************************************************************************************************
+// Public Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: BenchmarkEntityChurn
+   //
+   // Description:
+   //    Times spawning a burst of particles onto a scene layer and clearing them again, the way a game spawns and
+   //    clears bullets. Each round adds every particle and then removes them in a shuffled order. Allegro has to be
+   //    initialized for the timer.
+   //
+   // Arguments:
+   //    aItemCount - The number of particles added and removed in each round.
+   //    aRounds    - The number of rounds.
+   //    apResult   - The timing of the rounds.
+   //
+   // Return:
+   //    True  - The churn was timed.
+   //    False - There were no items or no rounds to time.
+   //
+   //******************************************************************************************************************
+   bool SceneDiagnostics::BenchmarkEntityChurn(const unsigned int aItemCount,
+                                               const unsigned int aRounds,
+                                               EntityChurnResult* apResult)
+   {
+      if (aItemCount == 0 || aRounds == 0 || apResult == nullptr)
+      {
+         return false;
+      }
+
+      // The particles are made up front so only the layer's own work is timed.
+      std::vector<std::unique_ptr<Graphics::Particle>> particles;
+      for (unsigned int i = 0; i < aItemCount; ++i)
+      {
+         particles.emplace_back(new Graphics::Particle(
+            new Objects::CircleObject(Math::Vector2D<float>(static_cast<float>(i % SCENE_CHURN_COLUMNS),
+                                                            static_cast<float>(i / SCENE_CHURN_COLUMNS)),
+                                      SCENE_CHURN_PARTICLE_RADIUS, Graphics::Color(0, 0, 0, 0)),
+            nullptr, SCENE_CHURN_TIME_TO_LIVE));
+      }
+
+      std::vector<Graphics::Particle*> removalOrder;
+      for (auto iterator = particles.begin(); iterator != particles.end(); ++iterator)
+      {
+         removalOrder.push_back(iterator->get());
+      }
+
+      std::mt19937 generator(SCENE_CHURN_SEED);
+      Graphics::SceneLayer layer;
+      double addTime = 0.0;
+      double removeTime = 0.0;
+      for (unsigned int round = 0; round < aRounds; ++round)
+      {
+         std::shuffle(removalOrder.begin(), removalOrder.end(), generator);
+
+         double startTime = al_get_time();
+         for (auto iterator = particles.begin(); iterator != particles.end(); ++iterator)
+         {
+            layer.AddParticle(iterator->get());
+         }
+         addTime += al_get_time() - startTime;
+
+         startTime = al_get_time();
+         for (auto iterator = removalOrder.begin(); iterator != removalOrder.end(); ++iterator)
+         {
+            layer.RemoveParticle(*iterator);
+         }
+         removeTime += al_get_time() - startTime;
+      }
+
+      apResult->items = aItemCount;
+      apResult->millisecondsToAdd = addTime * MILLISECONDS_PER_SECOND / aRounds;
+      apResult->millisecondsToRemove = removeTime * MILLISECONDS_PER_SECOND / aRounds;
+      return true;
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no private methods for this class.
+
+//*********************************************************************************************************************
+// Private Methods - End
+//*********************************************************************************************************************
+}}
@@ -0,0 +1,94 @@
+//*********************************************************************************************************************
+//
+// File: SceneDiagnostics.h
+//
+// Description:
+//    This class measures how scene layers perform when many items come and go, so changes to how a layer stores its
+//    items can be compared on the same work.
+//
+//*********************************************************************************************************************
+
+#ifndef SceneDiagnostics_H
+#define SceneDiagnostics_H
+
+namespace Bebop { namespace Diagnostics
+{
+   // The outcome of timing items being added to and removed from a scene layer.
+   struct EntityChurnResult
+   {
+      // The number of items added and removed in each round.
+      unsigned int items;
+
+      // The average milliseconds adding every item took in a round.
+      double millisecondsToAdd;
+
+      // The average milliseconds removing every item took in a round.
+      double millisecondsToRemove;
+   };
+
+   class SceneDiagnostics
+   {
+      //***************************************************************************************************************
+      // Methods - Start
+      //***************************************************************************************************************
+
+      public:
+
+         //************************************************************************************************************
+         //
+         // Method: BenchmarkEntityChurn
+         //
+         // Description:
+         //    Times spawning a burst of particles onto a scene layer and clearing them again, the way a game spawns
+         //    and clears bullets. Each round adds every particle and then removes them in a shuffled order. Allegro
+         //    has to be initialized for the timer.
+         //
+         // Arguments:
+         //    aItemCount - The number of particles added and removed in each round.
+         //    aRounds    - The number of rounds.
+         //    apResult   - The timing of the rounds.
+         //
+         // Return:
+         //    True  - The churn was timed.
+         //    False - There were no items or no rounds to time.
+         //
+         //************************************************************************************************************
+         static bool BenchmarkEntityChurn(const unsigned int aItemCount,
+                                          const unsigned int aRounds,
+                                          EntityChurnResult* apResult);
+
+      protected:
+
+         // There are currently no protected methods for this class.
+
+      private:
+
+         // There are currently no private methods for this class.
+
+      //***************************************************************************************************************
+      // Methods - End
+      //***************************************************************************************************************
+
+      //***************************************************************************************************************
+      // Member Variables - Start
+      //***************************************************************************************************************
+
+      public:
+
+         // There are currently no public member variables for this class.
+
+      protected:
+
+         // There are currently no protected member variables for this class.
+
+      private:
+
+         // There are currently no private member variables for this class.
+
+      //***************************************************************************************************************
+      // Member Variables - End
+      //***************************************************************************************************************
+   };
+}}
+
+#endif // SceneDiagnostics_H
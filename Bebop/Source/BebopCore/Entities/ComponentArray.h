@@ -0,0 +1,549 @@
+//*********************************************************************************************************************
+//
+// File: ComponentArray.h
+//
+// Description:
+//    This class stores one type of component for many entities. The components are kept packed together in a single
+//    vector so systems can walk over them in order without following pointers. A lookup indexed by the slot index of
+//    the entity finds the component belonging to a specific entity, so adding, finding, and removing a component are
+//    constant time.
+//
+//*********************************************************************************************************************
+
+#ifndef ComponentArray_H
+#define ComponentArray_H
+
+#include "Entity.h"
+#include <vector>
+
+namespace Bebop { namespace Entities
+{
+   template<class T>
+   class ComponentArray
+   {
+      //***************************************************************************************************************
+      // Methods - Start
+      //***************************************************************************************************************
+
+      public:
+
+         //************************************************************************************************************
+         //
+         // Method: ComponentArray
+         //
+         // Description:
+         //    Constructor for an empty component array.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         ComponentArray();
+
+         //************************************************************************************************************
+         //
+         // Method: ~ComponentArray
+         //
+         // Description:
+         //    Destructor for the component array.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         ~ComponentArray();
+
+         //************************************************************************************************************
+         //
+         // Method: AddComponent
+         //
+         // Description:
+         //    Adds a component for an entity to the end of the array.
+         //
+         // Arguments:
+         //    aEntity    - The entity the component belongs to.
+         //    aComponent - The component being added.
+         //
+         // Return:
+         //    True  - The component was added.
+         //    False - The entity already has a component in this array.
+         //
+         //************************************************************************************************************
+         bool AddComponent(const Entity aEntity, const T& aComponent);
+
+         //************************************************************************************************************
+         //
+         // Method: RemoveComponent
+         //
+         // Description:
+         //    Removes the component of an entity. The last component is moved into the removed component's place.
+         //
+         // Arguments:
+         //    aEntity - The entity whose component is removed.
+         //
+         // Return:
+         //    True  - The component was removed.
+         //    False - The entity does not have a component in this array.
+         //
+         //************************************************************************************************************
+         bool RemoveComponent(const Entity aEntity);
+
+         //************************************************************************************************************
+         //
+         // Method: GetComponent
+         //
+         // Description:
+         //    Returns the component of an entity.
+         //
+         // Arguments:
+         //    aEntity - The entity whose component is returned.
+         //
+         // Return:
+         //    Returns a pointer to the component, or nullptr if the entity does not have a component in this array.
+         //
+         //************************************************************************************************************
+         T* GetComponent(const Entity aEntity);
+
+         //************************************************************************************************************
+         //
+         // Method: HasComponent
+         //
+         // Description:
+         //    Checks if an entity has a component in this array.
+         //
+         // Arguments:
+         //    aEntity - The entity being checked.
+         //
+         // Return:
+         //    True  - The entity has a component.
+         //    False - The entity does not have a component.
+         //
+         //************************************************************************************************************
+         bool HasComponent(const Entity aEntity) const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetEntityAt
+         //
+         // Description:
+         //    Returns the entity that owns the component at the passed in position of the array.
+         //
+         // Arguments:
+         //    aIndex - The position of the component in the array.
+         //
+         // Return:
+         //    Returns the entity that owns the component.
+         //
+         //************************************************************************************************************
+         Entity GetEntityAt(const unsigned int aIndex) const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetComponents
+         //
+         // Description:
+         //    Returns the packed components so systems can iterate over them in order.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the vector of components.
+         //
+         //************************************************************************************************************
+         const std::vector<T>& GetComponents() const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetComponents
+         //
+         // Description:
+         //    Returns the packed components so systems can update them in place in order. Components must not be
+         //    added or removed through the returned vector.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the vector of components.
+         //
+         //************************************************************************************************************
+         std::vector<T>& GetComponents();
+
+         //************************************************************************************************************
+         //
+         // Method: GetSize
+         //
+         // Description:
+         //    Returns the number of components in the array.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the number of components.
+         //
+         //************************************************************************************************************
+         unsigned int GetSize() const;
+
+         //************************************************************************************************************
+         //
+         // Method: Clear
+         //
+         // Description:
+         //    Removes every component from the array.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void Clear();
+
+      protected:
+
+         // There are currently no protected methods for this class.
+
+      private:
+
+         // There are currently no private methods for this class.
+
+      //***************************************************************************************************************
+      // Methods - End
+      //***************************************************************************************************************
+
+      //***************************************************************************************************************
+      // Member Variables - Start
+      //***************************************************************************************************************
+
+      public:
+
+         // There are currently no public member variables for this class.
+
+      protected:
+
+         // There are currently no protected member variables for this class.
+
+      private:
+
+         // The packed components.
+         std::vector<T> mComponents;
+
+         // The entity that owns the component at the same position in the component vector.
+         std::vector<Entity> mEntities;
+
+         // The position of each entity's component in the component vector, indexed by the slot index of the entity.
+         std::vector<unsigned int> mSlots;
+
+      //***************************************************************************************************************
+      // Member Variables - End
+      //***************************************************************************************************************
+   };
+
+//*********************************************************************************************************************
+// Public Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: ComponentArray
+   //
+   // Description:
+   //    Constructor for an empty component array.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   template<class T>
+   ComponentArray<T>::ComponentArray()
+   {
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: ~ComponentArray
+   //
+   // Description:
+   //    Destructor for the component array.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   template<class T>
+   ComponentArray<T>::~ComponentArray()
+   {
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AddComponent
+   //
+   // Description:
+   //    Adds a component for an entity to the end of the array.
+   //
+   // Arguments:
+   //    aEntity    - The entity the component belongs to.
+   //    aComponent - The component being added.
+   //
+   // Return:
+   //    True  - The component was added.
+   //    False - The entity already has a component in this array.
+   //
+   //******************************************************************************************************************
+   template<class T>
+   bool ComponentArray<T>::AddComponent(const Entity aEntity, const T& aComponent)
+   {
+      unsigned int index = GetEntityIndex(aEntity);
+      if (index >= mSlots.size())
+      {
+         mSlots.resize(index + 1, INVALID_COMPONENT_SLOT);
+      }
+      else if (mSlots[index] != INVALID_COMPONENT_SLOT)
+      {
+         return false;
+      }
+
+      mSlots[index] = static_cast<unsigned int>(mComponents.size());
+      mComponents.push_back(aComponent);
+      mEntities.push_back(aEntity);
+      return true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: RemoveComponent
+   //
+   // Description:
+   //    Removes the component of an entity. The last component is moved into the removed component's place.
+   //
+   // Arguments:
+   //    aEntity - The entity whose component is removed.
+   //
+   // Return:
+   //    True  - The component was removed.
+   //    False - The entity does not have a component in this array.
+   //
+   //******************************************************************************************************************
+   template<class T>
+   bool ComponentArray<T>::RemoveComponent(const Entity aEntity)
+   {
+      if (HasComponent(aEntity) == false)
+      {
+         return false;
+      }
+
+      unsigned int removedSlot = mSlots[GetEntityIndex(aEntity)];
+      unsigned int lastSlot = static_cast<unsigned int>(mComponents.size()) - 1;
+
+      // Move the last component into the removed slot so the components stay packed.
+      if (removedSlot != lastSlot)
+      {
+         mComponents[removedSlot] = mComponents[lastSlot];
+         mEntities[removedSlot] = mEntities[lastSlot];
+         mSlots[GetEntityIndex(mEntities[removedSlot])] = removedSlot;
+      }
+
+      mComponents.pop_back();
+      mEntities.pop_back();
+      mSlots[GetEntityIndex(aEntity)] = INVALID_COMPONENT_SLOT;
+      return true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetComponent
+   //
+   // Description:
+   //    Returns the component of an entity.
+   //
+   // Arguments:
+   //    aEntity - The entity whose component is returned.
+   //
+   // Return:
+   //    Returns a pointer to the component, or nullptr if the entity does not have a component in this array.
+   //
+   //******************************************************************************************************************
+   template<class T>
+   T* ComponentArray<T>::GetComponent(const Entity aEntity)
+   {
+      if (HasComponent(aEntity) == false)
+      {
+         return nullptr;
+      }
+
+      return &mComponents[mSlots[GetEntityIndex(aEntity)]];
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: HasComponent
+   //
+   // Description:
+   //    Checks if an entity has a component in this array.
+   //
+   // Arguments:
+   //    aEntity - The entity being checked.
+   //
+   // Return:
+   //    True  - The entity has a component.
+   //    False - The entity does not have a component.
+   //
+   //******************************************************************************************************************
+   template<class T>
+   bool ComponentArray<T>::HasComponent(const Entity aEntity) const
+   {
+      unsigned int index = GetEntityIndex(aEntity);
+      if (index >= mSlots.size() || mSlots[index] == INVALID_COMPONENT_SLOT)
+      {
+         return false;
+      }
+
+      // A stale handle shares the slot index with the current entity but not the generation.
+      return mEntities[mSlots[index]] == aEntity;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetEntityAt
+   //
+   // Description:
+   //    Returns the entity that owns the component at the passed in position of the array.
+   //
+   // Arguments:
+   //    aIndex - The position of the component in the array.
+   //
+   // Return:
+   //    Returns the entity that owns the component.
+   //
+   //******************************************************************************************************************
+   template<class T>
+   Entity ComponentArray<T>::GetEntityAt(const unsigned int aIndex) const
+   {
+      return mEntities[aIndex];
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetComponents
+   //
+   // Description:
+   //    Returns the packed components so systems can iterate over them in order.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the vector of components.
+   //
+   //******************************************************************************************************************
+   template<class T>
+   const std::vector<T>& ComponentArray<T>::GetComponents() const
+   {
+      return mComponents;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetComponents
+   //
+   // Description:
+   //    Returns the packed components so systems can update them in place in order. Components must not be added or
+   //    removed through the returned vector.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the vector of components.
+   //
+   //******************************************************************************************************************
+   template<class T>
+   std::vector<T>& ComponentArray<T>::GetComponents()
+   {
+      return mComponents;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetSize
+   //
+   // Description:
+   //    Returns the number of components in the array.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the number of components.
+   //
+   //******************************************************************************************************************
+   template<class T>
+   unsigned int ComponentArray<T>::GetSize() const
+   {
+      return static_cast<unsigned int>(mComponents.size());
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: Clear
+   //
+   // Description:
+   //    Removes every component from the array.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   template<class T>
+   void ComponentArray<T>::Clear()
+   {
+      mComponents.clear();
+      mEntities.clear();
+      mSlots.clear();
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no private methods for this class.
+
+//*********************************************************************************************************************
+// Private Methods - End
+//*********************************************************************************************************************
+}}
+
+#endif // ComponentArray_H
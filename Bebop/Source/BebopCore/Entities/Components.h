@@ -0,0 +1,109 @@
+//*********************************************************************************************************************
+//
+// File: Components.h
+//
+// Description:
+//    This file holds the components that can be attached to an entity. Each component is small and stored by value in
+//    a component array so the systems that use it walk over packed memory. Sprite instances keep their position,
+//    image and playback in these components and only refer to the shared sprite and clip they are drawn from. Items
+//    added by pointer keep their own position and state, so their components refer to the item that is drawn or
+//    updated.
+//
+//*********************************************************************************************************************
+
+#ifndef Components_H
+#define Components_H
+
+#include "../Graphics/Sprite.h"
+#include "../Graphics/AnimatedSprite.h"
+#include "../Graphics/Particle.h"
+#include "../Graphics/Light.h"
+#include "../Objects/Object.h"
+
+namespace Bebop { namespace Entities
+{
+   // The position and rotation of a sprite instance. Every sprite instance has both a transform and a sprite
+   // component, which are added and removed together, so both arrays hold the instances in the same order.
+   struct TransformComponent
+   {
+      float positionX;
+      float positionY;
+      float rotation;
+   };
+
+   // The image of a sprite instance. The sprite is shared by every instance drawn from it and only supplies the image,
+   // while the part of the image drawn is kept by the instance, relative to the source of the sprite.
+   struct SpriteComponent
+   {
+      const Graphics::Sprite* pSprite;
+      int sourceX;
+      int sourceY;
+      int width;
+      int height;
+   };
+
+   // The playback of the clip of an animated sprite instance. The sprite component of the instance is moved onto
+   // each new frame as the clip plays.
+   struct AnimationStateComponent
+   {
+      const Graphics::AnimationClip* pClip;
+      float clipTime;
+      unsigned int frame;
+   };
+
+   // The playback of the clip of an animated sprite instance played from the clock of its layer. Only the clip and
+   // the start time are kept, so updates never touch these, and the sprite component of the same instance is moved
+   // onto the frame shown at the clock time when the layer is drawn.
+   struct ClockAnimationComponent
+   {
+      const Graphics::AnimationClip* pClip;
+      double startTime;
+   };
+
+   // A sprite added by pointer that keeps its own position and image. These adapt callers that allocate their
+   // sprites themselves and are drawn through the sprite rather than from the packed components.
+   struct SpriteAdapterComponent
+   {
+      Graphics::Sprite* pSprite;
+   };
+
+   // An animated sprite added by pointer that keeps its own position, image and playback. These adapt callers that
+   // allocate their animated sprites themselves and are updated and drawn through the animated sprite. Sprites
+   // played from the clock are kept in an array of their own, which updates never walk.
+   struct AnimatedSpriteAdapterComponent
+   {
+      Graphics::AnimatedSprite* pAnimatedSprite;
+   };
+
+   // A particle updated and drawn by the entity.
+   struct ParticleComponent
+   {
+      Graphics::Particle* pParticle;
+   };
+
+   // A light source updated and drawn by the entity. Static lights never move while on the layer, so they are
+   // worked out and drawn into the baked light maps of the layer once rather than every frame. A static light that
+   // overlaps another static light is still drawn onto the shadow map on its own every frame.
+   struct LightComponent
+   {
+      Graphics::Light* pLight;
+      bool isStatic;
+      bool overlapsStaticLight;
+   };
+
+   // A shape that blocks light and casts shadows. Static shapes never move while on the layer, so they can be merged
+   // with their neighbors before being handed to the lights.
+   struct ColliderComponent
+   {
+      Objects::Object* pObject;
+      bool isStatic;
+   };
+
+   // The draw order of a drawable entity within its layer. Lower keys are drawn first.
+   struct SortKeyComponent
+   {
+      float sortKey;
+   };
+}}
+
+#endif // Components_H
@@ -0,0 +1,98 @@
+//*********************************************************************************************************************
+//
+// File: Entity.h
+//
+// Description:
+//    This file defines the entity handle. An entity has no data of its own and is only the link between its
+//    components. The handle packs the slot index of the entity with a generation that is bumped each time the slot is
+//    reused, so a handle kept after its entity was destroyed is detected instead of silently referring to a new
+//    entity.
+//
+//*********************************************************************************************************************
+
+#ifndef Entity_H
+#define Entity_H
+
+namespace Bebop { namespace Entities
+{
+   // Handle for an entity. The low bits are the slot index and the high bits are the generation of the slot.
+   typedef unsigned int Entity;
+
+   // The number of low bits of a handle used for the slot index.
+   const unsigned int ENTITY_INDEX_BITS = 20;
+
+   // Mask for the slot index of a handle.
+   const unsigned int ENTITY_INDEX_MASK = (1U << ENTITY_INDEX_BITS) - 1U;
+
+   // Mask for the generation of a handle once shifted down.
+   const unsigned int ENTITY_GENERATION_MASK = (1U << (32U - ENTITY_INDEX_BITS)) - 1U;
+
+   // Handle that never refers to an entity. Its slot index is never given out.
+   const Entity INVALID_ENTITY = 0xFFFFFFFFU;
+
+   // The most entities that can be alive at once.
+   const unsigned int MAXIMUM_ENTITIES = ENTITY_INDEX_MASK;
+
+   // Marks a slot in a component array lookup that has no component.
+   const unsigned int INVALID_COMPONENT_SLOT = 0xFFFFFFFFU;
+
+   //******************************************************************************************************************
+   //
+   // Method Name: MakeEntity
+   //
+   // Description:
+   //    Packs a slot index and generation into an entity handle.
+   //
+   // Arguments:
+   //    aIndex      - The slot index of the entity.
+   //    aGeneration - The generation of the slot.
+   //
+   // Return:
+   //    Returns the entity handle.
+   //
+   //******************************************************************************************************************
+   inline Entity MakeEntity(const unsigned int aIndex, const unsigned int aGeneration)
+   {
+      return ((aGeneration & ENTITY_GENERATION_MASK) << ENTITY_INDEX_BITS) | (aIndex & ENTITY_INDEX_MASK);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: GetEntityIndex
+   //
+   // Description:
+   //    Returns the slot index of an entity handle.
+   //
+   // Arguments:
+   //    aEntity - The entity handle.
+   //
+   // Return:
+   //    Returns the slot index.
+   //
+   //******************************************************************************************************************
+   inline unsigned int GetEntityIndex(const Entity aEntity)
+   {
+      return aEntity & ENTITY_INDEX_MASK;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: GetEntityGeneration
+   //
+   // Description:
+   //    Returns the generation of an entity handle.
+   //
+   // Arguments:
+   //    aEntity - The entity handle.
+   //
+   // Return:
+   //    Returns the generation.
+   //
+   //******************************************************************************************************************
+   inline unsigned int GetEntityGeneration(const Entity aEntity)
+   {
+      return (aEntity >> ENTITY_INDEX_BITS) & ENTITY_GENERATION_MASK;
+   }
+}}
+
+#endif // Entity_H
@@ -0,0 +1,407 @@
+//*********************************************************************************************************************
+//
+// File: EntityManager.cpp
+//
+// Description:
+//    This class creates entities and owns the component arrays for every type of component. Destroying an entity
+//    removes all of its components. Entity slots are reused after an entity is destroyed, and the generation of the
+//    slot is bumped so handles to the destroyed entity are no longer alive.
+//
+//*********************************************************************************************************************
+
+#include "EntityManager.h"
+
+namespace Bebop { namespace Entities
+{
+//*********************************************************************************************************************
+// Public Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: EntityManager
+   //
+   // Description:
+   //    Constructor for the entity manager that sets member variables to their default values.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   EntityManager::EntityManager()
+   {
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: ~EntityManager
+   //
+   // Description:
+   //    Destructor for the entity manager. The items referred to by the components are not owned by the manager and
+   //    are not freed.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   EntityManager::~EntityManager()
+   {
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: CreateEntity
+   //
+   // Description:
+   //    Creates a new entity with no components. The slot of a destroyed entity is reused when one is free.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the new entity, or INVALID_ENTITY if the most entities are already alive.
+   //
+   //******************************************************************************************************************
+   Entity EntityManager::CreateEntity()
+   {
+      unsigned int index = 0;
+
+      if (mFreeIndices.empty() == false)
+      {
+         index = mFreeIndices.back();
+         mFreeIndices.pop_back();
+      }
+      else
+      {
+         if (mGenerations.size() >= MAXIMUM_ENTITIES)
+         {
+            return INVALID_ENTITY;
+         }
+
+         index = static_cast<unsigned int>(mGenerations.size());
+         mGenerations.push_back(0);
+      }
+
+      return MakeEntity(index, mGenerations[index]);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: DestroyEntity
+   //
+   // Description:
+   //    Removes every component of an entity and frees its slot for reuse.
+   //
+   // Arguments:
+   //    aEntity - The entity being destroyed.
+   //
+   // Return:
+   //    True  - The entity was destroyed.
+   //    False - The entity was not alive.
+   //
+   //******************************************************************************************************************
+   bool EntityManager::DestroyEntity(const Entity aEntity)
+   {
+      if (IsAlive(aEntity) == false)
+      {
+         return false;
+      }
+
+      mTransforms.RemoveComponent(aEntity);
+      mSprites.RemoveComponent(aEntity);
+      mAnimationStates.RemoveComponent(aEntity);
+      mClockAnimations.RemoveComponent(aEntity);
+      mSpriteAdapters.RemoveComponent(aEntity);
+      mAnimatedSpriteAdapters.RemoveComponent(aEntity);
+      mClockAnimatedSpriteAdapters.RemoveComponent(aEntity);
+      mParticles.RemoveComponent(aEntity);
+      mLights.RemoveComponent(aEntity);
+      mColliders.RemoveComponent(aEntity);
+      mSortKeys.RemoveComponent(aEntity);
+
+      // Bump the generation so handles to this entity no longer match the slot.
+      unsigned int index = GetEntityIndex(aEntity);
+      mGenerations[index] = (mGenerations[index] + 1) & ENTITY_GENERATION_MASK;
+      mFreeIndices.push_back(index);
+      return true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: IsAlive
+   //
+   // Description:
+   //    Checks if an entity handle refers to an entity that has not been destroyed.
+   //
+   // Arguments:
+   //    aEntity - The entity being checked.
+   //
+   // Return:
+   //    True  - The entity is alive.
+   //    False - The entity was destroyed or was never created.
+   //
+   //******************************************************************************************************************
+   bool EntityManager::IsAlive(const Entity aEntity) const
+   {
+      unsigned int index = GetEntityIndex(aEntity);
+      return index < mGenerations.size() && mGenerations[index] == GetEntityGeneration(aEntity);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetEntityCount
+   //
+   // Description:
+   //    Returns the number of entities that are alive.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the number of alive entities.
+   //
+   //******************************************************************************************************************
+   unsigned int EntityManager::GetEntityCount() const
+   {
+      return static_cast<unsigned int>(mGenerations.size() - mFreeIndices.size());
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetTransforms
+   //
+   // Description:
+   //    Returns the transform components of the sprite instances.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the array of transform components.
+   //
+   //******************************************************************************************************************
+   ComponentArray<TransformComponent>& EntityManager::GetTransforms()
+   {
+      return mTransforms;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetSprites
+   //
+   // Description:
+   //    Returns the sprite components of the sprite instances.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the array of sprite components.
+   //
+   //******************************************************************************************************************
+   ComponentArray<SpriteComponent>& EntityManager::GetSprites()
+   {
+      return mSprites;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetAnimationStates
+   //
+   // Description:
+   //    Returns the animation state components of the animated sprite instances.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the array of animation state components.
+   //
+   //******************************************************************************************************************
+   ComponentArray<AnimationStateComponent>& EntityManager::GetAnimationStates()
+   {
+      return mAnimationStates;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetClockAnimations
+   //
+   // Description:
+   //    Returns the clock animation components of the animated sprite instances played from the clock.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the array of clock animation components.
+   //
+   //******************************************************************************************************************
+   ComponentArray<ClockAnimationComponent>& EntityManager::GetClockAnimations()
+   {
+      return mClockAnimations;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetSpriteAdapters
+   //
+   // Description:
+   //    Returns the components of the sprites added by pointer.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the array of sprite adapter components.
+   //
+   //******************************************************************************************************************
+   ComponentArray<SpriteAdapterComponent>& EntityManager::GetSpriteAdapters()
+   {
+      return mSpriteAdapters;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetAnimatedSpriteAdapters
+   //
+   // Description:
+   //    Returns the components of the animated sprites added by pointer.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the array of animated sprite adapter components.
+   //
+   //******************************************************************************************************************
+   ComponentArray<AnimatedSpriteAdapterComponent>& EntityManager::GetAnimatedSpriteAdapters()
+   {
+      return mAnimatedSpriteAdapters;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetClockAnimatedSpriteAdapters
+   //
+   // Description:
+   //    Returns the components of the animated sprites added by pointer that play from the clock.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the array of animated sprite adapter components.
+   //
+   //******************************************************************************************************************
+   ComponentArray<AnimatedSpriteAdapterComponent>& EntityManager::GetClockAnimatedSpriteAdapters()
+   {
+      return mClockAnimatedSpriteAdapters;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetParticles
+   //
+   // Description:
+   //    Returns the particle components.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the array of particle components.
+   //
+   //******************************************************************************************************************
+   ComponentArray<ParticleComponent>& EntityManager::GetParticles()
+   {
+      return mParticles;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetLights
+   //
+   // Description:
+   //    Returns the light components.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the array of light components.
+   //
+   //******************************************************************************************************************
+   ComponentArray<LightComponent>& EntityManager::GetLights()
+   {
+      return mLights;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetColliders
+   //
+   // Description:
+   //    Returns the collider components.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the array of collider components.
+   //
+   //******************************************************************************************************************
+   ComponentArray<ColliderComponent>& EntityManager::GetColliders()
+   {
+      return mColliders;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetSortKeys
+   //
+   // Description:
+   //    Returns the sort key components.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the array of sort key components.
+   //
+   //******************************************************************************************************************
+   ComponentArray<SortKeyComponent>& EntityManager::GetSortKeys()
+   {
+      return mSortKeys;
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no private methods for this class.
+
+//*********************************************************************************************************************
+// Private Methods - End
+//*********************************************************************************************************************
+}}
@@ -0,0 +1,354 @@
+//*********************************************************************************************************************
+//
+// File: EntityManager.h
+//
+// Description:
+//    This class creates entities and owns the component arrays for every type of component. Destroying an entity
+//    removes all of its components. Entity slots are reused after an entity is destroyed, and the generation of the
+//    slot is bumped so handles to the destroyed entity are no longer alive.
+//
+//*********************************************************************************************************************
+
+#ifndef EntityManager_H
+#define EntityManager_H
+
+#include "ComponentArray.h"
+#include "Components.h"
+
+namespace Bebop { namespace Entities
+{
+   class EntityManager
+   {
+      //***************************************************************************************************************
+      // Methods - Start
+      //***************************************************************************************************************
+
+      public:
+
+         //************************************************************************************************************
+         //
+         // Method: EntityManager
+         //
+         // Description:
+         //    Constructor for the entity manager that sets member variables to their default values.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         EntityManager();
+
+         //************************************************************************************************************
+         //
+         // Method: ~EntityManager
+         //
+         // Description:
+         //    Destructor for the entity manager. The items referred to by the components are not owned by the
+         //    manager and are not freed.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         ~EntityManager();
+
+         //************************************************************************************************************
+         //
+         // Method: CreateEntity
+         //
+         // Description:
+         //    Creates a new entity with no components. The slot of a destroyed entity is reused when one is free.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the new entity, or INVALID_ENTITY if the most entities are already alive.
+         //
+         //************************************************************************************************************
+         Entity CreateEntity();
+
+         //************************************************************************************************************
+         //
+         // Method: DestroyEntity
+         //
+         // Description:
+         //    Removes every component of an entity and frees its slot for reuse.
+         //
+         // Arguments:
+         //    aEntity - The entity being destroyed.
+         //
+         // Return:
+         //    True  - The entity was destroyed.
+         //    False - The entity was not alive.
+         //
+         //************************************************************************************************************
+         bool DestroyEntity(const Entity aEntity);
+
+         //************************************************************************************************************
+         //
+         // Method: IsAlive
+         //
+         // Description:
+         //    Checks if an entity handle refers to an entity that has not been destroyed.
+         //
+         // Arguments:
+         //    aEntity - The entity being checked.
+         //
+         // Return:
+         //    True  - The entity is alive.
+         //    False - The entity was destroyed or was never created.
+         //
+         //************************************************************************************************************
+         bool IsAlive(const Entity aEntity) const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetEntityCount
+         //
+         // Description:
+         //    Returns the number of entities that are alive.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the number of alive entities.
+         //
+         //************************************************************************************************************
+         unsigned int GetEntityCount() const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetTransforms
+         //
+         // Description:
+         //    Returns the transform components of the sprite instances.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the array of transform components.
+         //
+         //************************************************************************************************************
+         ComponentArray<TransformComponent>& GetTransforms();
+
+         //************************************************************************************************************
+         //
+         // Method: GetSprites
+         //
+         // Description:
+         //    Returns the sprite components of the sprite instances.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the array of sprite components.
+         //
+         //************************************************************************************************************
+         ComponentArray<SpriteComponent>& GetSprites();
+
+         //************************************************************************************************************
+         //
+         // Method: GetAnimationStates
+         //
+         // Description:
+         //    Returns the animation state components of the animated sprite instances.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the array of animation state components.
+         //
+         //************************************************************************************************************
+         ComponentArray<AnimationStateComponent>& GetAnimationStates();
+
+         //************************************************************************************************************
+         //
+         // Method: GetClockAnimations
+         //
+         // Description:
+         //    Returns the clock animation components of the animated sprite instances played from the clock.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the array of clock animation components.
+         //
+         //************************************************************************************************************
+         ComponentArray<ClockAnimationComponent>& GetClockAnimations();
+
+         //************************************************************************************************************
+         //
+         // Method: GetSpriteAdapters
+         //
+         // Description:
+         //    Returns the components of the sprites added by pointer.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the array of sprite adapter components.
+         //
+         //************************************************************************************************************
+         ComponentArray<SpriteAdapterComponent>& GetSpriteAdapters();
+
+         //************************************************************************************************************
+         //
+         // Method: GetAnimatedSpriteAdapters
+         //
+         // Description:
+         //    Returns the components of the animated sprites added by pointer.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the array of animated sprite adapter components.
+         //
+         //************************************************************************************************************
+         ComponentArray<AnimatedSpriteAdapterComponent>& GetAnimatedSpriteAdapters();
+
+         //************************************************************************************************************
+         //
+         // Method: GetClockAnimatedSpriteAdapters
+         //
+         // Description:
+         //    Returns the components of the animated sprites added by pointer that play from the clock.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the array of animated sprite adapter components.
+         //
+         //************************************************************************************************************
+         ComponentArray<AnimatedSpriteAdapterComponent>& GetClockAnimatedSpriteAdapters();
+
+         //************************************************************************************************************
+         //
+         // Method: GetParticles
+         //
+         // Description:
+         //    Returns the particle components.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the array of particle components.
+         //
+         //************************************************************************************************************
+         ComponentArray<ParticleComponent>& GetParticles();
+
+         //************************************************************************************************************
+         //
+         // Method: GetLights
+         //
+         // Description:
+         //    Returns the light components.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the array of light components.
+         //
+         //************************************************************************************************************
+         ComponentArray<LightComponent>& GetLights();
+
+         //************************************************************************************************************
+         //
+         // Method: GetColliders
+         //
+         // Description:
+         //    Returns the collider components.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the array of collider components.
+         //
+         //************************************************************************************************************
+         ComponentArray<ColliderComponent>& GetColliders();
+
+         //************************************************************************************************************
+         //
+         // Method: GetSortKeys
+         //
+         // Description:
+         //    Returns the sort key components.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the array of sort key components.
+         //
+         //************************************************************************************************************
+         ComponentArray<SortKeyComponent>& GetSortKeys();
+
+      protected:
+
+         // There are currently no protected methods for this class.
+
+      private:
+
+         // There are currently no private methods for this class.
+
+      //***************************************************************************************************************
+      // Methods - End
+      //***************************************************************************************************************
+
+      //***************************************************************************************************************
+      // Member Variables - Start
+      //***************************************************************************************************************
+
+      public:
+
+         // There are currently no public member variables for this class.
+
+      protected:
+
+         // There are currently no protected member variables for this class.
+
+      private:
+
+         // The current generation of each entity slot.
+         std::vector<unsigned int> mGenerations;
+
+         // The slots of destroyed entities that can be reused.
+         std::vector<unsigned int> mFreeIndices;
+
+         // The components for each type of component.
+         ComponentArray<TransformComponent> mTransforms;
+         ComponentArray<SpriteComponent> mSprites;
+         ComponentArray<AnimationStateComponent> mAnimationStates;
+         ComponentArray<ClockAnimationComponent> mClockAnimations;
+         ComponentArray<SpriteAdapterComponent> mSpriteAdapters;
+         ComponentArray<AnimatedSpriteAdapterComponent> mAnimatedSpriteAdapters;
+         ComponentArray<AnimatedSpriteAdapterComponent> mClockAnimatedSpriteAdapters;
+         ComponentArray<ParticleComponent> mParticles;
+         ComponentArray<LightComponent> mLights;
+         ComponentArray<ColliderComponent> mColliders;
+         ComponentArray<SortKeyComponent> mSortKeys;
+
+      //***************************************************************************************************************
+      // Member Variables - End
+      //***************************************************************************************************************
+   };
+}}
+
+#endif // EntityManager_H
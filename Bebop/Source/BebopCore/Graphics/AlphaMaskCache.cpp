@@ -0,0 +1,416 @@
+//*********************************************************************************************************************
+//
+// File: AlphaMaskCache.cpp
+//
+// Description:
+//    This class loads magenta keyed images through a disk cache. The first time an image is loaded, it is decoded,
+//    the magenta pixels are cleared, and the premultiplied RGBA pixels are written to a raw cache file named after a
+//    hash of the image file's contents. Later loads of an unchanged image read the raw pixels straight into the
+//    bitmap, skipping both decoding and the mask conversion. The raw file is a small header followed by tightly
+//    packed rows, so it can also be memory mapped as is.
+//
+//*********************************************************************************************************************
+
+#include "AlphaMaskCache.h"
+#include "GraphicsConstants.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <thread>
+
+namespace Bebop { namespace Graphics
+{
+   namespace
+   {
+      //***************************************************************************************************************
+      //
+      // Method Name: HashFileContents
+      //
+      // Description:
+      //    Hashes the contents of a file with 64-bit FNV-1a.
+      //
+      // Arguments:
+      //    aFilePath - The file location of the file being hashed.
+      //    apHash    - Updated with the hash of the file.
+      //
+      // Return:
+      //    True  - The file was hashed.
+      //    False - The file could not be read.
+      //
+      //***************************************************************************************************************
+      bool HashFileContents(const std::string& aFilePath, unsigned long long* apHash)
+      {
+         std::ifstream file(aFilePath.c_str(), std::ios::binary);
+         if (file.is_open() == false)
+         {
+            return false;
+         }
+
+         std::vector<char> contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+         unsigned long long hash = FNV_OFFSET_BASIS;
+         for (auto iterator = contents.begin(); iterator != contents.end(); ++iterator)
+         {
+            hash ^= static_cast<unsigned char>(*iterator);
+            hash *= FNV_PRIME;
+         }
+
+         *apHash = hash;
+         return true;
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: CreateBitmapFromPixels
+      //
+      // Description:
+      //    Creates a bitmap and copies premultiplied RGBA pixels into it.
+      //
+      // Arguments:
+      //    aWidth   - The width of the image.
+      //    aHeight  - The height of the image.
+      //    apPixels - The tightly packed rows of pixels.
+      //
+      // Return:
+      //    Returns the bitmap, or nullptr if it could not be created.
+      //
+      //***************************************************************************************************************
+      ALLEGRO_BITMAP* CreateBitmapFromPixels(const int aWidth, const int aHeight, const unsigned char* apPixels)
+      {
+         ALLEGRO_BITMAP* pBitmap = al_create_bitmap(aWidth, aHeight);
+         if (pBitmap == nullptr)
+         {
+            return nullptr;
+         }
+
+         ALLEGRO_LOCKED_REGION* pRegion = al_lock_bitmap(pBitmap, ALLEGRO_PIXEL_FORMAT_ABGR_8888_LE,
+                                                         ALLEGRO_LOCK_WRITEONLY);
+         if (pRegion == nullptr)
+         {
+            al_destroy_bitmap(pBitmap);
+            return nullptr;
+         }
+
+         unsigned int rowSize = static_cast<unsigned int>(aWidth) * ALPHA_MASK_CACHE_PIXEL_SIZE;
+         for (int y = 0; y < aHeight; ++y)
+         {
+            std::memcpy(static_cast<unsigned char*>(pRegion->data) + (y * pRegion->pitch),
+                        apPixels + (y * rowSize),
+                        rowSize);
+         }
+
+         al_unlock_bitmap(pBitmap);
+         return pBitmap;
+      }
+   }
+
+//*********************************************************************************************************************
+// Public Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: AlphaMaskCache
+   //
+   // Description:
+   //    Constructor for a cache that keeps its raw files in the passed in directory. The directory is created if it
+   //    does not exist yet.
+   //
+   // Arguments:
+   //    aCacheDirectory - The directory the raw cache files are kept in.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   AlphaMaskCache::AlphaMaskCache(const std::string aCacheDirectory) :
+      mCacheDirectory(aCacheDirectory)
+   {
+      // If the directory cannot be made, writing the cache files fails and every image is decoded and converted.
+      al_make_directory(mCacheDirectory.c_str());
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: ~AlphaMaskCache
+   //
+   // Description:
+   //    Destructor for the alpha mask cache.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   AlphaMaskCache::~AlphaMaskCache()
+   {
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: LoadMaskedBitmap
+   //
+   // Description:
+   //    Loads an image with its magenta pixels turned transparent, the same result as loading the image and
+   //    converting the mask to alpha. The raw cache file is used when one exists for the image's contents, and is
+   //    written otherwise. Safe to call from several threads at once. The bitmap is created with the calling thread's
+   //    new bitmap flags.
+   //
+   // Arguments:
+   //    aFilePath - The file location of the image.
+   //
+   // Return:
+   //    Returns the bitmap, or nullptr if the image could not be read.
+   //
+   //******************************************************************************************************************
+   ALLEGRO_BITMAP* AlphaMaskCache::LoadMaskedBitmap(const std::string aFilePath) const
+   {
+      unsigned long long hash = 0;
+      if (HashFileContents(aFilePath, &hash) == false)
+      {
+         return nullptr;
+      }
+
+      std::ostringstream cachePath;
+      cachePath << mCacheDirectory << "/" << std::hex << hash << ".raw";
+
+      ALLEGRO_BITMAP* pBitmap = ReadCacheFile(cachePath.str());
+      if (pBitmap != nullptr)
+      {
+         return pBitmap;
+      }
+
+      // Not cached yet, so do the slow conversion once and keep the result for next time.
+      AlphaMaskCacheHeader header;
+      std::vector<unsigned char> pixels;
+      if (ConvertImage(aFilePath, &header, &pixels) == false)
+      {
+         return nullptr;
+      }
+
+      WriteCacheFile(cachePath.str(), header, pixels);
+      return CreateBitmapFromPixels(header.width, header.height, pixels.data());
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: ConvertImage
+   //
+   // Description:
+   //    Decodes an image and returns its pixels with the magenta pixels cleared. Loaded pixels are already
+   //    premultiplied, which leaves opaque magenta unchanged, so the mask is matched on the premultiplied values.
+   //
+   // Arguments:
+   //    aFilePath - The file location of the image.
+   //    apHeader  - Updated with the size of the image.
+   //    apPixels  - Updated with the premultiplied RGBA pixels of the image.
+   //
+   // Return:
+   //    True  - The image was decoded.
+   //    False - The image could not be decoded.
+   //
+   //******************************************************************************************************************
+   bool AlphaMaskCache::ConvertImage(const std::string& aFilePath, AlphaMaskCacheHeader* apHeader,
+                                     std::vector<unsigned char>* apPixels) const
+   {
+      // Decode into memory since the pixels are only read back.
+      int bitmapFlags = al_get_new_bitmap_flags();
+      al_set_new_bitmap_flags(ALLEGRO_MEMORY_BITMAP);
+      ALLEGRO_BITMAP* pImage = al_load_bitmap(aFilePath.c_str());
+      al_set_new_bitmap_flags(bitmapFlags);
+
+      if (pImage == nullptr)
+      {
+         return false;
+      }
+
+      ALLEGRO_LOCKED_REGION* pRegion = al_lock_bitmap(pImage, ALLEGRO_PIXEL_FORMAT_ABGR_8888_LE,
+                                                      ALLEGRO_LOCK_READONLY);
+      if (pRegion == nullptr)
+      {
+         al_destroy_bitmap(pImage);
+         return false;
+      }
+
+      apHeader->magic = ALPHA_MASK_CACHE_MAGIC;
+      apHeader->version = ALPHA_MASK_CACHE_VERSION;
+      apHeader->width = al_get_bitmap_width(pImage);
+      apHeader->height = al_get_bitmap_height(pImage);
+
+      unsigned int rowSize = apHeader->width * ALPHA_MASK_CACHE_PIXEL_SIZE;
+      apPixels->resize(rowSize * apHeader->height);
+
+      for (unsigned int y = 0; y < apHeader->height; ++y)
+      {
+         const unsigned char* pSource = static_cast<const unsigned char*>(pRegion->data) +
+                                        (static_cast<int>(y) * pRegion->pitch);
+         unsigned char* pDestination = apPixels->data() + (y * rowSize);
+         std::memcpy(pDestination, pSource, rowSize);
+
+         for (unsigned int x = 0; x < rowSize; x += ALPHA_MASK_CACHE_PIXEL_SIZE)
+         {
+            if (pDestination[x] == MAX_COLOR_VALUE && pDestination[x + 1] == NO_COLOR &&
+                pDestination[x + 2] == MAX_COLOR_VALUE && pDestination[x + 3] == MAX_COLOR_VALUE)
+            {
+               std::memset(pDestination + x, NO_COLOR, ALPHA_MASK_CACHE_PIXEL_SIZE);
+            }
+         }
+      }
+
+      al_unlock_bitmap(pImage);
+      al_destroy_bitmap(pImage);
+      return true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: ReadCacheFile
+   //
+   // Description:
+   //    Reads a raw cache file straight into a new bitmap.
+   //
+   // Arguments:
+   //    aCachePath - The file location of the raw cache file.
+   //
+   // Return:
+   //    Returns the bitmap, or nullptr if there is no valid cache file. A file whose size does not match the width and
+   //    height in its header is not valid.
+   //
+   //******************************************************************************************************************
+   ALLEGRO_BITMAP* AlphaMaskCache::ReadCacheFile(const std::string& aCachePath) const
+   {
+      std::ifstream file(aCachePath.c_str(), std::ios::binary);
+      if (file.is_open() == false)
+      {
+         return nullptr;
+      }
+
+      file.seekg(0, std::ios::end);
+      unsigned long long fileSize = static_cast<unsigned long long>(file.tellg());
+      file.seekg(0, std::ios::beg);
+
+      AlphaMaskCacheHeader header;
+      if (file.read(reinterpret_cast<char*>(&header), sizeof(header)).fail() == true ||
+          header.magic != ALPHA_MASK_CACHE_MAGIC || header.version != ALPHA_MASK_CACHE_VERSION)
+      {
+         return nullptr;
+      }
+
+      // A damaged or cut off file could ask for a huge bitmap, so the size is checked against the pixels it holds.
+      unsigned long long pixelSize = static_cast<unsigned long long>(header.width) * header.height *
+                                     ALPHA_MASK_CACHE_PIXEL_SIZE;
+      if (header.width == 0 || header.height == 0 || fileSize != sizeof(header) + pixelSize)
+      {
+         return nullptr;
+      }
+
+      ALLEGRO_BITMAP* pBitmap = al_create_bitmap(header.width, header.height);
+      if (pBitmap == nullptr)
+      {
+         return nullptr;
+      }
+
+      ALLEGRO_LOCKED_REGION* pRegion = al_lock_bitmap(pBitmap, ALLEGRO_PIXEL_FORMAT_ABGR_8888_LE,
+                                                      ALLEGRO_LOCK_WRITEONLY);
+      if (pRegion == nullptr)
+      {
+         al_destroy_bitmap(pBitmap);
+         return nullptr;
+      }
+
+      // Read each row straight into the locked bitmap.
+      unsigned int rowSize = header.width * ALPHA_MASK_CACHE_PIXEL_SIZE;
+      bool result = true;
+      for (unsigned int y = 0; y < header.height && result == true; ++y)
+      {
+         char* pRow = static_cast<char*>(pRegion->data) + (static_cast<int>(y) * pRegion->pitch);
+         result = file.read(pRow, rowSize).fail() == false;
+      }
+
+      al_unlock_bitmap(pBitmap);
+      if (result == false)
+      {
+         al_destroy_bitmap(pBitmap);
+         return nullptr;
+      }
+
+      return pBitmap;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: WriteCacheFile
+   //
+   // Description:
+   //    Writes a raw cache file. The file is written under a temporary name and renamed when complete, so a reader
+   //    never sees a partly written file.
+   //
+   // Arguments:
+   //    aCachePath - The file location of the raw cache file.
+   //    aHeader    - The header of the image.
+   //    aPixels    - The premultiplied RGBA pixels of the image.
+   //
+   // Return:
+   //    True  - The cache file was written.
+   //    False - The cache file could not be written.
+   //
+   //******************************************************************************************************************
+   bool AlphaMaskCache::WriteCacheFile(const std::string& aCachePath, const AlphaMaskCacheHeader& aHeader,
+                                       const std::vector<unsigned char>& aPixels) const
+   {
+      // Threads converting images with the same contents each write their own temporary file.
+      std::ostringstream temporaryPath;
+      temporaryPath << aCachePath << "." << std::this_thread::get_id() << ".tmp";
+
+      {
+         std::ofstream file(temporaryPath.str().c_str(), std::ios::binary);
+         if (file.is_open() == false)
+         {
+            return false;
+         }
+
+         file.write(reinterpret_cast<const char*>(&aHeader), sizeof(aHeader));
+         file.write(reinterpret_cast<const char*>(aPixels.data()), aPixels.size());
+         if (file.good() == false)
+         {
+            file.close();
+            std::remove(temporaryPath.str().c_str());
+            return false;
+         }
+      }
+
+      // Renaming fails on some systems when another thread already wrote the same file, which is just as good.
+      if (std::rename(temporaryPath.str().c_str(), aCachePath.c_str()) != 0)
+      {
+         std::remove(temporaryPath.str().c_str());
+      }
+
+      return true;
+   }
+
+//*********************************************************************************************************************
+// Private Methods - End
+//*********************************************************************************************************************
+}}
@@ -0,0 +1,183 @@
+//*********************************************************************************************************************
+//
+// File: AlphaMaskCache.h
+//
+// Description:
+//    This class loads magenta keyed images through a disk cache. The first time an image is loaded, it is decoded,
+//    the magenta pixels are cleared, and the premultiplied RGBA pixels are written to a raw cache file named after a
+//    hash of the image file's contents. Later loads of an unchanged image read the raw pixels straight into the
+//    bitmap, skipping both decoding and the mask conversion. The raw file is a small header followed by tightly
+//    packed rows, so it can also be memory mapped as is.
+//
+//*********************************************************************************************************************
+
+#ifndef AlphaMaskCache_H
+#define AlphaMaskCache_H
+
+#include <allegro5/allegro.h>
+#include <string>
+#include <vector>
+
+namespace Bebop { namespace Graphics
+{
+   // The header at the start of a raw cache file. The pixels follow as 4 bytes each in R, G, B, A order.
+   struct AlphaMaskCacheHeader
+   {
+      unsigned int magic;
+      unsigned int version;
+      unsigned int width;
+      unsigned int height;
+   };
+
+   class AlphaMaskCache
+   {
+      //***************************************************************************************************************
+      // Methods - Start
+      //***************************************************************************************************************
+
+      public:
+
+         //************************************************************************************************************
+         //
+         // Method: AlphaMaskCache
+         //
+         // Description:
+         //    Constructor for a cache that keeps its raw files in the passed in directory. The directory is created
+         //    if it does not exist yet.
+         //
+         // Arguments:
+         //    aCacheDirectory - The directory the raw cache files are kept in.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         AlphaMaskCache(const std::string aCacheDirectory);
+
+         //************************************************************************************************************
+         //
+         // Method: ~AlphaMaskCache
+         //
+         // Description:
+         //    Destructor for the alpha mask cache.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         ~AlphaMaskCache();
+
+         //************************************************************************************************************
+         //
+         // Method: LoadMaskedBitmap
+         //
+         // Description:
+         //    Loads an image with its magenta pixels turned transparent, the same result as loading the image and
+         //    converting the mask to alpha. The raw cache file is used when one exists for the image's contents,
+         //    and is written otherwise. Safe to call from several threads at once. The bitmap is created with the
+         //    calling thread's new bitmap flags.
+         //
+         // Arguments:
+         //    aFilePath - The file location of the image.
+         //
+         // Return:
+         //    Returns the bitmap, or nullptr if the image could not be read.
+         //
+         //************************************************************************************************************
+         ALLEGRO_BITMAP* LoadMaskedBitmap(const std::string aFilePath) const;
+
+      protected:
+
+         // There are currently no protected methods for this class.
+
+      private:
+
+         //************************************************************************************************************
+         //
+         // Method: ConvertImage
+         //
+         // Description:
+         //    Decodes an image and returns its pixels with the magenta pixels cleared.
+         //
+         // Arguments:
+         //    aFilePath - The file location of the image.
+         //    apHeader  - Updated with the size of the image.
+         //    apPixels  - Updated with the premultiplied RGBA pixels of the image.
+         //
+         // Return:
+         //    True  - The image was decoded.
+         //    False - The image could not be decoded.
+         //
+         //************************************************************************************************************
+         bool ConvertImage(const std::string& aFilePath, AlphaMaskCacheHeader* apHeader,
+                           std::vector<unsigned char>* apPixels) const;
+
+         //************************************************************************************************************
+         //
+         // Method: ReadCacheFile
+         //
+         // Description:
+         //    Reads a raw cache file straight into a new bitmap.
+         //
+         // Arguments:
+         //    aCachePath - The file location of the raw cache file.
+         //
+         // Return:
+         //    Returns the bitmap, or nullptr if there is no valid cache file. A file whose size does not match the
+         //    width and height in its header is not valid.
+         //
+         //************************************************************************************************************
+         ALLEGRO_BITMAP* ReadCacheFile(const std::string& aCachePath) const;
+
+         //************************************************************************************************************
+         //
+         // Method: WriteCacheFile
+         //
+         // Description:
+         //    Writes a raw cache file. The file is written under a temporary name and renamed when complete, so a
+         //    reader never sees a partly written file.
+         //
+         // Arguments:
+         //    aCachePath - The file location of the raw cache file.
+         //    aHeader    - The header of the image.
+         //    aPixels    - The premultiplied RGBA pixels of the image.
+         //
+         // Return:
+         //    True  - The cache file was written.
+         //    False - The cache file could not be written.
+         //
+         //************************************************************************************************************
+         bool WriteCacheFile(const std::string& aCachePath, const AlphaMaskCacheHeader& aHeader,
+                             const std::vector<unsigned char>& aPixels) const;
+
+      //***************************************************************************************************************
+      // Methods - End
+      //***************************************************************************************************************
+
+      //***************************************************************************************************************
+      // Member Variables - Start
+      //***************************************************************************************************************
+
+      public:
+
+         // There are currently no public member variables for this class.
+
+      protected:
+
+         // There are currently no protected member variables for this class.
+
+      private:
+
+         // The directory the raw cache files are kept in.
+         std::string mCacheDirectory;
+
+      //***************************************************************************************************************
+      // Member Variables - End
+      //***************************************************************************************************************
+   };
+}}
+
+#endif // AlphaMaskCache_H
@@ -3,7 +3,8 @@
 // File: AnimatedSprite.cpp
 //
 // Description:
-//    This class handles creating and drawing of animated sprite images.
+//    This class handles creating and drawing of animated sprite images. The frames come from an animation clip,
+//    which can be shared by any number of sprites.
 //
 //*********************************************************************************************************************
 
@@ -31,7 +32,7 @@ namespace Bebop { namespace Graphics
    //    aPositionX    - The X-Coordinate to draw the sprite.
    //    aPositionY    - The Y-Coordinate to draw the sprite.
    //    aFps          - The number of frames that occur in a second.
-   //    aNumberFrames - The number of frames in the animation.
+   //    aNumberFrames - The number of frames in the looping animation, laid out left to right from the source.
    //    aRotation     - The angle in radians for the rotation of the sprite.
    //
    // Return:
@@ -42,8 +43,83 @@ namespace Bebop { namespace Graphics
                                   const int aHeight, const Math::Vector2D<float> aPosition, const float aFps,
                                   const int aNumberFrames, const float aRotation) :
       Sprite(aFilePath, aSource, aWidth, aHeight, aPosition, aRotation),
-      mFrameTime(1.0F /aFps), mNumberFrames(aNumberFrames), mCurrentFrame(0), mElapsedTime(0.0F)
+      mpClip(nullptr), mClipTime(0.0F), mStartTime(0.0), mClockDriven(false), mCurrentFrame(0),
+      mSourceOffset(mSource - aSource)
    {
+      mpStripClip.reset(new AnimationClip(ANIMATION_LOOP, aFps));
+      mpStripClip->AddFrameGrid(aSource, aWidth, aHeight, aNumberFrames, aNumberFrames);
+      mpClip = mpStripClip.get();
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: AnimatedSprite
+   //
+   // Description:
+   //    Constructor for an animated sprite whose sprite(sheet) is loaded in the background. A placeholder is drawn
+   //    until the sprite(sheet) is ready, and the animation runs in the meantime.
+   //
+   // Arguments:
+   //    aLoader       - The loader that loads the sprite(sheet).
+   //    aFilePath     - The file path where the sprite(sheet) is located.
+   //    aSource       - The X-Coordinate and Y-Coordinate where the sprite image on the bitmap is located.
+   //    aWidth        - The width of the sprite image.
+   //    aHeight       - The height of the sprite image.
+   //    aPosition     - The X-Coordinate and Y-Coordinate to draw the sprite.
+   //    aFps          - The number of frames that occur in a second.
+   //    aNumberFrames - The number of frames in the looping animation, laid out left to right from the source.
+   //    aRotation     - The angle in radians for the rotation of the sprite.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   AnimatedSprite::AnimatedSprite(AssetLoader& aLoader, const std::string aFilePath,
+                                  const Math::Vector2D<int> aSource, const int aWidth, const int aHeight,
+                                  const Math::Vector2D<float> aPosition, const float aFps, const int aNumberFrames,
+                                  const float aRotation) :
+      Sprite(aLoader, aFilePath, aSource, aWidth, aHeight, aPosition, aRotation),
+      mpClip(nullptr), mClipTime(0.0F), mStartTime(0.0), mClockDriven(false), mCurrentFrame(0),
+      mSourceOffset(mSource - aSource)
+   {
+      mpStripClip.reset(new AnimationClip(ANIMATION_LOOP, aFps));
+      mpStripClip->AddFrameGrid(aSource, aWidth, aHeight, aNumberFrames, aNumberFrames);
+      mpClip = mpStripClip.get();
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: AnimatedSprite
+   //
+   // Description:
+   //    Constructor for an animated sprite whose frames are drawn from an image packed into a texture atlas.
+   //
+   // Arguments:
+   //    aAtlas        - The atlas holding the image. It must outlive the sprite.
+   //    aFilePath     - The file path the sprite(sheet) was added to the atlas with.
+   //    aSource       - The X-Coordinate and Y-Coordinate of the first frame on the original image.
+   //    aWidth        - The width of the sprite image.
+   //    aHeight       - The height of the sprite image.
+   //    aPosition     - The X-Coordinate and Y-Coordinate to draw the sprite.
+   //    aFps          - The number of frames that occur in a second.
+   //    aNumberFrames - The number of frames in the looping animation, laid out left to right from the source.
+   //    aRotation     - The angle in radians for the rotation of the sprite.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   AnimatedSprite::AnimatedSprite(const TextureAtlas& aAtlas, const std::string aFilePath,
+                                  const Math::Vector2D<int> aSource, const int aWidth, const int aHeight,
+                                  const Math::Vector2D<float> aPosition, const float aFps, const int aNumberFrames,
+                                  const float aRotation) :
+      Sprite(aAtlas, aFilePath, aSource, aWidth, aHeight, aPosition, aRotation),
+      mpClip(nullptr), mClipTime(0.0F), mStartTime(0.0), mClockDriven(false), mCurrentFrame(0),
+      mSourceOffset(mSource - aSource)
+   {
+      mpStripClip.reset(new AnimationClip(ANIMATION_LOOP, aFps));
+      mpStripClip->AddFrameGrid(aSource, aWidth, aHeight, aNumberFrames, aNumberFrames);
+      mpClip = mpStripClip.get();
    }
    
    //******************************************************************************************************************
@@ -62,30 +138,141 @@ namespace Bebop { namespace Graphics
    //******************************************************************************************************************
    void AnimatedSprite::Update(const float aElapsedTime)
    {
-      // Increase the elapsed time by the amount of time since the last update.
-      mElapsedTime += aElapsedTime;
-   
-      // Check if elapsed time exceeds the frame time.
-      if (mElapsedTime > mFrameTime)
+      if (mClockDriven == true || mpClip->GetFrameCount() == 0)
       {
-         // Update the next frame and reset the elapsed time.
-         mCurrentFrame++;
-         mElapsedTime = 0;
-   
-         // If the next frame is still within the bounds of the number of frames then increase the X-Coordinate of the
-         // sprite(sheet) by the sprite width.
-         if (mCurrentFrame < mNumberFrames)
-         {
-            mSource.SetComponentX(mSource.GetComponentX() + mWidth);
-         }
-         // The next frame is past the bounds of the number of frames. Reset the X-coordinate and current frame to the
-         // first frame of the animation.
-         else
+         return;
+      }
+
+      // The leftover time past a frame is kept, so any number of frames can pass in one update without drifting.
+      mClipTime = mpClip->AdvanceTime(mClipTime, aElapsedTime);
+
+      unsigned int frameIndex = mpClip->GetFrameIndex(mClipTime);
+      if (frameIndex != mCurrentFrame)
+      {
+         ShowFrame(frameIndex);
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: Play
+   //
+   // Description:
+   //    Starts playing a clip from its first frame. The clip is held by reference, so many sprites can play the same
+   //    clip.
+   //
+   // Arguments:
+   //    aClip - The clip to play. It must outlive the sprite or the next call to play.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void AnimatedSprite::Play(const AnimationClip& aClip)
+   {
+      mpClip = &aClip;
+      mpStripClip.reset();
+      mClipTime = 0.0F;
+      mClockDriven = false;
+
+      if (mpClip->GetFrameCount() > 0)
+      {
+         ShowFrame(0);
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: IsFinished
+   //
+   // Description:
+   //    Checks if a clip played once has shown its last frame for its full time.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    True  - The clip is played once and has finished.
+   //    False - The clip is still playing or repeats.
+   //
+   //******************************************************************************************************************
+   bool AnimatedSprite::IsFinished() const
+   {
+      return mpClip->IsFinished(mClipTime);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: PlayFromClock
+   //
+   // Description:
+   //    Plays a clip in step with the clock of the scene layer the sprite is on. The sprite only keeps the clip and the
+   //    start time, updates skip it, and the frame is worked out from the clock when it is drawn. Sprites started at
+   //    the same time play in lockstep, and a later start time gives a fixed phase offset.
+   //
+   // Arguments:
+   //    aClip      - The clip to play. It must outlive the sprite or the next call to play.
+   //    aStartTime - The clock time in seconds the clip starts at.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void AnimatedSprite::PlayFromClock(const AnimationClip& aClip, const double aStartTime)
+   {
+      Play(aClip);
+      mStartTime = aStartTime;
+      mClockDriven = true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: IsClockDriven
+   //
+   // Description:
+   //    Checks if the sprite plays its clip from the clock rather than its own timer.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    True  - The clip is played from the clock.
+   //    False - The clip is played by updating the sprite.
+   //
+   //******************************************************************************************************************
+   bool AnimatedSprite::IsClockDriven() const
+   {
+      return mClockDriven;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: DrawAtTime
+   //
+   // Description:
+   //    Draws the sprite, first moving a clock driven sprite to the frame shown at the passed in clock time.
+   //
+   // Arguments:
+   //    aClockTime - The clock time in seconds.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void AnimatedSprite::DrawAtTime(const double aClockTime)
+   {
+      if (mClockDriven == true && mpClip->GetFrameCount() > 0)
+      {
+         mClipTime = mpClip->GetPlaybackTime(aClockTime - mStartTime);
+
+         unsigned int frameIndex = mpClip->GetFrameIndex(mClipTime);
+         if (frameIndex != mCurrentFrame)
          {
-            mSource.SetComponentX(0);
-            mCurrentFrame = 0;
+            ShowFrame(frameIndex);
          }
       }
+
+      Draw();
    }
 
 //*********************************************************************************************************************
@@ -106,7 +293,28 @@ namespace Bebop { namespace Graphics
 // Private Methods - Start
 //*********************************************************************************************************************
 
-   // There are currently no private methods for this class.
+   //******************************************************************************************************************
+   //
+   // Method Name: ShowFrame
+   //
+   // Description:
+   //    Points the sprite at a frame of the clip being played.
+   //
+   // Arguments:
+   //    aFrameIndex - The index of the frame in the clip.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void AnimatedSprite::ShowFrame(const unsigned int aFrameIndex)
+   {
+      const AnimationFrame& frame = mpClip->GetFrame(aFrameIndex);
+      mSource = mSourceOffset + Math::Vector2D<int>(frame.x, frame.y);
+      mWidth = frame.width;
+      mHeight = frame.height;
+      mCurrentFrame = aFrameIndex;
+   }
 
 //*********************************************************************************************************************
 // Private Methods - End
@@ -3,7 +3,8 @@
 // File: AnimatedSprite.h
 //
 // Description:
-//    This class handles creating and drawing of animated sprite images.
+//    This class handles creating and drawing of animated sprite images. The frames come from an animation clip,
+//    which can be shared by any number of sprites.
 //
 //*********************************************************************************************************************
 
@@ -11,6 +12,8 @@
 #define AnimatedSprite_H
 
 #include "Sprite.h"
+#include "AnimationClip.h"
+#include <memory>
 
 namespace Bebop { namespace Graphics
 {
@@ -36,7 +39,7 @@ namespace Bebop { namespace Graphics
          //    aHeight       - The height of the sprite image.
          //    aPosition     - The X-Coordinate and Y-Coordinate to draw the sprite.
          //    aFps          - The number of frames that occur in a second.
-         //    aNumberFrames - The number of frames in the animation.
+         //    aNumberFrames - The number of frames in the looping animation, laid out left to right from the source.
          //    aRotation     - The angle in radians for the rotation of the sprite.
          //
          // Return:
@@ -47,6 +50,59 @@ namespace Bebop { namespace Graphics
                         const int aHeight, const Math::Vector2D<float> aPosition, const float aFps,
                         const int aNumberFrames, const float aRotation);
 
+         //************************************************************************************************************
+         //
+         // Method Name: AnimatedSprite
+         //
+         // Description:
+         //  Constructor for an animated sprite whose sprite(sheet) is loaded in the background. A placeholder is drawn
+         //  until the sprite(sheet) is ready, and the animation runs in the meantime.
+         //
+         // Arguments:
+         //    aLoader       - The loader that loads the sprite(sheet).
+         //    aFilePath     - The file path where the sprite(sheet) is located.
+         //    aSource       - The X-Coordinate and Y-Coordinate where the sprite image on the bitmap is located.
+         //    aWidth        - The width of the sprite image.
+         //    aHeight       - The height of the sprite image.
+         //    aPosition     - The X-Coordinate and Y-Coordinate to draw the sprite.
+         //    aFps          - The number of frames that occur in a second.
+         //    aNumberFrames - The number of frames in the looping animation, laid out left to right from the source.
+         //    aRotation     - The angle in radians for the rotation of the sprite.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         AnimatedSprite(AssetLoader& aLoader, const std::string aFilePath, const Math::Vector2D<int> aSource,
+                        const int aWidth, const int aHeight, const Math::Vector2D<float> aPosition, const float aFps,
+                        const int aNumberFrames, const float aRotation);
+
+         //************************************************************************************************************
+         //
+         // Method Name: AnimatedSprite
+         //
+         // Description:
+         //  Constructor for an animated sprite whose frames are drawn from an image packed into a texture atlas.
+         //
+         // Arguments:
+         //    aAtlas        - The atlas holding the image. It must outlive the sprite.
+         //    aFilePath     - The file path the sprite(sheet) was added to the atlas with.
+         //    aSource       - The X-Coordinate and Y-Coordinate of the first frame on the original image.
+         //    aWidth        - The width of the sprite image.
+         //    aHeight       - The height of the sprite image.
+         //    aPosition     - The X-Coordinate and Y-Coordinate to draw the sprite.
+         //    aFps          - The number of frames that occur in a second.
+         //    aNumberFrames - The number of frames in the looping animation, laid out left to right from the source.
+         //    aRotation     - The angle in radians for the rotation of the sprite.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         AnimatedSprite(const TextureAtlas& aAtlas, const std::string aFilePath, const Math::Vector2D<int> aSource,
+                        const int aWidth, const int aHeight, const Math::Vector2D<float> aPosition, const float aFps,
+                        const int aNumberFrames, const float aRotation);
+
          //************************************************************************************************************
          //
          // Method Name: Update
@@ -63,13 +119,113 @@ namespace Bebop { namespace Graphics
          //************************************************************************************************************
          void Update(const float theElapsedTime);
 
+         //************************************************************************************************************
+         //
+         // Method Name: Play
+         //
+         // Description:
+         //    Starts playing a clip from its first frame. The clip is held by reference, so many sprites can play the
+         //    same clip.
+         //
+         // Arguments:
+         //    aClip - The clip to play. It must outlive the sprite or the next call to play.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void Play(const AnimationClip& aClip);
+
+         //************************************************************************************************************
+         //
+         // Method Name: IsFinished
+         //
+         // Description:
+         //    Checks if a clip played once has shown its last frame for its full time.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    True  - The clip is played once and has finished.
+         //    False - The clip is still playing or repeats.
+         //
+         //************************************************************************************************************
+         bool IsFinished() const;
+
+         //************************************************************************************************************
+         //
+         // Method Name: PlayFromClock
+         //
+         // Description:
+         //    Plays a clip in step with the clock of the scene layer the sprite is on. The sprite only keeps the clip
+         //    and the start time, updates skip it, and the frame is worked out from the clock when it is drawn.
+         //    Sprites started at the same time play in lockstep, and a later start time gives a fixed phase offset.
+         //
+         // Arguments:
+         //    aClip      - The clip to play. It must outlive the sprite or the next call to play.
+         //    aStartTime - The clock time in seconds the clip starts at.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void PlayFromClock(const AnimationClip& aClip, const double aStartTime);
+
+         //************************************************************************************************************
+         //
+         // Method Name: IsClockDriven
+         //
+         // Description:
+         //    Checks if the sprite plays its clip from the clock rather than its own timer.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    True  - The clip is played from the clock.
+         //    False - The clip is played by updating the sprite.
+         //
+         //************************************************************************************************************
+         bool IsClockDriven() const;
+
+         //************************************************************************************************************
+         //
+         // Method Name: DrawAtTime
+         //
+         // Description:
+         //    Draws the sprite, first moving a clock driven sprite to the frame shown at the passed in clock time.
+         //
+         // Arguments:
+         //    aClockTime - The clock time in seconds.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void DrawAtTime(const double aClockTime);
+
       protected:
 
          // There are currently no protected methods for this class.
 
       private:
 
-         // There are currently no private methods for this class.
+         //************************************************************************************************************
+         //
+         // Method Name: ShowFrame
+         //
+         // Description:
+         //    Points the sprite at a frame of the clip being played.
+         //
+         // Arguments:
+         //    aFrameIndex - The index of the frame in the clip.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void ShowFrame(const unsigned int aFrameIndex);
 
    //******************************************************************************************************************
    // Methods - End
@@ -89,17 +245,27 @@ namespace Bebop { namespace Graphics
 
       private:
 
-         // Holds the amount of time until a frame should be updated to the next frame.
-         float mFrameTime;
+         // The clip being played.
+         const AnimationClip* mpClip;
+
+         // The horizontal strip clip built by the constructor, until another clip is played.
+         std::unique_ptr<AnimationClip> mpStripClip;
+
+         // Holds the playback time within the clip.
+         float mClipTime;
+
+         // Holds the clock time the clip started at when the clip is played from the clock.
+         double mStartTime;
 
-         // Holds the number of frames in the current animation.
-         int mNumberFrames;
+         // Whether the clip is played from the clock rather than by updating the sprite.
+         bool mClockDriven;
 
-         // Holds the current frame number in the number of frames.
-         int mCurrentFrame;
+         // Holds the index of the frame being shown.
+         unsigned int mCurrentFrame;
 
-         // Holds the amount of time that has elapsed in total for the current frame.
-         float mElapsedTime;
+         // The offset from the coordinates of the clip frames to the sprite(sheet) bitmap, which is nonzero when the
+         // sprite(sheet) is packed into a texture atlas.
+         Math::Vector2D<int> mSourceOffset;
 
    //******************************************************************************************************************
    // Member Variables - End
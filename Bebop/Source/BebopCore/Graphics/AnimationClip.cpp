@@ -0,0 +1,319 @@
+//*********************************************************************************************************************
+//
+// File: AnimationClip.cpp
+//
+// Description:
+//    This class describes one animation on a sprite(sheet) as a table of frame rectangles played at a fixed rate.
+//    A clip holds no playback state, so any number of animated sprites can play the same clip by reference and only
+//    keep their own elapsed time. The frame shown for a given elapsed time is worked out from the table, which keeps
+//    playback exact no matter how the time is split between updates.
+//
+//*********************************************************************************************************************
+
+#include "AnimationClip.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Bebop { namespace Graphics
+{
+//*********************************************************************************************************************
+// Public Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: AnimationClip
+   //
+   // Description:
+   //    Constructor for a clip without any frames.
+   //
+   // Arguments:
+   //    aPlayMode - How the clip carries on once its last frame has been shown.
+   //    aFps      - The number of frames shown in a second.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   AnimationClip::AnimationClip(const AnimationPlayMode aPlayMode, const float aFps) :
+      mPlayMode(aPlayMode), mFrameTime(1.0F / aFps)
+   {
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: ~AnimationClip
+   //
+   // Description:
+   //    Destructor for the animation clip.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   AnimationClip::~AnimationClip()
+   {
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AddFrame
+   //
+   // Description:
+   //    Adds a frame to the end of the clip.
+   //
+   // Arguments:
+   //    aX      - The X-Coordinate of the frame on the sprite(sheet).
+   //    aY      - The Y-Coordinate of the frame on the sprite(sheet).
+   //    aWidth  - The width of the frame.
+   //    aHeight - The height of the frame.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void AnimationClip::AddFrame(const int aX, const int aY, const int aWidth, const int aHeight)
+   {
+      AnimationFrame frame = {aX, aY, aWidth, aHeight};
+      mFrames.push_back(frame);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AddFrameGrid
+   //
+   // Description:
+   //    Adds equally sized frames laid out left to right on the sprite(sheet), moving down a row after the passed in
+   //    number of columns.
+   //
+   // Arguments:
+   //    aSource     - The X-Coordinate and Y-Coordinate of the first frame on the sprite(sheet).
+   //    aWidth      - The width of each frame.
+   //    aHeight     - The height of each frame.
+   //    aFrameCount - The number of frames to add.
+   //    aColumns    - The number of frames in each row.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void AnimationClip::AddFrameGrid(const Math::Vector2D<int> aSource, const int aWidth, const int aHeight,
+                                    const unsigned int aFrameCount, const unsigned int aColumns)
+   {
+      unsigned int columns = std::max(aColumns, 1U);
+      for (unsigned int i = 0; i < aFrameCount; ++i)
+      {
+         AddFrame(aSource.GetComponentX() + static_cast<int>(i % columns) * aWidth,
+                  aSource.GetComponentY() + static_cast<int>(i / columns) * aHeight,
+                  aWidth,
+                  aHeight);
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AdvanceTime
+   //
+   // Description:
+   //    Moves a playback time forward. Looping and ping-pong clips wrap the time around their cycle so it stays small,
+   //    and clips played once stop at their end.
+   //
+   // Arguments:
+   //    aTime        - The playback time in seconds before the update.
+   //    aElapsedTime - The amount of time elapsed since the last update.
+   //
+   // Return:
+   //    Returns the playback time in seconds after the update.
+   //
+   //******************************************************************************************************************
+   float AnimationClip::AdvanceTime(const float aTime, const float aElapsedTime) const
+   {
+      return GetPlaybackTime(static_cast<double>(aTime) + aElapsedTime);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetPlaybackTime
+   //
+   // Description:
+   //    Turns the time since the clip was started into a playback time within the clip. Looping and ping-pong clips
+   //    wrap the time around their cycle, and clips played once stop at their end. A clip started in the future is at
+   //    its start, or wrapped back into its cycle.
+   //
+   // Arguments:
+   //    aTimeSinceStart - The time in seconds since the clip was started.
+   //
+   // Return:
+   //    Returns the playback time in seconds.
+   //
+   //******************************************************************************************************************
+   float AnimationClip::GetPlaybackTime(const double aTimeSinceStart) const
+   {
+      double duration = GetDuration();
+
+      if (mPlayMode == ANIMATION_ONCE)
+      {
+         return static_cast<float>(std::max(std::min(aTimeSinceStart, duration), 0.0));
+      }
+
+      if (duration <= 0.0)
+      {
+         return 0.0F;
+      }
+
+      // Keep the leftover time past the end of the cycle so the frames stay in step with the clock.
+      double time = std::fmod(aTimeSinceStart, duration);
+      return static_cast<float>(time < 0.0 ? time + duration : time);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetFrameIndex
+   //
+   // Description:
+   //    Finds the frame shown at a playback time.
+   //
+   // Arguments:
+   //    aTime - The playback time in seconds.
+   //
+   // Return:
+   //    Returns the index of the frame. The clip must have at least one frame.
+   //
+   //******************************************************************************************************************
+   unsigned int AnimationClip::GetFrameIndex(const float aTime) const
+   {
+      unsigned int frameCount = static_cast<unsigned int>(mFrames.size());
+      unsigned int step = static_cast<unsigned int>(std::max(aTime, 0.0F) / mFrameTime);
+
+      if (mPlayMode == ANIMATION_ONCE)
+      {
+         return std::min(step, frameCount - 1);
+      }
+
+      if (mPlayMode == ANIMATION_PING_PONG)
+      {
+         if (frameCount < 2)
+         {
+            return 0;
+         }
+
+         // Play forward to the last frame, then back down to the second frame before starting over.
+         unsigned int cycleSteps = (frameCount - 1) * 2;
+         step %= cycleSteps;
+         return step < frameCount ? step : cycleSteps - step;
+      }
+
+      return step % frameCount;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetFrame
+   //
+   // Description:
+   //    Returns a frame of the clip.
+   //
+   // Arguments:
+   //    aIndex - The index of the frame.
+   //
+   // Return:
+   //    Returns the frame.
+   //
+   //******************************************************************************************************************
+   const AnimationFrame& AnimationClip::GetFrame(const unsigned int aIndex) const
+   {
+      return mFrames[aIndex];
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetFrameCount
+   //
+   // Description:
+   //    Returns the number of frames in the clip.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the number of frames.
+   //
+   //******************************************************************************************************************
+   unsigned int AnimationClip::GetFrameCount() const
+   {
+      return static_cast<unsigned int>(mFrames.size());
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetDuration
+   //
+   // Description:
+   //    Returns the length of one cycle of the clip. A ping-pong cycle plays the frames forward and back again without
+   //    repeating the first and last frames.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the length of a cycle in seconds.
+   //
+   //******************************************************************************************************************
+   float AnimationClip::GetDuration() const
+   {
+      float frameCount = static_cast<float>(mFrames.size());
+      if (mPlayMode == ANIMATION_PING_PONG && mFrames.size() > 1)
+      {
+         return (frameCount - 1.0F) * 2.0F * mFrameTime;
+      }
+
+      return frameCount * mFrameTime;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: IsFinished
+   //
+   // Description:
+   //    Checks if a clip played once has reached its end.
+   //
+   // Arguments:
+   //    aTime - The playback time in seconds.
+   //
+   // Return:
+   //    True  - The clip is played once and the time is at its end.
+   //    False - The clip is still playing or repeats.
+   //
+   //******************************************************************************************************************
+   bool AnimationClip::IsFinished(const float aTime) const
+   {
+      return mPlayMode == ANIMATION_ONCE && aTime >= GetDuration();
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no private methods for this class.
+
+//*********************************************************************************************************************
+// Private Methods - End
+//*********************************************************************************************************************
+}}
@@ -0,0 +1,279 @@
+//*********************************************************************************************************************
+//
+// File: AnimationClip.h
+//
+// Description:
+//    This class describes one animation on a sprite(sheet) as a table of frame rectangles played at a fixed rate.
+//    A clip holds no playback state, so any number of animated sprites can play the same clip by reference and only
+//    keep their own elapsed time. The frame shown for a given elapsed time is worked out from the table, which keeps
+//    playback exact no matter how the time is split between updates.
+//
+//*********************************************************************************************************************
+
+#ifndef AnimationClip_H
+#define AnimationClip_H
+
+#include "../Math/Vector2D.h"
+#include <vector>
+
+namespace Bebop { namespace Graphics
+{
+   // How a clip carries on once its last frame has been shown.
+   enum AnimationPlayMode
+   {
+      ANIMATION_LOOP,
+      ANIMATION_PING_PONG,
+      ANIMATION_ONCE
+   };
+
+   // Where a frame of a clip is on the sprite(sheet).
+   struct AnimationFrame
+   {
+      int x;
+      int y;
+      int width;
+      int height;
+   };
+
+   class AnimationClip
+   {
+      //***************************************************************************************************************
+      // Methods - Start
+      //***************************************************************************************************************
+
+      public:
+
+         //************************************************************************************************************
+         //
+         // Method: AnimationClip
+         //
+         // Description:
+         //    Constructor for a clip without any frames.
+         //
+         // Arguments:
+         //    aPlayMode - How the clip carries on once its last frame has been shown.
+         //    aFps      - The number of frames shown in a second.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         AnimationClip(const AnimationPlayMode aPlayMode, const float aFps);
+
+         //************************************************************************************************************
+         //
+         // Method: ~AnimationClip
+         //
+         // Description:
+         //    Destructor for the animation clip.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         ~AnimationClip();
+
+         //************************************************************************************************************
+         //
+         // Method: AddFrame
+         //
+         // Description:
+         //    Adds a frame to the end of the clip.
+         //
+         // Arguments:
+         //    aX      - The X-Coordinate of the frame on the sprite(sheet).
+         //    aY      - The Y-Coordinate of the frame on the sprite(sheet).
+         //    aWidth  - The width of the frame.
+         //    aHeight - The height of the frame.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void AddFrame(const int aX, const int aY, const int aWidth, const int aHeight);
+
+         //************************************************************************************************************
+         //
+         // Method: AddFrameGrid
+         //
+         // Description:
+         //    Adds equally sized frames laid out left to right on the sprite(sheet), moving down a row after the
+         //    passed in number of columns.
+         //
+         // Arguments:
+         //    aSource     - The X-Coordinate and Y-Coordinate of the first frame on the sprite(sheet).
+         //    aWidth      - The width of each frame.
+         //    aHeight     - The height of each frame.
+         //    aFrameCount - The number of frames to add.
+         //    aColumns    - The number of frames in each row.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void AddFrameGrid(const Math::Vector2D<int> aSource, const int aWidth, const int aHeight,
+                           const unsigned int aFrameCount, const unsigned int aColumns);
+
+         //************************************************************************************************************
+         //
+         // Method: AdvanceTime
+         //
+         // Description:
+         //    Moves a playback time forward. Looping and ping-pong clips wrap the time around their cycle so it stays
+         //    small, and clips played once stop at their end.
+         //
+         // Arguments:
+         //    aTime        - The playback time in seconds before the update.
+         //    aElapsedTime - The amount of time elapsed since the last update.
+         //
+         // Return:
+         //    Returns the playback time in seconds after the update.
+         //
+         //************************************************************************************************************
+         float AdvanceTime(const float aTime, const float aElapsedTime) const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetPlaybackTime
+         //
+         // Description:
+         //    Turns the time since the clip was started into a playback time within the clip. Looping and ping-pong
+         //    clips wrap the time around their cycle, and clips played once stop at their end. A clip started in the
+         //    future is at its start, or wrapped back into its cycle.
+         //
+         // Arguments:
+         //    aTimeSinceStart - The time in seconds since the clip was started.
+         //
+         // Return:
+         //    Returns the playback time in seconds.
+         //
+         //************************************************************************************************************
+         float GetPlaybackTime(const double aTimeSinceStart) const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetFrameIndex
+         //
+         // Description:
+         //    Finds the frame shown at a playback time.
+         //
+         // Arguments:
+         //    aTime - The playback time in seconds.
+         //
+         // Return:
+         //    Returns the index of the frame. The clip must have at least one frame.
+         //
+         //************************************************************************************************************
+         unsigned int GetFrameIndex(const float aTime) const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetFrame
+         //
+         // Description:
+         //    Returns a frame of the clip.
+         //
+         // Arguments:
+         //    aIndex - The index of the frame.
+         //
+         // Return:
+         //    Returns the frame.
+         //
+         //************************************************************************************************************
+         const AnimationFrame& GetFrame(const unsigned int aIndex) const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetFrameCount
+         //
+         // Description:
+         //    Returns the number of frames in the clip.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the number of frames.
+         //
+         //************************************************************************************************************
+         unsigned int GetFrameCount() const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetDuration
+         //
+         // Description:
+         //    Returns the length of one cycle of the clip. A ping-pong cycle plays the frames forward and back again
+         //    without repeating the first and last frames.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the length of a cycle in seconds.
+         //
+         //************************************************************************************************************
+         float GetDuration() const;
+
+         //************************************************************************************************************
+         //
+         // Method: IsFinished
+         //
+         // Description:
+         //    Checks if a clip played once has reached its end.
+         //
+         // Arguments:
+         //    aTime - The playback time in seconds.
+         //
+         // Return:
+         //    True  - The clip is played once and the time is at its end.
+         //    False - The clip is still playing or repeats.
+         //
+         //************************************************************************************************************
+         bool IsFinished(const float aTime) const;
+
+      protected:
+
+         // There are currently no protected methods for this class.
+
+      private:
+
+         // There are currently no private methods for this class.
+
+      //***************************************************************************************************************
+      // Methods - End
+      //***************************************************************************************************************
+
+      //***************************************************************************************************************
+      // Member Variables - Start
+      //***************************************************************************************************************
+
+      public:
+
+         // There are currently no public member variables for this class.
+
+      protected:
+
+         // There are currently no protected member variables for this class.
+
+      private:
+
+         // How the clip carries on once its last frame has been shown.
+         AnimationPlayMode mPlayMode;
+
+         // The amount of time each frame is shown for.
+         float mFrameTime;
+
+         // The frames of the clip in the order they are played.
+         std::vector<AnimationFrame> mFrames;
+
+      //***************************************************************************************************************
+      // Member Variables - End
+      //***************************************************************************************************************
+   };
+}}
+
+#endif // AnimationClip_H
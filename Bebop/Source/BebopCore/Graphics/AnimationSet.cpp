@@ -0,0 +1,243 @@
+//*********************************************************************************************************************
+//
+// File: AnimationSet.cpp
+//
+// Description:
+//    This class holds the named animation clips of a sprite(sheet), such as "walk" and "idle". The clips can be built
+//    in code or loaded from a text file with one line per clip or frame:
+//       clip <name> <loop|pingpong|once> <fps>
+//       frame <x> <y> <width> <height>
+//       grid <x> <y> <width> <height> <frame count> <columns>
+//    Frame and grid lines add frames to the clip named on the clip line above them.
+//
+//*********************************************************************************************************************
+
+#include "AnimationSet.h"
+#include <fstream>
+
+namespace Bebop { namespace Graphics
+{
+   namespace
+   {
+      //***************************************************************************************************************
+      //
+      // Method Name: ParsePlayMode
+      //
+      // Description:
+      //    Turns the name of a play mode in a clip description into the play mode.
+      //
+      // Arguments:
+      //    aName      - The name of the play mode.
+      //    apPlayMode - Updated with the play mode.
+      //
+      // Return:
+      //    True  - The name is a play mode.
+      //    False - The name is not a play mode.
+      //
+      //***************************************************************************************************************
+      bool ParsePlayMode(const std::string& aName, AnimationPlayMode* apPlayMode)
+      {
+         if (aName == "loop")
+         {
+            *apPlayMode = ANIMATION_LOOP;
+         }
+         else if (aName == "pingpong")
+         {
+            *apPlayMode = ANIMATION_PING_PONG;
+         }
+         else if (aName == "once")
+         {
+            *apPlayMode = ANIMATION_ONCE;
+         }
+         else
+         {
+            return false;
+         }
+
+         return true;
+      }
+   }
+
+//*********************************************************************************************************************
+// Public Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: AnimationSet
+   //
+   // Description:
+   //    Constructor for a set without any clips.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   AnimationSet::AnimationSet()
+   {
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: ~AnimationSet
+   //
+   // Description:
+   //    Destructor for the set. Sprites playing its clips must not outlive it.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   AnimationSet::~AnimationSet()
+   {
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AddClip
+   //
+   // Description:
+   //    Adds an empty clip to the set. The clip stays at the same address for the life of the set.
+   //
+   // Arguments:
+   //    aName     - The name the clip is found by.
+   //    aPlayMode - How the clip carries on once its last frame has been shown.
+   //    aFps      - The number of frames shown in a second.
+   //
+   // Return:
+   //    Returns the clip to add frames to, or nullptr if the set already has a clip with the name.
+   //
+   //******************************************************************************************************************
+   AnimationClip* AnimationSet::AddClip(const std::string aName, const AnimationPlayMode aPlayMode, const float aFps)
+   {
+      auto result = mClips.emplace(aName, AnimationClip(aPlayMode, aFps));
+      return result.second == true ? &result.first->second : nullptr;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetClip
+   //
+   // Description:
+   //    Finds a clip by name.
+   //
+   // Arguments:
+   //    aName - The name of the clip.
+   //
+   // Return:
+   //    Returns the clip, or nullptr if the set has no clip with the name.
+   //
+   //******************************************************************************************************************
+   const AnimationClip* AnimationSet::GetClip(const std::string& aName) const
+   {
+      auto iterator = mClips.find(aName);
+      return iterator != mClips.end() ? &iterator->second : nullptr;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: Load
+   //
+   // Description:
+   //    Adds the clips described in a text file to the set.
+   //
+   // Arguments:
+   //    aFilePath - The file location of the clip descriptions.
+   //
+   // Return:
+   //    True  - Every clip in the file was added.
+   //    False - The file could not be read or has a bad line. Clips before the bad line are kept.
+   //
+   //******************************************************************************************************************
+   bool AnimationSet::Load(const std::string aFilePath)
+   {
+      std::ifstream file(aFilePath.c_str());
+      if (file.is_open() == false)
+      {
+         return false;
+      }
+
+      AnimationClip* pClip = nullptr;
+      std::string tag;
+      while (file >> tag)
+      {
+         if (tag == "clip")
+         {
+            std::string name;
+            std::string playModeName;
+            AnimationPlayMode playMode;
+            float fps = 0.0F;
+            file >> name >> playModeName >> fps;
+            if (file.fail() == true || ParsePlayMode(playModeName, &playMode) == false || fps <= 0.0F ||
+                nullptr == (pClip = AddClip(name, playMode, fps)))
+            {
+               return false;
+            }
+         }
+         else if (tag == "frame" && pClip != nullptr)
+         {
+            int x = 0;
+            int y = 0;
+            int width = 0;
+            int height = 0;
+            if ((file >> x >> y >> width >> height).fail() == true)
+            {
+               return false;
+            }
+
+            pClip->AddFrame(x, y, width, height);
+         }
+         else if (tag == "grid" && pClip != nullptr)
+         {
+            int x = 0;
+            int y = 0;
+            int width = 0;
+            int height = 0;
+            unsigned int frameCount = 0;
+            unsigned int columns = 0;
+            if ((file >> x >> y >> width >> height >> frameCount >> columns).fail() == true)
+            {
+               return false;
+            }
+
+            pClip->AddFrameGrid(Math::Vector2D<int>(x, y), width, height, frameCount, columns);
+         }
+         else
+         {
+            return false;
+         }
+      }
+
+      return file.eof() == true;
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no private methods for this class.
+
+//*********************************************************************************************************************
+// Private Methods - End
+//*********************************************************************************************************************
+}}
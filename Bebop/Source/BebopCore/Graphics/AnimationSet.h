@@ -0,0 +1,150 @@
+//*********************************************************************************************************************
+//
+// File: AnimationSet.h
+//
+// Description:
+//    This class holds the named animation clips of a sprite(sheet), such as "walk" and "idle". The clips can be built
+//    in code or loaded from a text file with one line per clip or frame:
+//       clip <name> <loop|pingpong|once> <fps>
+//       frame <x> <y> <width> <height>
+//       grid <x> <y> <width> <height> <frame count> <columns>
+//    Frame and grid lines add frames to the clip named on the clip line above them.
+//
+//*********************************************************************************************************************
+
+#ifndef AnimationSet_H
+#define AnimationSet_H
+
+#include "AnimationClip.h"
+#include <string>
+#include <unordered_map>
+
+namespace Bebop { namespace Graphics
+{
+   class AnimationSet
+   {
+      //***************************************************************************************************************
+      // Methods - Start
+      //***************************************************************************************************************
+
+      public:
+
+         //************************************************************************************************************
+         //
+         // Method: AnimationSet
+         //
+         // Description:
+         //    Constructor for a set without any clips.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         AnimationSet();
+
+         //************************************************************************************************************
+         //
+         // Method: ~AnimationSet
+         //
+         // Description:
+         //    Destructor for the set. Sprites playing its clips must not outlive it.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         ~AnimationSet();
+
+         //************************************************************************************************************
+         //
+         // Method: AddClip
+         //
+         // Description:
+         //    Adds an empty clip to the set. The clip stays at the same address for the life of the set.
+         //
+         // Arguments:
+         //    aName     - The name the clip is found by.
+         //    aPlayMode - How the clip carries on once its last frame has been shown.
+         //    aFps      - The number of frames shown in a second.
+         //
+         // Return:
+         //    Returns the clip to add frames to, or nullptr if the set already has a clip with the name.
+         //
+         //************************************************************************************************************
+         AnimationClip* AddClip(const std::string aName, const AnimationPlayMode aPlayMode, const float aFps);
+
+         //************************************************************************************************************
+         //
+         // Method: GetClip
+         //
+         // Description:
+         //    Finds a clip by name.
+         //
+         // Arguments:
+         //    aName - The name of the clip.
+         //
+         // Return:
+         //    Returns the clip, or nullptr if the set has no clip with the name.
+         //
+         //************************************************************************************************************
+         const AnimationClip* GetClip(const std::string& aName) const;
+
+         //************************************************************************************************************
+         //
+         // Method: Load
+         //
+         // Description:
+         //    Adds the clips described in a text file to the set.
+         //
+         // Arguments:
+         //    aFilePath - The file location of the clip descriptions.
+         //
+         // Return:
+         //    True  - Every clip in the file was added.
+         //    False - The file could not be read or has a bad line. Clips before the bad line are kept.
+         //
+         //************************************************************************************************************
+         bool Load(const std::string aFilePath);
+
+      protected:
+
+         // There are currently no protected methods for this class.
+
+      private:
+
+         // There are currently no private methods for this class.
+
+      //***************************************************************************************************************
+      // Methods - End
+      //***************************************************************************************************************
+
+      //***************************************************************************************************************
+      // Member Variables - Start
+      //***************************************************************************************************************
+
+      public:
+
+         // There are currently no public member variables for this class.
+
+      protected:
+
+         // There are currently no protected member variables for this class.
+
+      private:
+
+         // The clips of the set keyed by name.
+         std::unordered_map<std::string, AnimationClip> mClips;
+
+      //***************************************************************************************************************
+      // Member Variables - End
+      //***************************************************************************************************************
+   };
+}}
+
+#endif // AnimationSet_H
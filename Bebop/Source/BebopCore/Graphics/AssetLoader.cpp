@@ -0,0 +1,345 @@
+//*********************************************************************************************************************
+//
+// File: AssetLoader.cpp
+//
+// Description:
+//    This class loads image files in the background so level loads do not stall the frame loop. Worker threads decode
+//    the files into memory bitmaps and turn the magenta mask color into alpha. The main thread then uploads the
+//    decoded bitmaps to video bitmaps a few at a time, within a time budget, each time the loader is updated. A load
+//    returns a shared asset that sprites hold onto and check each draw until the bitmap is ready.
+//
+//*********************************************************************************************************************
+
+#include "AssetLoader.h"
+#include "GraphicsConstants.h"
+#include <algorithm>
+
+namespace Bebop { namespace Graphics
+{
+   namespace
+   {
+      //***************************************************************************************************************
+      //
+      // Method Name: DestroyBitmapAsset
+      //
+      // Description:
+      //    Frees a bitmap asset once its last holder lets go of it, along with any bitmap it still holds.
+      //
+      // Arguments:
+      //    apAsset - The asset being freed.
+      //
+      // Return:
+      //    N/A
+      //
+      //***************************************************************************************************************
+      void DestroyBitmapAsset(BitmapAsset* apAsset)
+      {
+         if (apAsset->pBitmap != nullptr)
+         {
+            al_destroy_bitmap(apAsset->pBitmap);
+         }
+
+         if (apAsset->pDecodedBitmap != nullptr)
+         {
+            al_destroy_bitmap(apAsset->pDecodedBitmap);
+         }
+
+         delete apAsset;
+      }
+   }
+
+//*********************************************************************************************************************
+// Public Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: AssetLoader
+   //
+   // Description:
+   //    Constructor for the asset loader that starts the worker threads.
+   //
+   // Arguments:
+   //    aWorkerCount - The number of worker threads decoding files.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   AssetLoader::AssetLoader(const unsigned int aWorkerCount) :
+      mDecodingCount(0), mStopping(false), mpAlphaMaskCache(nullptr), mAssetSweepSize(ASSET_SWEEP_MINIMUM_SIZE)
+   {
+      for (unsigned int i = 0; i < aWorkerCount; ++i)
+      {
+         mWorkers.push_back(std::thread(&AssetLoader::DecodeFiles, this));
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: ~AssetLoader
+   //
+   // Description:
+   //    Destructor for the asset loader that stops the worker threads. Assets that are still loading are left in the
+   //    loading state.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   AssetLoader::~AssetLoader()
+   {
+      {
+         std::lock_guard<std::mutex> lock(mMutex);
+         mStopping = true;
+      }
+
+      mWorkAvailable.notify_all();
+      for (auto iterator = mWorkers.begin(); iterator != mWorkers.end(); ++iterator)
+      {
+         iterator->join();
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: RequestBitmap
+   //
+   // Description:
+   //    Queues an image file to be loaded in the background. Requesting a file that is still held by someone returns
+   //    the same asset instead of loading the file again. Must be called from the main thread.
+   //
+   // Arguments:
+   //    aFilePath - The file location of the image.
+   //
+   // Return:
+   //    Returns the asset, which is ready once the loader has uploaded the bitmap.
+   //
+   //******************************************************************************************************************
+   std::shared_ptr<BitmapAsset> AssetLoader::RequestBitmap(const std::string aFilePath)
+   {
+      std::shared_ptr<BitmapAsset> pAsset = mAssets[aFilePath].lock();
+      if (pAsset != nullptr)
+      {
+         return pAsset;
+      }
+
+      BitmapAsset* pNewAsset = new BitmapAsset;
+      pNewAsset->filePath = aFilePath;
+      pNewAsset->state = ASSET_LOADING;
+      pNewAsset->pBitmap = nullptr;
+      pNewAsset->pDecodedBitmap = nullptr;
+      pAsset = std::shared_ptr<BitmapAsset>(pNewAsset, DestroyBitmapAsset);
+
+      // Files nobody holds any longer leave expired entries behind. They are swept out each time the map doubles in
+      // size since the last sweep, so sweeping costs a constant amount per request on average.
+      if (mAssets.size() >= mAssetSweepSize)
+      {
+         for (auto iterator = mAssets.begin(); iterator != mAssets.end();)
+         {
+            if (iterator->second.expired() == true)
+            {
+               iterator = mAssets.erase(iterator);
+            }
+            else
+            {
+               ++iterator;
+            }
+         }
+
+         mAssetSweepSize = std::max(static_cast<unsigned int>(mAssets.size()) * 2, ASSET_SWEEP_MINIMUM_SIZE);
+      }
+
+      mAssets[aFilePath] = pAsset;
+
+      {
+         std::lock_guard<std::mutex> lock(mMutex);
+         mDecodeQueue.push_back(pAsset);
+      }
+
+      mWorkAvailable.notify_one();
+      return pAsset;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: Update
+   //
+   // Description:
+   //    Uploads decoded bitmaps to video bitmaps until the time budget is used up. At least one bitmap is uploaded
+   //    each call so loading always makes progress. Must be called from the main thread, typically once per frame.
+   //
+   // Arguments:
+   //    aTimeBudget - The time in seconds that can be spent uploading.
+   //
+   // Return:
+   //    Returns the number of assets finished during this call.
+   //
+   //******************************************************************************************************************
+   unsigned int AssetLoader::Update(const double aTimeBudget)
+   {
+      double startTime = al_get_time();
+      unsigned int finishedCount = 0;
+
+      // Bitmaps created on this thread are uploaded to the display.
+      int bitmapFlags = al_get_new_bitmap_flags();
+      al_set_new_bitmap_flags((bitmapFlags & ~ALLEGRO_MEMORY_BITMAP) | ALLEGRO_VIDEO_BITMAP);
+
+      do
+      {
+         std::shared_ptr<BitmapAsset> pAsset;
+         {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (mUploadQueue.empty() == true)
+            {
+               break;
+            }
+
+            pAsset = mUploadQueue.front();
+            mUploadQueue.pop_front();
+         }
+
+         if (pAsset->pDecodedBitmap != nullptr)
+         {
+            pAsset->pBitmap = al_clone_bitmap(pAsset->pDecodedBitmap);
+            al_destroy_bitmap(pAsset->pDecodedBitmap);
+            pAsset->pDecodedBitmap = nullptr;
+         }
+
+         pAsset->state = pAsset->pBitmap != nullptr ? ASSET_READY : ASSET_FAILED;
+         ++finishedCount;
+      } while (al_get_time() - startTime < aTimeBudget);
+
+      al_set_new_bitmap_flags(bitmapFlags);
+      return finishedCount;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: IsIdle
+   //
+   // Description:
+   //    Checks if every queued file has been loaded and uploaded.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    True  - There is no work left.
+   //    False - Files are still being decoded or waiting to be uploaded.
+   //
+   //******************************************************************************************************************
+   bool AssetLoader::IsIdle()
+   {
+      std::lock_guard<std::mutex> lock(mMutex);
+      return mDecodeQueue.empty() == true && mUploadQueue.empty() == true && mDecodingCount == 0;
+   }
+
+   //*******************************************************************************************************************
+   //
+   // Method: SetAlphaMaskCache
+   //
+   // Description:
+   //    Sets the cache used to load images, so images that were loaded before skip decoding and the mask conversion.
+   //    Without a cache every image is decoded and converted.
+   //
+   // Arguments:
+   //    apCache - The cache to load images through, or nullptr to stop using one. It must outlive the loader.
+   //
+   // Return:
+   //    N/A
+   //
+   //*******************************************************************************************************************
+   void AssetLoader::SetAlphaMaskCache(const AlphaMaskCache* apCache)
+   {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mpAlphaMaskCache = apCache;
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: DecodeFiles
+   //
+   // Description:
+   //    The loop run by each worker thread. Takes files off the queue, decodes them into memory bitmaps, and hands
+   //    them to the main thread until the loader is stopped. A file that fails to decode is handed over without a
+   //    bitmap so the main thread marks it as failed.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void AssetLoader::DecodeFiles()
+   {
+      // Bitmaps created on a worker thread stay in memory, since only the main thread owns the display.
+      al_set_new_bitmap_flags(ALLEGRO_MEMORY_BITMAP);
+
+      while (true)
+      {
+         std::shared_ptr<BitmapAsset> pAsset;
+         const AlphaMaskCache* pCache = nullptr;
+         {
+            std::unique_lock<std::mutex> lock(mMutex);
+            while (mStopping == false && mDecodeQueue.empty() == true)
+            {
+               mWorkAvailable.wait(lock);
+            }
+
+            if (mStopping == true)
+            {
+               return;
+            }
+
+            pAsset = mDecodeQueue.front();
+            mDecodeQueue.pop_front();
+            pCache = mpAlphaMaskCache;
+            ++mDecodingCount;
+         }
+
+         ALLEGRO_BITMAP* pDecodedBitmap = nullptr;
+         if (pCache != nullptr)
+         {
+            pDecodedBitmap = pCache->LoadMaskedBitmap(pAsset->filePath);
+         }
+         else if (nullptr != (pDecodedBitmap = al_load_bitmap(pAsset->filePath.c_str())))
+         {
+            al_convert_mask_to_alpha(pDecodedBitmap, al_map_rgb(255, 0, 255));
+         }
+
+         {
+            std::lock_guard<std::mutex> lock(mMutex);
+            pAsset->pDecodedBitmap = pDecodedBitmap;
+            mUploadQueue.push_back(pAsset);
+            --mDecodingCount;
+         }
+      }
+   }
+
+//*********************************************************************************************************************
+// Private Methods - End
+//*********************************************************************************************************************
+}}
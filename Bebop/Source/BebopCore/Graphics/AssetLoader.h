@@ -0,0 +1,235 @@
+//*********************************************************************************************************************
+//
+// File: AssetLoader.h
+//
+// Description:
+//    This class loads image files in the background so level loads do not stall the frame loop. Worker threads decode
+//    the files into memory bitmaps and turn the magenta mask color into alpha. The main thread then uploads the
+//    decoded bitmaps to video bitmaps a few at a time, within a time budget, each time the loader is updated. A load
+//    returns a shared asset that sprites hold onto and check each draw until the bitmap is ready.
+//
+//*********************************************************************************************************************
+
+#ifndef AssetLoader_H
+#define AssetLoader_H
+
+#include "AlphaMaskCache.h"
+#include <allegro5/allegro.h>
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <unordered_map>
+
+namespace Bebop { namespace Graphics
+{
+   // The stages of loading a bitmap asset.
+   enum AssetState
+   {
+      ASSET_LOADING,
+      ASSET_READY,
+      ASSET_FAILED
+   };
+
+   // A bitmap being loaded by the asset loader. The bitmap is only set once the asset is ready, and is destroyed when
+   // the last holder of the asset lets go of it.
+   struct BitmapAsset
+   {
+      std::string filePath;
+      AssetState state;
+      ALLEGRO_BITMAP* pBitmap;
+      ALLEGRO_BITMAP* pDecodedBitmap;
+   };
+
+   class AssetLoader
+   {
+      //***************************************************************************************************************
+      // Methods - Start
+      //***************************************************************************************************************
+
+      public:
+
+         //************************************************************************************************************
+         //
+         // Method: AssetLoader
+         //
+         // Description:
+         //    Constructor for the asset loader that starts the worker threads.
+         //
+         // Arguments:
+         //    aWorkerCount - The number of worker threads decoding files.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         AssetLoader(const unsigned int aWorkerCount);
+
+         //************************************************************************************************************
+         //
+         // Method: ~AssetLoader
+         //
+         // Description:
+         //    Destructor for the asset loader that stops the worker threads. Assets that are still loading are left
+         //    in the loading state.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         ~AssetLoader();
+
+         //************************************************************************************************************
+         //
+         // Method: RequestBitmap
+         //
+         // Description:
+         //    Queues an image file to be loaded in the background. Requesting a file that is still held by someone
+         //    returns the same asset instead of loading the file again. Must be called from the main thread.
+         //
+         // Arguments:
+         //    aFilePath - The file location of the image.
+         //
+         // Return:
+         //    Returns the asset, which is ready once the loader has uploaded the bitmap.
+         //
+         //************************************************************************************************************
+         std::shared_ptr<BitmapAsset> RequestBitmap(const std::string aFilePath);
+
+         //************************************************************************************************************
+         //
+         // Method: Update
+         //
+         // Description:
+         //    Uploads decoded bitmaps to video bitmaps until the time budget is used up. At least one bitmap is
+         //    uploaded each call so loading always makes progress. Must be called from the main thread, typically
+         //    once per frame.
+         //
+         // Arguments:
+         //    aTimeBudget - The time in seconds that can be spent uploading.
+         //
+         // Return:
+         //    Returns the number of assets finished during this call.
+         //
+         //************************************************************************************************************
+         unsigned int Update(const double aTimeBudget);
+
+         //************************************************************************************************************
+         //
+         // Method: IsIdle
+         //
+         // Description:
+         //    Checks if every queued file has been loaded and uploaded.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    True  - There is no work left.
+         //    False - Files are still being decoded or waiting to be uploaded.
+         //
+         //************************************************************************************************************
+         bool IsIdle();
+
+         //*************************************************************************************************************
+         //
+         // Method: SetAlphaMaskCache
+         //
+         // Description:
+         //    Sets the cache used to load images, so images that were loaded before skip decoding and the mask
+         //    conversion. Without a cache every image is decoded and converted.
+         //
+         // Arguments:
+         //    apCache - The cache to load images through, or nullptr to stop using one. It must outlive the loader.
+         //
+         // Return:
+         //    N/A
+         //
+         //*************************************************************************************************************
+         void SetAlphaMaskCache(const AlphaMaskCache* apCache);
+
+      protected:
+
+         // There are currently no protected methods for this class.
+
+      private:
+
+         //************************************************************************************************************
+         //
+         // Method: DecodeFiles
+         //
+         // Description:
+         //    The loop run by each worker thread. Takes files off the queue, decodes them into memory bitmaps, and
+         //    hands them to the main thread until the loader is stopped.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void DecodeFiles();
+
+      //***************************************************************************************************************
+      // Methods - End
+      //***************************************************************************************************************
+
+      //***************************************************************************************************************
+      // Member Variables - Start
+      //***************************************************************************************************************
+
+      public:
+
+         // There are currently no public member variables for this class.
+
+      protected:
+
+         // There are currently no protected member variables for this class.
+
+      private:
+
+         // The worker threads decoding files.
+         std::vector<std::thread> mWorkers;
+
+         // Guards the queues and the stop flag, which are shared with the worker threads.
+         std::mutex mMutex;
+
+         // Wakes the worker threads when files are queued or the loader is stopped.
+         std::condition_variable mWorkAvailable;
+
+         // The assets waiting to be decoded.
+         std::deque<std::shared_ptr<BitmapAsset>> mDecodeQueue;
+
+         // The assets decoded and waiting to be uploaded by the main thread.
+         std::deque<std::shared_ptr<BitmapAsset>> mUploadQueue;
+
+         // The number of assets a worker is decoding right now.
+         unsigned int mDecodingCount;
+
+         // Whether the worker threads should stop.
+         bool mStopping;
+
+         // The cache images are loaded through, shared with the worker threads.
+         const AlphaMaskCache* mpAlphaMaskCache;
+
+         // The assets already requested keyed by file path, so files still in use are not loaded twice. Only used on
+         // the main thread.
+         std::unordered_map<std::string, std::weak_ptr<BitmapAsset>> mAssets;
+
+         // The number of entries in the asset map at which the expired entries are next swept out.
+         unsigned int mAssetSweepSize;
+
+      //***************************************************************************************************************
+      // Member Variables - End
+      //***************************************************************************************************************
+   };
+}}
+
+#endif // AssetLoader_H
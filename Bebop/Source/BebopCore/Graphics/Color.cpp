@@ -4,42 +4,40 @@
 //
 // Description:
 //    This class handles holding information on a specific color in an RGB fashion. There is also an alpha (opacity)
-//    value correlated with the color.  
+//    value correlated with the color. The channels are packed into 4 bytes with red in the lowest byte, so colors are
+//    cheap to copy and store by value. Conversions to Allegro colors look each channel up in a shared table of float
+//    values instead of converting the channels every draw.
 //
 //*********************************************************************************************************************
 
 #include "Color.h"
-#include "GraphicsConstants.h"
+#include <algorithm>
 
 namespace Bebop { namespace Graphics
 {
+   namespace
+   {
+      // The float value of every channel value, worked out once and shared by all colors.
+      struct ChannelTable
+      {
+         ChannelTable()
+         {
+            for (unsigned int i = 0; i <= MAX_COLOR_VALUE; ++i)
+            {
+               values[i] = static_cast<float>(i) / static_cast<float>(MAX_COLOR_VALUE);
+            }
+         }
+
+         float values[MAX_COLOR_VALUE + 1];
+      };
+
+      const ChannelTable channelTable;
+   }
+
 //*********************************************************************************************************************
 // Public Methods - Start
 //*********************************************************************************************************************
 
-   //******************************************************************************************************************
-   //
-   // Method: Scene
-   //
-   // Description:
-   //    Constructor for a color that sets the red, green, blue, and alpha properties.
-   //
-   // Arguments:
-   //    aRed   - The red color value.
-   //    aGreen - The green color value.
-   //    aBlue  - The blue color value.
-   //    aAlpha - The alpha (opacity) value.
-   //
-   // Return:
-   //    N/A
-   //
-   //******************************************************************************************************************
-   Color::Color(const unsigned int aRed, const unsigned int aGreen, const unsigned int aBlue,
-                const unsigned int aAlpha) :
-      mRed(VerifyRange(aRed)), mBlue(VerifyRange(aBlue)), mGreen(VerifyRange(aGreen)), mAlpha(VerifyRange(aAlpha))
-   {
-   }
-
    //******************************************************************************************************************
    //
    // Method: SetRedColor
@@ -56,7 +54,7 @@ namespace Bebop { namespace Graphics
    //******************************************************************************************************************
    void Color::SetRedColor(const unsigned int aRed)
    {
-      mRed = VerifyRange(aRed);
+      SetChannel(RED_CHANNEL_SHIFT, VerifyRange(aRed));
    }
 
    //******************************************************************************************************************
@@ -75,7 +73,7 @@ namespace Bebop { namespace Graphics
    //******************************************************************************************************************
    void Color::SetGreenColor(const unsigned int aGreen)
    {
-      mGreen = VerifyRange(aGreen);
+      SetChannel(GREEN_CHANNEL_SHIFT, VerifyRange(aGreen));
    }
 
    //******************************************************************************************************************
@@ -94,7 +92,7 @@ namespace Bebop { namespace Graphics
    //******************************************************************************************************************
    void Color::SetBlueColor(const unsigned int aBlue)
    {
-      mBlue = VerifyRange(aBlue);
+      SetChannel(BLUE_CHANNEL_SHIFT, VerifyRange(aBlue));
    }
 
    //******************************************************************************************************************
@@ -113,83 +111,75 @@ namespace Bebop { namespace Graphics
    //******************************************************************************************************************
    void Color::SetAlpha(const unsigned int aAlpha)
    {
-      mAlpha = VerifyRange(aAlpha);
+      SetChannel(ALPHA_CHANNEL_SHIFT, VerifyRange(aAlpha));
    }
 
    //******************************************************************************************************************
    //
-   // Method: GetRedColor
+   // Method: ToAllegroColor
    //
    // Description:
-   //    Returns the red color value.
+   //    Converts the color to an Allegro color.
    //
    // Arguments:
    //    N/A
    //
    // Return:
-   //    Returns the red color value.
+   //    Returns the Allegro color.
    //
    //******************************************************************************************************************
-   unsigned int Color::GetRedColor() const
+   ALLEGRO_COLOR Color::ToAllegroColor() const
    {
-      return mRed;
+      ALLEGRO_COLOR color = {channelTable.values[GetRedColor()], channelTable.values[GetGreenColor()],
+                             channelTable.values[GetBlueColor()], channelTable.values[GetAlpha()]};
+      return color;
    }
-   
+
    //******************************************************************************************************************
    //
-   // Method: SetGreenColor
+   // Method: ToScaledAllegroColor
    //
    // Description:
-   //    Returns the green color value.
+   //    Converts the color to an Allegro color with every channel, alpha included, multiplied by a scale. Used to fade
+   //    a color, such as a light dimming towards its edge.
    //
    // Arguments:
-   //    N/A
+   //    aScale - The amount to multiply each channel by. Scales below zero are treated as zero.
    //
    // Return:
-   //    Returns the green color value.
+   //    Returns the scaled Allegro color.
    //
    //******************************************************************************************************************
-   unsigned int Color::GetGreenColor() const
+   ALLEGRO_COLOR Color::ToScaledAllegroColor(const float aScale) const
    {
-      return mGreen;
+      float scale = std::max(aScale, 0.0F);
+      ALLEGRO_COLOR color = {channelTable.values[GetRedColor()] * scale, channelTable.values[GetGreenColor()] * scale,
+                             channelTable.values[GetBlueColor()] * scale, channelTable.values[GetAlpha()] * scale};
+      return color;
    }
-   
+
    //******************************************************************************************************************
    //
-   // Method: GetBlueColor
+   // Method: ToAllegroColors
    //
    // Description:
-   //    Returns the blue color value.
+   //    Converts a run of colors to Allegro colors, such as when filling in the colors of vertices.
    //
    // Arguments:
-   //    N/A
+   //    apColors        - The colors to convert.
+   //    aCount          - The number of colors to convert.
+   //    apAllegroColors - Updated with the converted colors. Must have room for the passed in number of colors.
    //
    // Return:
-   //    Returns the blue color value.
-   //
-   //******************************************************************************************************************
-   unsigned int Color::GetBlueColor() const
-   {
-      return mBlue;
-   }
-   
-   //******************************************************************************************************************
-   //
-   // Method: GetAlpha
-   //
-   // Description:
-   //    Returns the alpha (opacity) value.
-   //
-   // Arguments:
    //    N/A
    //
-   // Return:
-   //    Returns the alpha (opacity) value.
-   //
    //******************************************************************************************************************
-   unsigned int Color::GetAlpha() const
+   void Color::ToAllegroColors(const Color* apColors, const unsigned int aCount, ALLEGRO_COLOR* apAllegroColors)
    {
-      return mAlpha;
+      for (unsigned int i = 0; i < aCount; ++i)
+      {
+         apAllegroColors[i] = apColors[i].ToAllegroColor();
+      }
    }
 
 //*********************************************************************************************************************
@@ -212,29 +202,25 @@ namespace Bebop { namespace Graphics
 
    //******************************************************************************************************************
    //
-   // Method: VerifyRange
+   // Method: SetChannel
    //
    // Description:
-   //    Checks if the value is within the color range. If it is not, then the maximum value is set in its place.
+   //    Replaces one channel of the packed color.
    //
    // Arguments:
-   //    aValue - The value being checked to be within the color range.
+   //    aShift - The bit position of the channel in the packed color.
+   //    aValue - The value of the channel.
    //
    // Return:
-   //    Returns the finalized color value.
+   //    N/A
    //
    //******************************************************************************************************************
-   int Color::VerifyRange(const unsigned int aValue) const
+   void Color::SetChannel(const unsigned int aShift, const unsigned int aValue)
    {
-      if (aValue > MAX_COLOR_VALUE)
-      {
-         return MAX_COLOR_VALUE;
-      }
-
-      return aValue;
+      mPackedColor = (mPackedColor & ~(MAX_COLOR_VALUE << aShift)) | (aValue << aShift);
    }
 
 //*********************************************************************************************************************
 // Private Methods - End
 //*********************************************************************************************************************
-}}
\ No newline at end of file
+}}
@@ -4,29 +4,35 @@
 //
 // Description:
 //    This class handles holding information on a specific color in an RGB fashion. There is also an alpha (opacity)
-//    value correlated with the color.
+//    value correlated with the color. The channels are packed into 4 bytes with red in the lowest byte, so colors are
+//    cheap to copy and store by value. Conversions to Allegro colors look each channel up in a shared table of float
+//    values instead of converting the channels every draw.
 //
 //*********************************************************************************************************************
 
 #ifndef Color_H
 #define Color_H
 
+#include "GraphicsConstants.h"
+#include <allegro5/allegro.h>
+
 namespace Bebop { namespace Graphics
 {
    class Color
    {
-   //***************************************************************************************************************
+   //******************************************************************************************************************
    // Methods - Start
-   //***************************************************************************************************************
-   
+   //******************************************************************************************************************
+
       public:
-         
+
          //************************************************************************************************************
          //
-         // Method: Scene
+         // Method: Color
          //
          // Description:
-         //    Constructor for a color that sets the red, green, blue, and alpha properties.
+         //    Constructor for a color that sets the red, green, blue, and alpha properties. Values above the color
+         //    range are set to the maximum value.
          //
          // Arguments:
          //    aRed   - The red color value.
@@ -38,8 +44,8 @@ namespace Bebop { namespace Graphics
          //    N/A
          //
          //************************************************************************************************************
-         Color(const unsigned int aRed, const unsigned int aGreen, const unsigned int aBlue,
-               const unsigned int aAlpha);
+         constexpr Color(const unsigned int aRed, const unsigned int aGreen, const unsigned int aBlue,
+                         const unsigned int aAlpha) noexcept;
 
          //************************************************************************************************************
          //
@@ -104,7 +110,7 @@ namespace Bebop { namespace Graphics
          //
          //************************************************************************************************************
          void SetAlpha(const unsigned int aAlpha);
-      
+
          //************************************************************************************************************
          //
          // Method: GetRedColor
@@ -119,11 +125,11 @@ namespace Bebop { namespace Graphics
          //    Returns the red color value.
          //
          //************************************************************************************************************
-         unsigned int GetRedColor() const;
+         constexpr unsigned int GetRedColor() const noexcept;
 
          //************************************************************************************************************
          //
-         // Method: SetGreenColor
+         // Method: GetGreenColor
          //
          // Description:
          //    Returns the green color value.
@@ -135,7 +141,7 @@ namespace Bebop { namespace Graphics
          //    Returns the green color value.
          //
          //************************************************************************************************************
-         unsigned int GetGreenColor() const;
+         constexpr unsigned int GetGreenColor() const noexcept;
 
          //************************************************************************************************************
          //
@@ -151,7 +157,7 @@ namespace Bebop { namespace Graphics
          //    Returns the blue color value.
          //
          //************************************************************************************************************
-         unsigned int GetBlueColor() const;
+         constexpr unsigned int GetBlueColor() const noexcept;
 
          //************************************************************************************************************
          //
@@ -167,14 +173,83 @@ namespace Bebop { namespace Graphics
          //    Returns the alpha (opacity) value.
          //
          //************************************************************************************************************
-         unsigned int GetAlpha() const;
+         constexpr unsigned int GetAlpha() const noexcept;
+
+         //************************************************************************************************************
+         //
+         // Method: IsClear
+         //
+         // Description:
+         //    Checks if every channel of the color is zero, which draws nothing with premultiplied alpha blending.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    True  - Every channel is zero.
+         //    False - At least one channel has a value.
+         //
+         //************************************************************************************************************
+         constexpr bool IsClear() const noexcept;
+
+         //************************************************************************************************************
+         //
+         // Method: ToAllegroColor
+         //
+         // Description:
+         //    Converts the color to an Allegro color.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the Allegro color.
+         //
+         //************************************************************************************************************
+         ALLEGRO_COLOR ToAllegroColor() const;
+
+         //************************************************************************************************************
+         //
+         // Method: ToScaledAllegroColor
+         //
+         // Description:
+         //    Converts the color to an Allegro color with every channel, alpha included, multiplied by a scale. Used
+         //    to fade a color, such as a light dimming towards its edge.
+         //
+         // Arguments:
+         //    aScale - The amount to multiply each channel by. Scales below zero are treated as zero.
+         //
+         // Return:
+         //    Returns the scaled Allegro color.
+         //
+         //************************************************************************************************************
+         ALLEGRO_COLOR ToScaledAllegroColor(const float aScale) const;
+
+         //************************************************************************************************************
+         //
+         // Method: ToAllegroColors
+         //
+         // Description:
+         //    Converts a run of colors to Allegro colors, such as when filling in the colors of vertices.
+         //
+         // Arguments:
+         //    apColors        - The colors to convert.
+         //    aCount          - The number of colors to convert.
+         //    apAllegroColors - Updated with the converted colors. Must have room for the passed in number of colors.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         static void ToAllegroColors(const Color* apColors, const unsigned int aCount,
+                                     ALLEGRO_COLOR* apAllegroColors);
 
       protected:
-      
+
          // There are currently no protected methods for this class.
-      
+
       private:
-      
+
          //************************************************************************************************************
          //
          // Method: VerifyRange
@@ -189,42 +264,216 @@ namespace Bebop { namespace Graphics
          //    Returns the finalized color value.
          //
          //************************************************************************************************************
-         int VerifyRange(const unsigned int aValue) const;
-      
+         static constexpr unsigned int VerifyRange(const unsigned int aValue) noexcept;
+
+         //************************************************************************************************************
+         //
+         // Method: SetChannel
+         //
+         // Description:
+         //    Replaces one channel of the packed color.
+         //
+         // Arguments:
+         //    aShift - The bit position of the channel in the packed color.
+         //    aValue - The value of the channel.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void SetChannel(const unsigned int aShift, const unsigned int aValue);
+
    //******************************************************************************************************************
    // Methods - End
    //******************************************************************************************************************
-   
+
    //******************************************************************************************************************
    // Member Variables - Start
    //******************************************************************************************************************
-   
+
       public:
-      
+
          // There are currently no public member variables for this class.
-      
+
       protected:
-      
+
          // There are currently no protected member variables for this class.
-      
+
       private:
-      
-         // The value of the red part of the color.
-         unsigned int mRed;
-         
-         // The value of the green part of the color.
-         unsigned int mGreen;
 
-         // The value of the blue part of the color.
-         unsigned int mBlue;
+         // The red, green, blue, and alpha values packed one per byte, red in the lowest byte.
+         unsigned int mPackedColor;
 
-         // The value of the alpha (opacity) of the color.
-         unsigned int mAlpha;
-      
    //******************************************************************************************************************
    // Member Variables - End
    //******************************************************************************************************************
    };
+
+//*********************************************************************************************************************
+// Public Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: Color
+   //
+   // Description:
+   //    Constructor for a color that sets the red, green, blue, and alpha properties. Values above the color range are
+   //    set to the maximum value.
+   //
+   // Arguments:
+   //    aRed   - The red color value.
+   //    aGreen - The green color value.
+   //    aBlue  - The blue color value.
+   //    aAlpha - The alpha (opacity) value.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   constexpr Color::Color(const unsigned int aRed, const unsigned int aGreen, const unsigned int aBlue,
+                          const unsigned int aAlpha) noexcept :
+      mPackedColor((VerifyRange(aRed) << RED_CHANNEL_SHIFT) | (VerifyRange(aGreen) << GREEN_CHANNEL_SHIFT) |
+                   (VerifyRange(aBlue) << BLUE_CHANNEL_SHIFT) | (VerifyRange(aAlpha) << ALPHA_CHANNEL_SHIFT))
+   {
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetRedColor
+   //
+   // Description:
+   //    Returns the red color value.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the red color value.
+   //
+   //******************************************************************************************************************
+   constexpr unsigned int Color::GetRedColor() const noexcept
+   {
+      return (mPackedColor >> RED_CHANNEL_SHIFT) & MAX_COLOR_VALUE;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetGreenColor
+   //
+   // Description:
+   //    Returns the green color value.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the green color value.
+   //
+   //******************************************************************************************************************
+   constexpr unsigned int Color::GetGreenColor() const noexcept
+   {
+      return (mPackedColor >> GREEN_CHANNEL_SHIFT) & MAX_COLOR_VALUE;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetBlueColor
+   //
+   // Description:
+   //    Returns the blue color value.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the blue color value.
+   //
+   //******************************************************************************************************************
+   constexpr unsigned int Color::GetBlueColor() const noexcept
+   {
+      return (mPackedColor >> BLUE_CHANNEL_SHIFT) & MAX_COLOR_VALUE;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetAlpha
+   //
+   // Description:
+   //    Returns the alpha (opacity) value.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the alpha (opacity) value.
+   //
+   //******************************************************************************************************************
+   constexpr unsigned int Color::GetAlpha() const noexcept
+   {
+      return (mPackedColor >> ALPHA_CHANNEL_SHIFT) & MAX_COLOR_VALUE;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: IsClear
+   //
+   // Description:
+   //    Checks if every channel of the color is zero, which draws nothing with premultiplied alpha blending.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    True  - Every channel is zero.
+   //    False - At least one channel has a value.
+   //
+   //******************************************************************************************************************
+   constexpr bool Color::IsClear() const noexcept
+   {
+      return mPackedColor == 0;
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: VerifyRange
+   //
+   // Description:
+   //    Checks if the value is within the color range. If it is not, then the maximum value is set in its place.
+   //
+   // Arguments:
+   //    aValue - The value being checked to be within the color range.
+   //
+   // Return:
+   //    Returns the finalized color value.
+   //
+   //******************************************************************************************************************
+   constexpr unsigned int Color::VerifyRange(const unsigned int aValue) noexcept
+   {
+      return aValue > MAX_COLOR_VALUE ? MAX_COLOR_VALUE : aValue;
+   }
+
+//*********************************************************************************************************************
+// Private Methods - End
+//*********************************************************************************************************************
 }}
 
-#endif // Color_H
\ No newline at end of file
+#endif // Color_H
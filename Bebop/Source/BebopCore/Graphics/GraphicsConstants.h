@@ -17,6 +17,12 @@ namespace Bebop { namespace Graphics
    // The maximum value for a color value.
 	const unsigned int MAX_COLOR_VALUE = 255;
 
+   // The bit position of each channel in a packed color.
+   const unsigned int RED_CHANNEL_SHIFT = 0;
+   const unsigned int GREEN_CHANNEL_SHIFT = 8;
+   const unsigned int BLUE_CHANNEL_SHIFT = 16;
+   const unsigned int ALPHA_CHANNEL_SHIFT = 24;
+
    // The color of the light source at the edge of the light's radius.
    const ALLEGRO_COLOR LIGHTS_EDGE_COLOR = al_map_rgba(0, 0, 0, 0);
 
@@ -31,6 +37,100 @@ namespace Bebop { namespace Graphics
 
    // Both the X and Y coordinates for the scene origin point.
    const int SCENE_ORIGIN = 0;
+
+   // The empty pixels left to the right and below each image packed into a texture atlas so neighboring images do
+   // not bleed into each other when drawn scaled or rotated.
+   const int ATLAS_PADDING = 1;
+
+   // The channels of the color drawn in place of a sprite whose image is still loading in the background. The color
+   // is mapped when drawn, since Allegro cannot map colors before it is initialized.
+   const unsigned char ASSET_PLACEHOLDER_RED = 128;
+   const unsigned char ASSET_PLACEHOLDER_GREEN = 0;
+   const unsigned char ASSET_PLACEHOLDER_BLUE = 128;
+   const unsigned char ASSET_PLACEHOLDER_ALPHA = 128;
+
+   // The fewest entries in the asset loader's map of requested files before expired entries are swept out.
+   const unsigned int ASSET_SWEEP_MINIMUM_SIZE = 64;
+
+   // The starting value of the 64-bit FNV-1a hash used to key cached images by their file contents.
+   const unsigned long long FNV_OFFSET_BASIS = 14695981039346656037ULL;
+
+   // The multiplier of the 64-bit FNV-1a hash.
+   const unsigned long long FNV_PRIME = 1099511628211ULL;
+
+   // Marks a raw alpha mask cache file. Reads as "BMSK" in a hex dump.
+   const unsigned int ALPHA_MASK_CACHE_MAGIC = 0x4B534D42U;
+
+   // The layout version of raw alpha mask cache files. Files with another version are converted again.
+   const unsigned int ALPHA_MASK_CACHE_VERSION = 1;
+
+   // The number of bytes of each pixel in a raw alpha mask cache file.
+   const unsigned int ALPHA_MASK_CACHE_PIXEL_SIZE = 4;
+
+   // The sort key of a drawable item on a layer that was not given one.
+   const float DEFAULT_SORT_KEY = 0.0F;
+
+   // The number of bits of a draw order key sorted in each pass of the radix sort.
+   const unsigned int DRAW_ORDER_RADIX_BITS = 8;
+
+   // The number of buckets in each pass of the draw order radix sort.
+   const unsigned int DRAW_ORDER_RADIX_BUCKETS = 1U << DRAW_ORDER_RADIX_BITS;
+
+   // The fewest segments a batched circle is built from.
+   const unsigned int MIN_CIRCLE_SEGMENTS = 8;
+
+   // The most segments a batched circle is built from. Must be the minimum doubled a whole number of times.
+   const unsigned int MAX_CIRCLE_SEGMENTS = 128;
+
+   // The segments wanted for each square root of a circle's radius, the same quality Allegro draws circles with.
+   const float CIRCLE_SEGMENT_QUALITY = 10.0F;
+
+   // The thickness line segment objects are drawn with.
+   const float LINE_SEGMENT_THICKNESS = 1.0F;
+
+   // The default time in microseconds the lights of a layer may spend being calculated each update.
+   const unsigned int LIGHT_UPDATE_BUDGET = 4000;
+
+   // The default number of frames in a row a light may reuse its points before it is calculated regardless of the
+   // time budget.
+   const unsigned int LIGHT_MAXIMUM_STALE_FRAMES = 2;
+
+   // The number of microseconds in a second.
+   const double MICROSECONDS_PER_SECOND = 1000000.0;
+
+   // The degrees a changed sector of a light is widened by on each side so rays grazing a moved object are included.
+   const float LIGHT_SECTOR_MARGIN = 0.5F;
+
+   // The most degrees the changed sectors of a light may cover before the whole light is worked out again instead.
+   const float LIGHT_MAXIMUM_SECTOR_SPAN = 180.0F;
+
+   // The quality lights are worked out at can not be set below this.
+   const float LIGHT_LOD_MINIMUM_QUALITY = 0.1F;
+
+   // The most pixels the edge of a light may stray from a true circle between two swept rays.
+   const float LIGHT_LOD_EDGE_TOLERANCE = 2.0F;
+
+   // The fewest and most degrees between the rays swept around a light.
+   const float LIGHT_LOD_MINIMUM_SWEEP_STEP = 2.0F;
+   const float LIGHT_LOD_MAXIMUM_SWEEP_STEP = 30.0F;
+
+   // The pixels at the edge of a light the rays cast either side of a corner pass the corner by.
+   const float LIGHT_LOD_CORNER_DISTANCE = 0.5F;
+
+   // The fewest and most degrees either side of a corner the rays passing the corner are cast at.
+   const float LIGHT_LOD_MINIMUM_CORNER_OFFSET = 0.01F;
+   const float LIGHT_LOD_MAXIMUM_CORNER_OFFSET = 1.0F;
+
+   // The degrees between the rays cast at a circle as a part of the sweep step, and the fewest and most degrees.
+   const float LIGHT_LOD_CIRCLE_STEP_RATIO = 2.0F / 15.0F;
+   const float LIGHT_LOD_MINIMUM_CIRCLE_STEP = 0.5F;
+   const float LIGHT_LOD_MAXIMUM_CIRCLE_STEP = 4.0F;
+
+   // The smallest radius in pixels a light may be drawn at and still be blocked by objects.
+   const float LIGHT_LOD_SHADOW_MINIMUM_RADIUS = 8.0F;
+
+   // The width and height of each chunk bitmap the sprites of a static layer are cached in.
+   const int STATIC_LAYER_CHUNK_SIZE = 512;
 }}
 
 #endif // GraphicsConstants_H
\ No newline at end of file
@@ -17,6 +17,181 @@
 
 namespace Bebop { namespace Graphics
 {
+   namespace
+   {
+      //***************************************************************************************************************
+      //
+      // Method Name: GetObjectBounds
+      //
+      // Description:
+      //    Works out the bounding box of a light blocking object.
+      //
+      // Arguments:
+      //    apObject - The object the bounds are for.
+      //    apBounds - Updated with the object and its bounding box.
+      //
+      // Return:
+      //    N/A
+      //
+      //***************************************************************************************************************
+      void GetObjectBounds(const Objects::Object* apObject, LightBlockerBounds* apBounds)
+      {
+         apBounds->pObject = apObject;
+         if (apObject->GetObjectType() == Objects::ObjectType::CIRCLE)
+         {
+            // Circle coordinates are the center point.
+            float radius = static_cast<const Objects::CircleObject*>(apObject)->GetRadius();
+            apBounds->left = apObject->GetCoordinateX() - radius;
+            apBounds->top = apObject->GetCoordinateY() - radius;
+            apBounds->right = apObject->GetCoordinateX() + radius;
+            apBounds->bottom = apObject->GetCoordinateY() + radius;
+         }
+         else if (apObject->GetObjectType() == Objects::ObjectType::LINE_SEGMENT)
+         {
+            const Objects::LineSegmentObject* pLineSegment = static_cast<const Objects::LineSegmentObject*>(apObject);
+            Math::Vector2D<float> startPoint = pLineSegment->GetStartPoint();
+            Math::Vector2D<float> endPoint = pLineSegment->GetEndPoint();
+            apBounds->left = std::min(startPoint.GetComponentX(), endPoint.GetComponentX());
+            apBounds->top = std::min(startPoint.GetComponentY(), endPoint.GetComponentY());
+            apBounds->right = std::max(startPoint.GetComponentX(), endPoint.GetComponentX());
+            apBounds->bottom = std::max(startPoint.GetComponentY(), endPoint.GetComponentY());
+         }
+         else if (apObject->GetObjectType() == Objects::ObjectType::POLYGON)
+         {
+            const Objects::PolygonObject* pPolygon = static_cast<const Objects::PolygonObject*>(apObject);
+            apBounds->left = apBounds->right = apObject->GetCoordinateX();
+            apBounds->top = apBounds->bottom = apObject->GetCoordinateY();
+            for (unsigned int i = 0; i < pPolygon->GetPointCount(); ++i)
+            {
+               Math::Vector2D<float> point = pPolygon->GetPoint(i);
+               apBounds->left = std::min(apBounds->left, point.GetComponentX());
+               apBounds->top = std::min(apBounds->top, point.GetComponentY());
+               apBounds->right = std::max(apBounds->right, point.GetComponentX());
+               apBounds->bottom = std::max(apBounds->bottom, point.GetComponentY());
+            }
+         }
+         else
+         {
+            // Rectangle coordinates are the top left corner and other objects are described by their center points.
+            apBounds->left = apObject->GetCoordinateX();
+            apBounds->top = apObject->GetCoordinateY();
+            apBounds->right = apObject->GetCoordinateX() + (apObject->GetWidthCenterPoint() * 2);
+            apBounds->bottom = apObject->GetCoordinateY() + (apObject->GetHeightCenterPoint() * 2);
+         }
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: GetAngularExtent
+      //
+      // Description:
+      //    Works out the sector of angles a bounding box covers when seen from a point, widened by a small margin.
+      //
+      // Arguments:
+      //    aOrigin  - The point the box is seen from.
+      //    aBounds  - The bounding box.
+      //    apSector - Updated with the start and end angles of the sector in degrees. The end is never more than
+      //               180 degrees past the start.
+      //
+      // Return:
+      //    True  - The sector was worked out.
+      //    False - The box covers the point, so it is seen at every angle.
+      //
+      //***************************************************************************************************************
+      bool GetAngularExtent(const Math::Vector2D<float>& aOrigin, const LightBlockerBounds& aBounds,
+                            std::pair<float, float>* apSector)
+      {
+         float originX = aOrigin.GetComponentX();
+         float originY = aOrigin.GetComponentY();
+         if (originX >= aBounds.left && originX <= aBounds.right && originY >= aBounds.top && originY <= aBounds.bottom)
+         {
+            return false;
+         }
+
+         // The corners are measured against the direction of the box center so the sector does not wrap around.
+         float centerAngle = atan2f((aBounds.top + aBounds.bottom) * 0.5F - originY,
+                                    (aBounds.left + aBounds.right) * 0.5F - originX) * Math::DEGREES_CONVERSION;
+         float corners[][2] = {{aBounds.left, aBounds.top}, {aBounds.right, aBounds.top},
+                               {aBounds.right, aBounds.bottom}, {aBounds.left, aBounds.bottom}};
+         float minimum = 0.0F;
+         float maximum = 0.0F;
+         for (auto iterator = std::begin(corners); iterator != std::end(corners); ++iterator)
+         {
+            float difference = atan2f((*iterator)[1] - originY, (*iterator)[0] - originX) * Math::DEGREES_CONVERSION -
+                               centerAngle;
+            while (difference > 180.0F)
+            {
+               difference -= 360.0F;
+            }
+            while (difference < -180.0F)
+            {
+               difference += 360.0F;
+            }
+            minimum = std::min(minimum, difference);
+            maximum = std::max(maximum, difference);
+         }
+
+         apSector->first = centerAngle + minimum - LIGHT_SECTOR_MARGIN;
+         apSector->second = centerAngle + maximum + LIGHT_SECTOR_MARGIN;
+         return true;
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: AngleInSector
+      //
+      // Description:
+      //    Checks if an angle falls within a sector, whichever turn of the circle either is given in.
+      //
+      // Arguments:
+      //    aAngle  - The angle being checked in degrees.
+      //    aSector - The start and end angles of the sector in degrees.
+      //
+      // Return:
+      //    True  - The angle is within the sector.
+      //    False - The angle is outside of the sector.
+      //
+      //***************************************************************************************************************
+      bool AngleInSector(float aAngle, const std::pair<float, float>& aSector)
+      {
+         while (aAngle < aSector.first)
+         {
+            aAngle += 360.0F;
+         }
+         while (aAngle >= aSector.first + 360.0F)
+         {
+            aAngle -= 360.0F;
+         }
+
+         return aAngle <= aSector.second;
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: IsSameDetail
+      //
+      // Description:
+      //    Checks if two details work a light out the same way.
+      //
+      // Arguments:
+      //    aLeft  - The first detail.
+      //    aRight - The second detail.
+      //
+      // Return:
+      //    True  - The details are the same.
+      //    False - The details differ.
+      //
+      //***************************************************************************************************************
+      bool IsSameDetail(const LightDetail& aLeft, const LightDetail& aRight)
+      {
+         return aLeft.sweepStep == aRight.sweepStep && aLeft.cornerOffset == aRight.cornerOffset &&
+                aLeft.circleStep == aRight.circleStep && aLeft.castsShadows == aRight.castsShadows;
+      }
+
+      // Passed in place of the blocking objects when a light does not cast shadows.
+      const std::vector<Objects::Object*> noBlockingObjects;
+   }
+
 //*********************************************************************************************************************
 // Public Methods - Start
 //*********************************************************************************************************************
@@ -44,7 +219,9 @@ namespace Bebop { namespace Graphics
                 const int aLightIntensity, const int aAngleCenter, const int aOffset) :
       mOrigin(aOrigin), mRadius(aRadius), mLightColor(aLightColor),
       mLightIntensity(aLightIntensity), mAngleCenter(aAngleCenter), mLeftOffsetAngle(aAngleCenter - aOffset),
-      mRightOffsetAngle(aAngleCenter + aOffset)
+      mRightOffsetAngle(aAngleCenter + aOffset), mPointsOrigin(aOrigin), mStaleFrames(0),
+      mDistanceComparisons(0), mFullCalculationNeeded(true), mImportance(1.0F), mConeRejection(true),
+      mDetail(LightLevelOfDetail::ChooseDetail(aRadius, 1.0F))
    {
    }
 
@@ -147,6 +324,9 @@ namespace Bebop { namespace Graphics
       int difference = oldAngleCenter - mAngleCenter;
       mLeftOffsetAngle -= difference;
       mRightOffsetAngle -= difference;
+
+      // The angles every point was found at have changed, so the light is worked out from scratch next time.
+      mFullCalculationNeeded = true;
    }
 
    //******************************************************************************************************************
@@ -163,7 +343,7 @@ namespace Bebop { namespace Graphics
    //    N/A
    //
    //******************************************************************************************************************
-   void Light::Update(const float aElapsedTime, std::vector<Objects::Object*> aBlockingObjects)
+   void Light::Update(const float aElapsedTime, const std::vector<Objects::Object*>& aBlockingObjects)
    {
       CalculateLight(aBlockingObjects);
    }
@@ -182,18 +362,55 @@ namespace Bebop { namespace Graphics
    //    N/A
    //
    //******************************************************************************************************************
-   void Light::CalculateLight(std::vector<Objects::Object*> aBlockingObjects)
+   void Light::CalculateLight(const std::vector<Objects::Object*>& aBlockingObjects)
    {
-      mPoints.clear();
+      // The detail is picked every calculation since the global quality may have changed. Points found at another
+      // detail do not line up with the new ones, so the whole light is worked out again when it changes.
+      LightDetail detail = LightLevelOfDetail::ChooseDetail(mRadius, mImportance);
+      if (IsSameDetail(detail, mDetail) == false)
+      {
+         mDetail = detail;
+         mFullCalculationNeeded = true;
+      }
+
+      // Lights too small to cast shadows are worked out as if nothing blocked them.
+      const std::vector<Objects::Object*>& blockingObjects =
+         mDetail.castsShadows == true ? aBlockingObjects : noBlockingObjects;
+
+      // Only the sectors covered by blockers that moved are worked out again when the light itself has not changed.
+      LightRecalculation recalculation = FindChangedSectors(blockingObjects);
+      mPointsOrigin = mOrigin;
+      mStaleFrames = 0;
+      mDistanceComparisons = 0;
+      if (recalculation == LIGHT_UNCHANGED)
+      {
+         return;
+      }
+      else if (recalculation == LIGHT_SECTORS)
+      {
+         auto isChanged = [this](const std::pair<float, Math::Vector2D<float>>& aPoint)
+         {
+            return IsInChangedSectors(aPoint.first);
+         };
+         mPoints.erase(std::remove_if(mPoints.begin(), mPoints.end(), isChanged), mPoints.end());
+      }
+      else
+      {
+         mPoints.clear();
+      }
       mAnglesToCheck.clear();
       mObjects.clear();
-      Objects::CircleObject* ligthCircle = new Objects::CircleObject(mOrigin, mRadius, nullptr);
+      Objects::CircleObject* ligthCircle = new Objects::CircleObject(mOrigin, mRadius,
+                                                                     Color(NO_COLOR, NO_COLOR, NO_COLOR, NO_ALPHA));
       std::vector<Objects::Object*> mObjects;
       std::vector<Math::Vector2D<float>>* pCollisionPoints = new std::vector<Math::Vector2D<float>>;
 
+      // Distances are only compared against the radius, so squared distances are used to avoid square roots.
+      const float radiusSquared = mRadius * mRadius;
+
       // Check which objects will collide with the light and store those objects.
       bool objectLigthCollides = false;
-      for (auto objectIterator = aBlockingObjects.begin(); objectIterator != aBlockingObjects.end(); ++objectIterator)
+      for (auto objectIterator = blockingObjects.begin(); objectIterator != blockingObjects.end(); ++objectIterator)
       {
          if ((*objectIterator)->GetObjectType() == Objects::ObjectType::RECTANGLE)
          {
@@ -203,8 +420,22 @@ namespace Bebop { namespace Graphics
          {
             objectLigthCollides = Math::CircleCircleCollision(dynamic_cast<Objects::CircleObject*>(*objectIterator), ligthCircle, nullptr);
          }
+         else if ((*objectIterator)->GetObjectType() == Objects::ObjectType::LINE_SEGMENT)
+         {
+            objectLigthCollides = Math::LineSegmentCircleCollision(
+               static_cast<Objects::LineSegmentObject*>(*objectIterator), ligthCircle);
+         }
+         else if ((*objectIterator)->GetObjectType() == Objects::ObjectType::POLYGON)
+         {
+            objectLigthCollides = Math::PolygonCircleCollision(static_cast<Objects::PolygonObject*>(*objectIterator),
+                                                               ligthCircle);
+         }
 
-         if (objectLigthCollides == true)
+         // Objects outside the cone of a spot light or outside the changed sectors cannot block a ray within them. The
+         // bounds of the objects were gathered in the same order when looking for changed sectors.
+         if (objectLigthCollides == true &&
+             IsObjectInCone(mBlockerBounds[objectIterator - blockingObjects.begin()]) == true &&
+             (recalculation == LIGHT_FULL || IsObjectInChangedSectors(*objectIterator) == true))
          {
             mObjects.push_back(*objectIterator);
             objectLigthCollides = false;
@@ -276,6 +507,35 @@ namespace Bebop { namespace Graphics
             // Gather collision points for this circle.
             CircleCollisionPoints(tempCollideCircle, pCollisionPoints);
          }
+         else if ((*collideObjectIterator)->GetObjectType() == Objects::ObjectType::LINE_SEGMENT)
+         {
+            // The ends of the line segment, where it leaves the light and where it crosses the other objects in range
+            // are the only points a shadow edge can start.
+            Objects::LineSegmentObject* tempCollideSegment =
+               static_cast<Objects::LineSegmentObject*>(*collideObjectIterator);
+            pCollisionPoints->push_back(tempCollideSegment->GetStartPoint());
+            pCollisionPoints->push_back(tempCollideSegment->GetEndPoint());
+            LightEdgeCollisionPoints(tempCollideSegment->GetStartPoint(), tempCollideSegment->GetEndPoint(),
+                                     pCollisionPoints);
+            EdgeOverlapCollisionPoints(tempCollideSegment->GetStartPoint(), tempCollideSegment->GetEndPoint(),
+                                       mObjects, collideObjectIterator - mObjects.begin(), pCollisionPoints);
+         }
+         else if ((*collideObjectIterator)->GetObjectType() == Objects::ObjectType::POLYGON)
+         {
+            // Gather the corners of the polygon, where each of its edges leaves the light and where each of its edges
+            // crosses the other objects in range.
+            Objects::PolygonObject* tempCollidePolygon = static_cast<Objects::PolygonObject*>(*collideObjectIterator);
+            const unsigned int pointCount = tempCollidePolygon->GetPointCount();
+            for (unsigned int i = 0; i < pointCount; ++i)
+            {
+               pCollisionPoints->push_back(tempCollidePolygon->GetPoint(i));
+               LightEdgeCollisionPoints(tempCollidePolygon->GetPoint(i),
+                                        tempCollidePolygon->GetPoint((i + 1) % pointCount), pCollisionPoints);
+               EdgeOverlapCollisionPoints(tempCollidePolygon->GetPoint(i),
+                                          tempCollidePolygon->GetPoint((i + 1) % pointCount),
+                                          mObjects, collideObjectIterator - mObjects.begin(), pCollisionPoints);
+            }
+         }
       }
 
       // Resolve the found points to see if they can be reached.
@@ -298,14 +558,19 @@ namespace Bebop { namespace Graphics
             }
 
             // Add checks to close surrounding angles
-            mAnglesToCheck.push_back(std::make_pair(angleDegrees - 0.1F, true));
-            mAnglesToCheck.push_back(std::make_pair(angleDegrees + 0.1F, true));
-
-            // Handle the case if the point is further than the light's radius.
-            Math::Vector2D<float> circleMaxDistance(mOrigin.GetComponentX() + mRadius * cos(angleDegrees * Math::RADIANS_CONVERSION),
-                                                    mOrigin.GetComponentY() + mRadius * sin(angleDegrees * Math::RADIANS_CONVERSION));
-            if (Math::PointDistances(mOrigin, *pointIter) >
-                Math::PointDistances(mOrigin,  circleMaxDistance))
+            if (IsInChangedSectors(angleDegrees - mDetail.cornerOffset) == true)
+            {
+               mAnglesToCheck.push_back(std::make_pair(angleDegrees - mDetail.cornerOffset, true));
+            }
+            if (IsInChangedSectors(angleDegrees + mDetail.cornerOffset) == true)
+            {
+               mAnglesToCheck.push_back(std::make_pair(angleDegrees + mDetail.cornerOffset, true));
+            }
+
+            // Handle the case if the point is further than the light's radius or outside of the changed sectors.
+            ++mDistanceComparisons;
+            if (Math::PointDistancesSquared(mOrigin, *pointIter) > radiusSquared ||
+                IsInChangedSectors(angleDegrees) == false)
             {
                continue;
             }
@@ -338,6 +603,30 @@ namespace Bebop { namespace Graphics
                      break;
                   }
                }
+               // Object being checked for collision is a line segment.
+               else if ((*iter)->GetObjectType() == Objects::ObjectType::LINE_SEGMENT)
+               {
+                  if (true == Math::LineLineSegmentCollision(mOrigin,
+                                                             *pointIter,
+                                                             static_cast<Objects::LineSegmentObject*>(*iter),
+                                                             nullptr))
+                  {
+                     collidesObject = true;
+                     break;
+                  }
+               }
+               // Object being checked for collision is a polygon.
+               else if ((*iter)->GetObjectType() == Objects::ObjectType::POLYGON)
+               {
+                  if (true == Math::LinePolygonCollision(mOrigin,
+                                                         *pointIter,
+                                                         static_cast<Objects::PolygonObject*>(*iter),
+                                                         nullptr))
+                  {
+                     collidesObject = true;
+                     break;
+                  }
+               }
             }
 
             // If the ray  does not collide with an object, then add this to the vector of points for drawing.
@@ -349,11 +638,18 @@ namespace Bebop { namespace Graphics
       }
 
       // Add the angles for the sweeping points.
-      for (auto degrees = mLeftOffsetAngle; degrees < mRightOffsetAngle; degrees += 15.0F)
+      for (float degrees = static_cast<float>(mLeftOffsetAngle); degrees < mRightOffsetAngle;
+           degrees += mDetail.sweepStep)
       {
-         mAnglesToCheck.push_back(std::make_pair(degrees, false));
+         if (IsInChangedSectors(degrees) == true)
+         {
+            mAnglesToCheck.push_back(std::make_pair(degrees, false));
+         }
+      }
+      if (IsInChangedSectors(mRightOffsetAngle) == true)
+      {
+         mAnglesToCheck.push_back(std::make_pair(mRightOffsetAngle, false));
       }
-      mAnglesToCheck.push_back(std::make_pair(mRightOffsetAngle, false));
 
       // Sort the angles to check in ascending order and remove duplicates.
       std::sort(mAnglesToCheck.begin(), mAnglesToCheck.end(), [](auto &left, auto &right)
@@ -362,65 +658,126 @@ namespace Bebop { namespace Graphics
       });
       mAnglesToCheck.erase(std::unique(mAnglesToCheck.begin(), mAnglesToCheck.end()), mAnglesToCheck.end());
 
+      // Find the end of the ray at every angle first. The end is at the edge of the light, which is also the point
+      // used when no object blocks the ray. Keeping the ends in separate component arrays lets each rectangle be
+      // checked against all of the rays at once in SIMD lanes.
+      mRayEnds.Clear();
+      for (auto angleIter = mAnglesToCheck.begin(); angleIter != mAnglesToCheck.end(); ++angleIter)
+      {
+         mRayEnds.AddVector(Math::Vector2D<float>(mOrigin.GetComponentX() +
+                                                     mRadius * cos(angleIter->first * Math::RADIANS_CONVERSION),
+                                                  mOrigin.GetComponentY() +
+                                                     mRadius * sin(angleIter->first * Math::RADIANS_CONVERSION)));
+      }
+      const unsigned int rayCount = mRayEnds.GetSize();
+
+      // Keep the time along each ray of the nearest rectangle it hits. Times along the same ray are ordered the same
+      // way as the distances from the origin.
+      mNearestRayTimes.assign(rayCount, Math::NO_COLLISION_TIME);
+      mRayTimes.resize(rayCount);
+      for (auto objectIter = mObjects.begin(); objectIter != mObjects.end(); ++objectIter)
+      {
+         if ((*objectIter)->GetObjectType() == Objects::ObjectType::RECTANGLE)
+         {
+            Math::LinesRectangleCollision(mOrigin, mRayEnds.GetComponentsX(), mRayEnds.GetComponentsY(), rayCount,
+                                          static_cast<Objects::RectangleObject*>(*objectIter), mRayTimes.data());
+            for (unsigned int ray = 0; ray < rayCount; ++ray)
+            {
+               if (mRayTimes[ray] != Math::NO_COLLISION_TIME)
+               {
+                  ++mDistanceComparisons;
+                  mNearestRayTimes[ray] = std::min(mNearestRayTimes[ray], mRayTimes[ray]);
+               }
+            }
+         }
+      }
+
       // Check all angles to be checked
       Math::Vector2D<float>* collisionPoint = new Math::Vector2D<float>(0.0F, 0.0F);
       Math::Vector2D<float> tempPoint(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
-      for (auto angleIter = mAnglesToCheck.begin(); angleIter != mAnglesToCheck.end(); ++angleIter)
+      float tempDistanceSquared = std::numeric_limits<float>::max();
+      for (unsigned int ray = 0; ray < rayCount; ++ray)
       {
-         // Check the angle for the ray against every object the circle is colliding with.
+         Math::Vector2D<float> rayEndPoint = mRayEnds.GetVector(ray);
+
+         // Start from the nearest rectangle along the ray, which the other objects have to be closer than.
+         if (mNearestRayTimes[ray] != Math::NO_COLLISION_TIME)
+         {
+            tempPoint.SetComponentX(mOrigin.GetComponentX() +
+                                    (rayEndPoint.GetComponentX() - mOrigin.GetComponentX()) * mNearestRayTimes[ray]);
+            tempPoint.SetComponentY(mOrigin.GetComponentY() +
+                                    (rayEndPoint.GetComponentY() - mOrigin.GetComponentY()) * mNearestRayTimes[ray]);
+            tempDistanceSquared = Math::PointDistancesSquared(mOrigin, tempPoint);
+         }
+
+         // Check the angle for the ray against the remaining objects the circle is colliding with.
          for (auto objectIter = mObjects.begin(); objectIter != mObjects.end(); ++objectIter)
          {
-            // The object being checked is a rectangle object.
-            if ((*objectIter)->GetObjectType() == Objects::ObjectType::RECTANGLE)
+            // The object being checked is a circle object.
+            if ((*objectIter)->GetObjectType() == Objects::ObjectType::CIRCLE)
             {
-               Math::Vector2D<float> rayEndPoint(mOrigin.GetComponentX() + mRadius * cos(angleIter->first * Math::RADIANS_CONVERSION),
-                                                 mOrigin.GetComponentY() + mRadius * sin(angleIter->first * Math::RADIANS_CONVERSION));
-               // Check if the ray collides with this rectangle object.
-               if (true == Math::LineRectangleCollision(mOrigin,
-                                                        rayEndPoint,
-                                                        dynamic_cast<Objects::RectangleObject*>(*objectIter), collisionPoint))
+               // Check if the ray collides with this circle object.
+               if (true == Math::LineCircleCollision(mOrigin,
+                                                     rayEndPoint,
+                                                     dynamic_cast<Objects::CircleObject*>(*objectIter), collisionPoint))
                {
-                  if (Math::PointDistances(mOrigin, tempPoint) > Math::PointDistances(mOrigin, *collisionPoint))
+                  float collisionDistanceSquared = Math::PointDistancesSquared(mOrigin, *collisionPoint);
+                  ++mDistanceComparisons;
+                  if (tempDistanceSquared > collisionDistanceSquared)
                   {
                      tempPoint = *collisionPoint;
+                     tempDistanceSquared = collisionDistanceSquared;
                   }
                }
             }
-            // The object being checked is a circle object.
-            else if ((*objectIter)->GetObjectType() == Objects::ObjectType::CIRCLE)
+            // The object being checked is a line segment or polygon object.
+            else if ((*objectIter)->GetObjectType() == Objects::ObjectType::LINE_SEGMENT ||
+                     (*objectIter)->GetObjectType() == Objects::ObjectType::POLYGON)
             {
-               Math::Vector2D<float> rayEndPoint(mOrigin.GetComponentX() + mRadius * cos(angleIter->first * Math::RADIANS_CONVERSION),
-                                                 mOrigin.GetComponentY() + mRadius * sin(angleIter->first * Math::RADIANS_CONVERSION));
-               // Check if the ray collides with this circle object.
-               if (true == Math::LineCircleCollision(mOrigin,
-                                                     rayEndPoint,
-                                                     dynamic_cast<Objects::CircleObject*>(*objectIter), collisionPoint))
+               // Check if the ray collides with the edges of this object.
+               bool rayCollides = false;
+               if ((*objectIter)->GetObjectType() == Objects::ObjectType::LINE_SEGMENT)
+               {
+                  rayCollides = Math::LineLineSegmentCollision(mOrigin, rayEndPoint,
+                                                               static_cast<Objects::LineSegmentObject*>(*objectIter),
+                                                               collisionPoint);
+               }
+               else
+               {
+                  rayCollides = Math::LinePolygonCollision(mOrigin, rayEndPoint,
+                                                           static_cast<Objects::PolygonObject*>(*objectIter),
+                                                           collisionPoint);
+               }
+
+               if (rayCollides == true)
                {
-                  if (Math::PointDistances(mOrigin, tempPoint) > Math::PointDistances(mOrigin, *collisionPoint))
+                  float collisionDistanceSquared = Math::PointDistancesSquared(mOrigin, *collisionPoint);
+                  ++mDistanceComparisons;
+                  if (tempDistanceSquared > collisionDistanceSquared)
                   {
                      tempPoint = *collisionPoint;
+                     tempDistanceSquared = collisionDistanceSquared;
                   }
                }
             }
          }
                
          // Check to make sure the distance is not further than the distance of the light's radius.
-         Math::Vector2D<float> circleMaxDistance(mOrigin.GetComponentX() + mRadius * cos(angleIter->first * Math::RADIANS_CONVERSION),
-                                                 mOrigin.GetComponentY() + mRadius * sin(angleIter->first * Math::RADIANS_CONVERSION));
-         if (Math::PointDistances(mOrigin, tempPoint) >
-             Math::PointDistances(mOrigin, circleMaxDistance))
+         ++mDistanceComparisons;
+         if (tempDistanceSquared > radiusSquared)
          {
-            mPoints.push_back(std::make_pair(angleIter->first, circleMaxDistance));
+            mPoints.push_back(std::make_pair(mAnglesToCheck[ray].first, rayEndPoint));
          }
          // Point is within the lights distance so add the point.
          else
          {
-            mPoints.push_back(std::make_pair(angleIter->first, tempPoint));
+            mPoints.push_back(std::make_pair(mAnglesToCheck[ray].first, tempPoint));
          }
 
          // Reset distance of the point to be furthest away.
          tempPoint.SetComponentX(std::numeric_limits<float>::max());
          tempPoint.SetComponentY(std::numeric_limits<float>::max());
+         tempDistanceSquared = std::numeric_limits<float>::max();
       }
 
       // Sort the list based on degrees in ascending order.
@@ -435,6 +792,223 @@ namespace Bebop { namespace Graphics
       delete pCollisionPoints;
    }
 
+   //******************************************************************************************************************
+   //
+   // Method: GetRadius
+   //
+   // Description:
+   //    Returns the radius of the light source.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the radius of the light source.
+   //
+   //******************************************************************************************************************
+   float Light::GetRadius() const
+   {
+      return mRadius;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetMovedDistance
+   //
+   // Description:
+   //    Returns how far the light has moved since its points were last calculated. The points are drawn moved along
+   //    with the light until they are calculated again.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the distance from where the points were calculated to the light origin.
+   //
+   //******************************************************************************************************************
+   float Light::GetMovedDistance() const
+   {
+      return Math::PointDistances(mPointsOrigin, mOrigin);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: ReusePoints
+   //
+   // Description:
+   //    Keeps the points from the last calculation for another frame instead of calculating them again. The points
+   //    are drawn moved along with the light, so shadows lag behind until the light is calculated again.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void Light::ReusePoints()
+   {
+      ++mStaleFrames;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetStaleFrames
+   //
+   // Description:
+   //    Returns the number of frames in a row the points from the last calculation have been reused.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the number of frames since the points were last calculated.
+   //
+   //******************************************************************************************************************
+   unsigned int Light::GetStaleFrames() const
+   {
+      return mStaleFrames;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: IsCalculationNeeded
+   //
+   // Description:
+   //    Returns whether the light has no points it could reuse, either because it has never been calculated or because
+   //    it changed in a way that the points have to be worked out from scratch.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns true if the light must be calculated before it is drawn, false otherwise.
+   //
+   //******************************************************************************************************************
+   bool Light::IsCalculationNeeded() const
+   {
+      return mFullCalculationNeeded == true || mPoints.empty() == true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetDistanceComparisons
+   //
+   // Description:
+   //    Returns the number of distances the last calculation compared without square roots, either as squared lengths
+   //    or as times along the same ray. Each comparison is between two distances, or a distance and the radius, so each
+   //    would otherwise take two square roots.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the number of distance comparisons in the last calculation.
+   //
+   //******************************************************************************************************************
+   unsigned int Light::GetDistanceComparisons() const
+   {
+      return mDistanceComparisons;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: SetImportance
+   //
+   // Description:
+   //    Sets how much the light matters when picking how finely it is worked out. Lights that matter more are worked
+   //    out as if they were larger, so an important small light keeps its shadows and a background light can drop
+   //    them.
+   //
+   // Arguments:
+   //    aImportance - How much the light matters, where one is a normal light.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void Light::SetImportance(const float aImportance)
+   {
+      mImportance = aImportance;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: SetConeRejection
+   //
+   // Description:
+   //    Sets whether a spot light skips the objects outside of its cone before working out their points. The points
+   //    found are the same either way, so this is only turned off to measure what the skipping saves.
+   //
+   // Arguments:
+   //    aEnabled - True to skip objects outside of the cone, false to work out the points of every object.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void Light::SetConeRejection(const bool aEnabled)
+   {
+      mConeRejection = aEnabled;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetImportance
+   //
+   // Description:
+   //    Returns how much the light matters when picking how finely it is worked out.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the importance of the light.
+   //
+   //******************************************************************************************************************
+   float Light::GetImportance() const
+   {
+      return mImportance;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetDetail
+   //
+   // Description:
+   //    Returns how finely the light was worked out the last time its points were calculated.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the detail of the light.
+   //
+   //******************************************************************************************************************
+   LightDetail Light::GetDetail() const
+   {
+      return mDetail;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetPoints
+   //
+   // Description:
+   //    Returns the points found the last time the light was calculated, sorted by the angle they were found at.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the angle and position of each point of the light.
+   //
+   //******************************************************************************************************************
+   const std::vector<std::pair<float, Math::Vector2D<float>>>& Light::GetPoints() const
+   {
+      return mPoints;
+   }
+
    //******************************************************************************************************************
    //
    // Method: Draw
@@ -452,6 +1026,9 @@ namespace Bebop { namespace Graphics
    //******************************************************************************************************************
    void Light::Draw(const bool aWithColor) const
    {
+      // Points that were reused are moved by however far the light moved since they were calculated.
+      Math::Vector2D<float> offset = mOrigin - mPointsOrigin;
+
       // Iterate through all the points calculated.
       for (auto iterator = mPoints.begin(); iterator != mPoints.end(); ++iterator)
       {
@@ -460,7 +1037,7 @@ namespace Bebop { namespace Graphics
          if (isNext != mPoints.end())
          {
             auto nextPoint = iterator + 1;
-            DrawTriangle(iterator->second, nextPoint->second, aWithColor);
+            DrawTriangle(iterator->second + offset, nextPoint->second + offset, aWithColor);
          }
       }
    }
@@ -513,25 +1090,14 @@ namespace Bebop { namespace Graphics
          float firstPecentDistance = (1.0F / mRadius) * firstDistance;
          float secondPecentDistance = (1.0F / mRadius) * secondDistance;
 
-         float firstRed = mLightColor.GetRedColor() - (mLightColor.GetRedColor() * firstPecentDistance);
-         float firstGreen = mLightColor.GetGreenColor() - (mLightColor.GetGreenColor() * firstPecentDistance);
-         float firstBlue = mLightColor.GetBlueColor() - (mLightColor.GetBlueColor() * firstPecentDistance);
-         float firstAlpha = mLightColor.GetAlpha() - (mLightColor.GetAlpha() * firstPecentDistance);
-
-         float secondRed = mLightColor.GetRedColor() - (mLightColor.GetRedColor() * secondPecentDistance);
-         float secondGreen = mLightColor.GetGreenColor() - (mLightColor.GetGreenColor() * secondPecentDistance);
-         float secondBlue = mLightColor.GetBlueColor() - (mLightColor.GetBlueColor() * secondPecentDistance);
-         float secondAlpha = mLightColor.GetAlpha() - (mLightColor.GetAlpha() * secondPecentDistance);
-
-         // Add the points of the triangle along with their colors at the point.
+         // The light fades from its full color at the origin down to nothing at its radius.
          ALLEGRO_VERTEX vertex[] =
          {
-            {mOrigin.GetComponentX(), mOrigin.GetComponentY(), 0, 0, 0, al_map_rgba(mLightColor.GetRedColor(), mLightColor.GetGreenColor(),
-                                                                                    mLightColor.GetBlueColor(), mLightColor.GetAlpha())},
-            {aFirstPoint.GetComponentX(), aFirstPoint.GetComponentY(), 0, 0, 0, al_map_rgba(firstRed, firstGreen,
-                                                                                            firstBlue, firstAlpha)},
-            {aSecondPoint.GetComponentX(), aSecondPoint.GetComponentY(), 0, 0, 0, al_map_rgba(secondRed, secondGreen,
-                                                                                              secondBlue, secondAlpha)},
+            {mOrigin.GetComponentX(), mOrigin.GetComponentY(), 0, 0, 0, mLightColor.ToAllegroColor()},
+            {aFirstPoint.GetComponentX(), aFirstPoint.GetComponentY(), 0, 0, 0,
+             mLightColor.ToScaledAllegroColor(1.0F - firstPecentDistance)},
+            {aSecondPoint.GetComponentX(), aSecondPoint.GetComponentY(), 0, 0, 0,
+             mLightColor.ToScaledAllegroColor(1.0F - secondPecentDistance)},
          };
          
          // Draw the gradient triangle
@@ -573,14 +1139,15 @@ namespace Bebop { namespace Graphics
    //******************************************************************************************************************
    void Light::RectangleCollisionPoint(Math::Vector2D<float> aRectangleCoordinate, Objects::Object* aThisRectangle)
    {
-      // Get distance from the origin of the light to the point on the rectangle.
-      float distance = Math::PointDistances(mOrigin, aRectangleCoordinate);
+      // Get the squared distance from the origin of the light to the point on the rectangle.
+      float distanceSquared = Math::PointDistancesSquared(mOrigin, aRectangleCoordinate);
 
       // Point is outside light radius range.
-      if (distance > mRadius)
+      if (distanceSquared > mRadius * mRadius)
       {
          return;
       }
+      float distance = sqrtf(distanceSquared);
 
       // Check if ray to the point is reachable without passing through the rectangle. Return if it would have to pass
       // through the rectangle.
@@ -612,8 +1179,8 @@ namespace Bebop { namespace Graphics
          mPoints.push_back(std::make_pair(angleDegrees, aRectangleCoordinate));
          // Add angles close by to check so triangles drawn for the lgiht source aren't so drasticly far away from the
          // rectangle point.
-         mAnglesToCheck.push_back(std::make_pair(angleDegrees + 0.1F, true));
-         mAnglesToCheck.push_back(std::make_pair(angleDegrees - 0.1F, true));
+         mAnglesToCheck.push_back(std::make_pair(angleDegrees + mDetail.cornerOffset, true));
+         mAnglesToCheck.push_back(std::make_pair(angleDegrees - mDetail.cornerOffset, true));
       }
    }
 
@@ -672,7 +1239,8 @@ namespace Bebop { namespace Graphics
       float* x = new float;
       float* y = new float;
       Math::Vector2D<float>* collisionPoint = new Math::Vector2D<float>(0.0F, 0.0F);
-      for (float i = ccwAngleFromOrigin + 1.0F; i < cwAngleFromOrigin; i += 2.0F)
+      for (float i = ccwAngleFromOrigin + (mDetail.circleStep / 2.0F); i < cwAngleFromOrigin;
+           i += mDetail.circleStep)
       {
          Math::Vector2D<float> rayEndPoint(mOrigin.GetComponentX() + mRadius*cos(i * Math::RADIANS_CONVERSION),
                                            mOrigin.GetComponentY() + mRadius*sin(i * Math::RADIANS_CONVERSION));
@@ -741,6 +1309,28 @@ namespace Bebop { namespace Graphics
                return true;
             }
          }
+         // Object check is a line segment.
+         else if ((*iter)->GetObjectType() == Objects::ObjectType::LINE_SEGMENT)
+         {
+            if (true == Math::LineLineSegmentCollision(mOrigin,
+                                                       aEndPoint,
+                                                       static_cast<Objects::LineSegmentObject*>(*iter),
+                                                       nullptr))
+            {
+               return true;
+            }
+         }
+         // Object check is a polygon.
+         else if ((*iter)->GetObjectType() == Objects::ObjectType::POLYGON)
+         {
+            if (true == Math::LinePolygonCollision(mOrigin,
+                                                   aEndPoint,
+                                                   static_cast<Objects::PolygonObject*>(*iter),
+                                                   nullptr))
+            {
+               return true;
+            }
+         }
       }
 
       return false;
@@ -948,7 +1538,8 @@ namespace Bebop { namespace Graphics
          rectangleHorizontal->endY = apRectangle->GetCoordinateY() + apRectangle->GetHeight();
       }
 
-      Objects::CircleObject* ligthCircle = new Objects::CircleObject(mOrigin, mRadius, nullptr);
+      Objects::CircleObject* ligthCircle = new Objects::CircleObject(mOrigin, mRadius,
+                                                                     Color(NO_COLOR, NO_COLOR, NO_COLOR, NO_ALPHA));
       Math::Vector2D<float>* collisionPoint = new Math::Vector2D<float>(0.0F, 0.0F);
 
       if (rectangleHorizontal != nullptr)
@@ -994,6 +1585,323 @@ namespace Bebop { namespace Graphics
       delete collisionPoint;
    }
 
+   //******************************************************************************************************************
+   //
+   // Method: LightEdgeCollisionPoints
+   //
+   // Description:
+   //    Gather the points where the outer edge of the light source crosses an edge of a line segment or polygon.
+   //
+   // Arguments:
+   //    aEdgeStart        - The point the edge starts at.
+   //    aEdgeEnd          - The point the edge ends at.
+   //    apCollisionPoints - The collection of possible collision points known to the light source.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void Light::LightEdgeCollisionPoints(const Math::Vector2D<float>& aEdgeStart,
+                                        const Math::Vector2D<float>& aEdgeEnd,
+                                        std::vector<Math::Vector2D<float>>* apCollisionPoints)
+   {
+      // Solve for the times along the edge where the distance to the light origin equals the radius.
+      Math::Vector2D<float> edge = aEdgeEnd - aEdgeStart;
+      Math::Vector2D<float> fromOrigin = aEdgeStart - mOrigin;
+      float a = edge.Dot(edge);
+      float b = fromOrigin.Dot(edge);
+      float c = fromOrigin.Dot(fromOrigin) - (mRadius * mRadius);
+      float discriminant = (b * b) - (a * c);
+      if (a <= 0.0F || discriminant < 0.0F)
+      {
+         return;
+      }
+
+      float root = sqrtf(discriminant);
+      float crossingTimes[] = {(-b - root) / a, (-b + root) / a};
+      for (auto iterator = std::begin(crossingTimes); iterator != std::end(crossingTimes); ++iterator)
+      {
+         if (*iterator >= 0.0F && *iterator <= 1.0F)
+         {
+            float crossingTime = *iterator;
+            apCollisionPoints->push_back(
+               Math::Vector2D<float>(aEdgeStart.GetComponentX() + edge.GetComponentX() * crossingTime,
+                                     aEdgeStart.GetComponentY() + edge.GetComponentY() * crossingTime));
+         }
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: EdgeOverlapCollisionPoints
+   //
+   // Description:
+   //    Gather the points where an edge of a line segment or polygon crosses the other objects within the light's
+   //    range. Rectangles and circles are checked wherever they are in the list, since they only gather their
+   //    crossings with each other, while line segments and polygons are only checked after the object the edge
+   //    belongs to so each pair is gathered once. Every object checked is convex, so the edge crosses it at most
+   //    twice and checking from both ends of the edge finds both crossings.
+   //
+   // Arguments:
+   //    aEdgeStart        - The point the edge starts at.
+   //    aEdgeEnd          - The point the edge ends at.
+   //    aObjects          - The objects within the light's range.
+   //    aObjectIndex      - The index of the object the edge belongs to within the objects in range.
+   //    apCollisionPoints - The collection of possible collision points known to the light source.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void Light::EdgeOverlapCollisionPoints(const Math::Vector2D<float>& aEdgeStart,
+                                          const Math::Vector2D<float>& aEdgeEnd,
+                                          const std::vector<Objects::Object*>& aObjects,
+                                          std::size_t aObjectIndex,
+                                          std::vector<Math::Vector2D<float>>* apCollisionPoints)
+   {
+      Math::Vector2D<float> collisionPoint(0.0F, 0.0F);
+      for (std::size_t i = 0; i < aObjects.size(); ++i)
+      {
+         Objects::Object* pOther = aObjects[i];
+         if (pOther->GetObjectType() == Objects::ObjectType::RECTANGLE && i != aObjectIndex)
+         {
+            Objects::RectangleObject* pRectangle = static_cast<Objects::RectangleObject*>(pOther);
+            if (Math::LineRectangleCollision(aEdgeStart, aEdgeEnd, pRectangle, &collisionPoint) == true)
+            {
+               apCollisionPoints->push_back(collisionPoint);
+            }
+            if (Math::LineRectangleCollision(aEdgeEnd, aEdgeStart, pRectangle, &collisionPoint) == true)
+            {
+               apCollisionPoints->push_back(collisionPoint);
+            }
+         }
+         else if (pOther->GetObjectType() == Objects::ObjectType::CIRCLE && i != aObjectIndex)
+         {
+            Objects::CircleObject* pCircle = static_cast<Objects::CircleObject*>(pOther);
+            if (Math::LineCircleCollision(aEdgeStart, aEdgeEnd, pCircle, &collisionPoint) == true)
+            {
+               apCollisionPoints->push_back(collisionPoint);
+            }
+            if (Math::LineCircleCollision(aEdgeEnd, aEdgeStart, pCircle, &collisionPoint) == true)
+            {
+               apCollisionPoints->push_back(collisionPoint);
+            }
+         }
+         else if (pOther->GetObjectType() == Objects::ObjectType::LINE_SEGMENT && i > aObjectIndex)
+         {
+            if (Math::LineLineSegmentCollision(aEdgeStart, aEdgeEnd, static_cast<Objects::LineSegmentObject*>(pOther),
+                                               &collisionPoint) == true)
+            {
+               apCollisionPoints->push_back(collisionPoint);
+            }
+         }
+         else if (pOther->GetObjectType() == Objects::ObjectType::POLYGON && i > aObjectIndex)
+         {
+            Objects::PolygonObject* pPolygon = static_cast<Objects::PolygonObject*>(pOther);
+            if (Math::LinePolygonCollision(aEdgeStart, aEdgeEnd, pPolygon, &collisionPoint) == true)
+            {
+               apCollisionPoints->push_back(collisionPoint);
+            }
+            if (Math::LinePolygonCollision(aEdgeEnd, aEdgeStart, pPolygon, &collisionPoint) == true)
+            {
+               apCollisionPoints->push_back(collisionPoint);
+            }
+         }
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: FindChangedSectors
+   //
+   // Description:
+   //    Compares the blocking objects against their bounds when the points were last calculated and gathers the
+   //    angular sectors covered by the old and new bounds of the objects that moved, widened by the corner offset for
+   //    the rays cast beside their corners. Every point of the light is found by a ray at its own angle, so points
+   //    outside of these sectors stay the same. The whole light is worked out
+   //    again when the light itself changed, the list of objects changed, an object moved over the light origin, or
+   //    the sectors cover too much of the light to be worth splicing.
+   //
+   // Arguments:
+   //    aBlockingObjects - The objects that block the light.
+   //
+   // Return:
+   //    Returns whether nothing, the changed sectors, or the whole light has to be worked out again.
+   //
+   //******************************************************************************************************************
+   LightRecalculation Light::FindChangedSectors(const std::vector<Objects::Object*>& aBlockingObjects)
+   {
+      mChangedSectors.clear();
+      mBlockerBoundsScratch.resize(aBlockingObjects.size());
+      for (unsigned int i = 0; i < aBlockingObjects.size(); ++i)
+      {
+         GetObjectBounds(aBlockingObjects[i], &mBlockerBoundsScratch[i]);
+      }
+
+      bool isFull = mFullCalculationNeeded == true ||
+                    mOrigin.GetComponentX() != mPointsOrigin.GetComponentX() ||
+                    mOrigin.GetComponentY() != mPointsOrigin.GetComponentY() ||
+                    mBlockerBounds.size() != mBlockerBoundsScratch.size();
+      float changedSpan = 0.0F;
+      for (unsigned int i = 0; i < mBlockerBounds.size() && isFull == false; ++i)
+      {
+         const LightBlockerBounds& lastBounds = mBlockerBounds[i];
+         const LightBlockerBounds& bounds = mBlockerBoundsScratch[i];
+         if (lastBounds.pObject != bounds.pObject)
+         {
+            isFull = true;
+         }
+         else if (lastBounds.left != bounds.left || lastBounds.top != bounds.top ||
+                  lastBounds.right != bounds.right || lastBounds.bottom != bounds.bottom)
+         {
+            std::pair<float, float> lastSector;
+            std::pair<float, float> sector;
+            if (GetAngularExtent(mOrigin, lastBounds, &lastSector) == false ||
+                GetAngularExtent(mOrigin, bounds, &sector) == false)
+            {
+               isFull = true;
+            }
+            else
+            {
+               // The rays beside each corner of the object are cast the corner offset away from it, so the points
+               // they found lie just outside the bounds of the object.
+               lastSector.first -= mDetail.cornerOffset;
+               lastSector.second += mDetail.cornerOffset;
+               sector.first -= mDetail.cornerOffset;
+               sector.second += mDetail.cornerOffset;
+               mChangedSectors.push_back(lastSector);
+               mChangedSectors.push_back(sector);
+               changedSpan += (lastSector.second - lastSector.first) + (sector.second - sector.first);
+               isFull = changedSpan > LIGHT_MAXIMUM_SECTOR_SPAN;
+            }
+         }
+      }
+
+      // Keep the bounds for the next calculation.
+      std::swap(mBlockerBounds, mBlockerBoundsScratch);
+      mFullCalculationNeeded = false;
+
+      if (isFull == true)
+      {
+         mChangedSectors.clear();
+         return LIGHT_FULL;
+      }
+
+      return mChangedSectors.empty() == true ? LIGHT_UNCHANGED : LIGHT_SECTORS;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: IsInChangedSectors
+   //
+   // Description:
+   //    Checks if an angle is being worked out again. Every angle is when the whole light is.
+   //
+   // Arguments:
+   //    aAngle - The angle being checked in degrees.
+   //
+   // Return:
+   //    True  - The angle is within a changed sector or there are no changed sectors.
+   //    False - The angle is outside of the changed sectors.
+   //
+   //******************************************************************************************************************
+   bool Light::IsInChangedSectors(const float aAngle) const
+   {
+      if (mChangedSectors.empty() == true)
+      {
+         return true;
+      }
+
+      for (auto iterator = mChangedSectors.begin(); iterator != mChangedSectors.end(); ++iterator)
+      {
+         if (AngleInSector(aAngle, *iterator) == true)
+         {
+            return true;
+         }
+      }
+
+      return false;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: IsObjectInChangedSectors
+   //
+   // Description:
+   //    Checks if any part of an object is seen from the light within a changed sector, or close enough to one that
+   //    the rays cast beside its corners reach into it.
+   //
+   // Arguments:
+   //    apObject - The object being checked.
+   //
+   // Return:
+   //    True  - The object overlaps a changed sector or covers the light origin.
+   //    False - The object is outside of the changed sectors.
+   //
+   //******************************************************************************************************************
+   bool Light::IsObjectInChangedSectors(const Objects::Object* apObject) const
+   {
+      LightBlockerBounds bounds;
+      std::pair<float, float> sector;
+      GetObjectBounds(apObject, &bounds);
+      if (GetAngularExtent(mOrigin, bounds, &sector) == false)
+      {
+         return true;
+      }
+
+      // Two sectors overlap when either one starts within the other. An object just outside a changed sector can
+      // still cast the rays beside its corners into it, so each sector is widened by the corner offset again.
+      for (auto iterator = mChangedSectors.begin(); iterator != mChangedSectors.end(); ++iterator)
+      {
+         std::pair<float, float> changedSector(iterator->first - mDetail.cornerOffset,
+                                               iterator->second + mDetail.cornerOffset);
+         if (AngleInSector(sector.first, changedSector) == true || AngleInSector(changedSector.first, sector) == true)
+         {
+            return true;
+         }
+      }
+
+      return false;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: IsObjectInCone
+   //
+   // Description:
+   //    Checks if any part of an object's bounds is seen from the light within its cone, so spot lights can skip
+   //    objects behind or beside them before any of their points are worked out. Lights that shine all the way
+   //    around see every object.
+   //
+   // Arguments:
+   //    aBounds - The bounds of the object being checked.
+   //
+   // Return:
+   //    True  - The object overlaps the cone, covers the light origin, the light shines all the way around, or cone
+   //            rejection is turned off.
+   //    False - The object is outside of the cone.
+   //
+   //******************************************************************************************************************
+   bool Light::IsObjectInCone(const LightBlockerBounds& aBounds) const
+   {
+      if (mConeRejection == false || mRightOffsetAngle - mLeftOffsetAngle >= 360)
+      {
+         return true;
+      }
+
+      std::pair<float, float> sector;
+      if (GetAngularExtent(mOrigin, aBounds, &sector) == false)
+      {
+         return true;
+      }
+
+      // The points of an object are let into the light by AngleInBetween, which compares whole degrees, so the cone
+      // is widened by a degree on each side to keep every object whose points would be used. Two sectors overlap
+      // when either one starts within the other.
+      std::pair<float, float> cone(mLeftOffsetAngle - 1.0F, mRightOffsetAngle + 1.0F);
+      return AngleInSector(sector.first, cone) == true || AngleInSector(cone.first, sector) == true;
+   }
+
    //******************************************************************************************************************
    //
    // Method: AngleInBetween
@@ -11,14 +11,36 @@
 #define Light_H
 
 #include "Color.h"
+#include "LightLevelOfDetail.h"
 #include "../Objects/Object.h"
 #include <vector>
 #include "../Objects//RectangleObject.h"
 #include "../Objects//CircleObject.h"
+#include "../Objects/LineSegmentObject.h"
+#include "../Objects/PolygonObject.h"
 #include "../Math/Vector2D.h"
+#include "../Math/Vector2DArray.h"
 
 namespace Bebop { namespace Graphics
 {
+   // How much of a light has to be worked out again since its points were last calculated.
+   enum LightRecalculation
+   {
+      LIGHT_UNCHANGED,
+      LIGHT_SECTORS,
+      LIGHT_FULL
+   };
+
+   // The bounding box of an object blocking a light when the light's points were last calculated.
+   struct LightBlockerBounds
+   {
+      const Objects::Object* pObject;
+      float left;
+      float top;
+      float right;
+      float bottom;
+   };
+
    class Light
    {
    //******************************************************************************************************************
@@ -144,7 +166,7 @@ namespace Bebop { namespace Graphics
          //    N/A
          //
          //************************************************************************************************************
-         void Update(const float aElapsedTime, std::vector<Objects::Object*> aBlockingObjects);
+         void Update(const float aElapsedTime, const std::vector<Objects::Object*>& aBlockingObjects);
 
          //************************************************************************************************************
          //
@@ -160,7 +182,191 @@ namespace Bebop { namespace Graphics
          //    N/A
          //
          //************************************************************************************************************
-         void CalculateLight(std::vector<Objects::Object*> aBlockingObjects);
+         void CalculateLight(const std::vector<Objects::Object*>& aBlockingObjects);
+
+         //************************************************************************************************************
+         //
+         // Method: GetRadius
+         //
+         // Description:
+         //    Returns the radius of the light source.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the radius of the light source.
+         //
+         //************************************************************************************************************
+         float GetRadius() const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetMovedDistance
+         //
+         // Description:
+         //    Returns how far the light has moved since its points were last calculated. The points are drawn moved
+         //    along with the light until they are calculated again.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the distance from where the points were calculated to the light origin.
+         //
+         //************************************************************************************************************
+         float GetMovedDistance() const;
+
+         //************************************************************************************************************
+         //
+         // Method: ReusePoints
+         //
+         // Description:
+         //    Keeps the points from the last calculation for another frame instead of calculating them again. The
+         //    points are drawn moved along with the light, so shadows lag behind until the light is calculated again.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void ReusePoints();
+
+         //************************************************************************************************************
+         //
+         // Method: GetStaleFrames
+         //
+         // Description:
+         //    Returns the number of frames in a row the points from the last calculation have been reused.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the number of frames since the points were last calculated.
+         //
+         //************************************************************************************************************
+         unsigned int GetStaleFrames() const;
+
+         //************************************************************************************************************
+         //
+         // Method: IsCalculationNeeded
+         //
+         // Description:
+         //    Returns whether the light has no points it could reuse, either because it has never been calculated or
+         //    because it changed in a way that the points have to be worked out from scratch.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns true if the light must be calculated before it is drawn, false otherwise.
+         //
+         //************************************************************************************************************
+         bool IsCalculationNeeded() const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetDistanceComparisons
+         //
+         // Description:
+         //    Returns the number of distances the last calculation compared without square roots, either as squared
+         //    lengths or as times along the same ray. Each comparison is between two distances, or a distance and the
+         //    radius, so each would otherwise take two square roots.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the number of distance comparisons in the last calculation.
+         //
+         //************************************************************************************************************
+         unsigned int GetDistanceComparisons() const;
+
+         //************************************************************************************************************
+         //
+         // Method: SetImportance
+         //
+         // Description:
+         //    Sets how much the light matters when picking how finely it is worked out. Lights that matter more are
+         //    worked out as if they were larger, so an important small light keeps its shadows and a background light
+         //    can drop them.
+         //
+         // Arguments:
+         //    aImportance - How much the light matters, where one is a normal light.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void SetImportance(const float aImportance);
+
+         //************************************************************************************************************
+         //
+         // Method: SetConeRejection
+         //
+         // Description:
+         //    Sets whether a spot light skips the objects outside of its cone before working out their points. The
+         //    points found are the same either way, so this is only turned off to measure what the skipping saves.
+         //
+         // Arguments:
+         //    aEnabled - True to skip objects outside of the cone, false to work out the points of every object.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void SetConeRejection(const bool aEnabled);
+
+         //************************************************************************************************************
+         //
+         // Method: GetImportance
+         //
+         // Description:
+         //    Returns how much the light matters when picking how finely it is worked out.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the importance of the light.
+         //
+         //************************************************************************************************************
+         float GetImportance() const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetDetail
+         //
+         // Description:
+         //    Returns how finely the light was worked out the last time its points were calculated.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the detail of the light.
+         //
+         //************************************************************************************************************
+         LightDetail GetDetail() const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetPoints
+         //
+         // Description:
+         //    Returns the points found the last time the light was calculated, sorted by the angle they were found at.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the angle and position of each point of the light.
+         //
+         //************************************************************************************************************
+         const std::vector<std::pair<float, Math::Vector2D<float>>>& GetPoints() const;
 
          //************************************************************************************************************
          //
@@ -225,7 +431,7 @@ namespace Bebop { namespace Graphics
          //************************************************************************************************************
          void RectangleCollisionPoint(Math::Vector2D<float> aRectangleCoordinate, Objects::Object* aThisRectangle);
 
-         //******************************************************************************************************************
+   //******************************************************************************************************************
          //
          // Method: CircleCollisionPoints
          //
@@ -306,6 +512,129 @@ namespace Bebop { namespace Graphics
          void LightRectangleCollisionPoints(Objects::RectangleObject* apRectangle,
                                             std::vector<Math::Vector2D<float>>* apCollisionPoints);
 
+         //************************************************************************************************************
+         //
+         // Method: LightEdgeCollisionPoints
+         //
+         // Description:
+         //    Gather the points where the outer edge of the light source crosses an edge of a line segment or
+         //    polygon.
+         //
+         // Arguments:
+         //    aEdgeStart        - The point the edge starts at.
+         //    aEdgeEnd          - The point the edge ends at.
+         //    apCollisionPoints - The collection of possible collision points known to the light source.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void LightEdgeCollisionPoints(const Math::Vector2D<float>& aEdgeStart,
+                                       const Math::Vector2D<float>& aEdgeEnd,
+                                       std::vector<Math::Vector2D<float>>* apCollisionPoints);
+
+         //************************************************************************************************************
+         //
+         // Method: EdgeOverlapCollisionPoints
+         //
+         // Description:
+         //    Gather the points where an edge of a line segment or polygon crosses the other objects within the
+         //    light's range. Rectangles and circles are checked wherever they are in the list, since they only gather
+         //    their crossings with each other, while line segments and polygons are only checked after the object the
+         //    edge belongs to so each pair is gathered once.
+         //
+         // Arguments:
+         //    aEdgeStart        - The point the edge starts at.
+         //    aEdgeEnd          - The point the edge ends at.
+         //    aObjects          - The objects within the light's range.
+         //    aObjectIndex      - The index of the object the edge belongs to within the objects in range.
+         //    apCollisionPoints - The collection of possible collision points known to the light source.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void EdgeOverlapCollisionPoints(const Math::Vector2D<float>& aEdgeStart,
+                                         const Math::Vector2D<float>& aEdgeEnd,
+                                         const std::vector<Objects::Object*>& aObjects,
+                                         std::size_t aObjectIndex,
+                                         std::vector<Math::Vector2D<float>>* apCollisionPoints);
+
+         //************************************************************************************************************
+         //
+         // Method: FindChangedSectors
+         //
+         // Description:
+         //    Compares the blocking objects against their bounds when the points were last calculated and gathers the
+         //    angular sectors covered by the old and new bounds of the objects that moved, widened by the corner offset
+         //    for the rays cast beside their corners. Only those sectors have to be worked out again, unless the light
+         //    itself changed, the list of objects changed, an object moved over the light origin, or the sectors cover
+         //    too much of the light.
+         //
+         // Arguments:
+         //    aBlockingObjects - The objects that block the light.
+         //
+         // Return:
+         //    Returns whether nothing, the changed sectors, or the whole light has to be worked out again.
+         //
+         //************************************************************************************************************
+         LightRecalculation FindChangedSectors(const std::vector<Objects::Object*>& aBlockingObjects);
+
+         //************************************************************************************************************
+         //
+         // Method: IsInChangedSectors
+         //
+         // Description:
+         //    Checks if an angle is being worked out again. Every angle is when the whole light is.
+         //
+         // Arguments:
+         //    aAngle - The angle being checked in degrees.
+         //
+         // Return:
+         //    True  - The angle is within a changed sector or there are no changed sectors.
+         //    False - The angle is outside of the changed sectors.
+         //
+         //************************************************************************************************************
+         bool IsInChangedSectors(const float aAngle) const;
+
+         //************************************************************************************************************
+         //
+         // Method: IsObjectInChangedSectors
+         //
+         // Description:
+         //    Checks if any part of an object is seen from the light within a changed sector, or close enough to one
+         //    that the rays cast beside its corners reach into it.
+         //
+         // Arguments:
+         //    apObject - The object being checked.
+         //
+         // Return:
+         //    True  - The object overlaps a changed sector or covers the light origin.
+         //    False - The object is outside of the changed sectors.
+         //
+         //************************************************************************************************************
+         bool IsObjectInChangedSectors(const Objects::Object* apObject) const;
+
+         //************************************************************************************************************
+         //
+         // Method: IsObjectInCone
+         //
+         // Description:
+         //    Checks if any part of an object's bounds is seen from the light within its cone, so spot lights can
+         //    skip objects behind or beside them before any of their points are worked out. Lights that shine all
+         //    the way around see every object.
+         //
+         // Arguments:
+         //    aBounds - The bounds of the object being checked.
+         //
+         // Return:
+         //    True  - The object overlaps the cone, covers the light origin, the light shines all the way around, or
+         //            cone rejection is turned off.
+         //    False - The object is outside of the cone.
+         //
+         //************************************************************************************************************
+         bool IsObjectInCone(const LightBlockerBounds& aBounds) const;
+
          //************************************************************************************************************
          //
          // Method: AngleInBetween
@@ -362,6 +691,37 @@ namespace Bebop { namespace Graphics
          // The angle the right (clockwise) edge of the light is directed at.
          int mRightOffsetAngle;
 
+         // The origin of the light source when its points were last calculated.
+         Math::Vector2D<float> mPointsOrigin;
+
+         // The number of frames in a row the points from the last calculation have been reused.
+         unsigned int mStaleFrames;
+
+         // The number of distances the last calculation compared as squared lengths.
+         unsigned int mDistanceComparisons;
+
+         // Whether the light changed in a way that the points have to be worked out from scratch next time.
+         bool mFullCalculationNeeded;
+
+         // How much the light matters when picking how finely it is worked out.
+         float mImportance;
+
+         // Whether a spot light skips the objects outside of its cone before working out their points.
+         bool mConeRejection;
+
+         // How finely the light was worked out the last time its points were calculated.
+         LightDetail mDetail;
+
+         // The bounds of each blocking object when the points were last calculated, in the order they were passed.
+         std::vector<LightBlockerBounds> mBlockerBounds;
+
+         // The bounds of the blocking objects being compared, swapped with the last bounds to reuse their memory.
+         std::vector<LightBlockerBounds> mBlockerBoundsScratch;
+
+         // The angular sectors being worked out again as pairs of start and end angles in degrees. Empty when the
+         // whole light is being worked out.
+         std::vector<std::pair<float, float>> mChangedSectors;
+
          // Vector of X and Y coordinate for each point in the light radius.
          // Vector Composition: <Angle <X-Coordiante, Y-Coordinate>>
          std::vector<std::pair<float, Math::Vector2D<float>>> mPoints;
@@ -371,6 +731,16 @@ namespace Bebop { namespace Graphics
          // if the check should skip redundancy object collision (true) or not (false).
          std::vector<std::pair<float,bool>> mAnglesToCheck;
 
+         // The end point of the ray at each angle to check, kept as separate component arrays so the rectangles can
+         // be checked against many rays at once.
+         Math::Vector2DArray mRayEnds;
+
+         // The collision time of each ray against the rectangle being checked.
+         std::vector<float> mRayTimes;
+
+         // The collision time of each ray against the nearest rectangle it hits.
+         std::vector<float> mNearestRayTimes;
+
          // Vector of objects that can block a light source.
          std::vector<Objects::Object*> mObjects;
 
@@ -0,0 +1,174 @@
+//*********************************************************************************************************************
+//
+// File: LightLevelOfDetail.cpp
+//
+// Description:
+//    This class picks how finely a light is worked out from its size on the screen and how important it is. Large
+//    lights sweep more rays so their edge stays round, small lights sweep fewer, and lights too small to matter do not
+//    cast shadows at all. The quality and the scale of the world on the screen are shared by every light, so slower
+//    machines can trade shadow accuracy for frame time in one place.
+//
+//*********************************************************************************************************************
+
+#include "LightLevelOfDetail.h"
+#include "GraphicsConstants.h"
+#include "../Math/MathConstants.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Bebop { namespace Graphics
+{
+   namespace
+   {
+      // The quality and view scale shared by every light.
+      float lightQuality = 1.0F;
+      float lightViewScale = 1.0F;
+   }
+
+//*********************************************************************************************************************
+// Public Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: SetQuality
+   //
+   // Description:
+   //    Sets the quality every light is worked out at. One is the default, lower values sweep fewer rays and drop
+   //    shadows from more small lights, and higher values do the opposite.
+   //
+   // Arguments:
+   //    aQuality - The quality of the lights. Values at or below zero are treated as the lowest quality.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void LightLevelOfDetail::SetQuality(const float aQuality)
+   {
+      lightQuality = std::max(aQuality, LIGHT_LOD_MINIMUM_QUALITY);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetQuality
+   //
+   // Description:
+   //    Returns the quality every light is worked out at.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the quality of the lights.
+   //
+   //******************************************************************************************************************
+   float LightLevelOfDetail::GetQuality()
+   {
+      return lightQuality;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: SetViewScale
+   //
+   // Description:
+   //    Sets the number of screen pixels a world unit is drawn as, so lights are judged by their size on the screen.
+   //    One is the default.
+   //
+   // Arguments:
+   //    aViewScale - The screen pixels per world unit.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void LightLevelOfDetail::SetViewScale(const float aViewScale)
+   {
+      lightViewScale = aViewScale;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetViewScale
+   //
+   // Description:
+   //    Returns the number of screen pixels a world unit is drawn as.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the screen pixels per world unit.
+   //
+   //******************************************************************************************************************
+   float LightLevelOfDetail::GetViewScale()
+   {
+      return lightViewScale;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: ChooseDetail
+   //
+   // Description:
+   //    Picks how finely a light is worked out. The sweep step is the widest that keeps the edge of the light within a
+   //    set number of pixels of a true circle, and the corner offset keeps the rays passing a corner a set number of
+   //    pixels from it at the edge of the light.
+   //
+   // Arguments:
+   //    aRadius     - The radius of the light in world units.
+   //    aImportance - How much the light matters, where one is a normal light. Lights that matter more are worked
+   //                  out as if they were larger.
+   //
+   // Return:
+   //    Returns the detail to work the light out at.
+   //
+   //******************************************************************************************************************
+   LightDetail LightLevelOfDetail::ChooseDetail(const float aRadius, const float aImportance)
+   {
+      LightDetail detail;
+      float screenRadius = std::max(aRadius * lightViewScale * aImportance * lightQuality, 1.0F);
+
+      // A chord across a step of the sweep strays from the circle by the radius times one minus the cosine of half the
+      // step.
+      float tolerance = std::min(LIGHT_LOD_EDGE_TOLERANCE, screenRadius);
+      float sweepStep = 2.0F * acosf(1.0F - (tolerance / screenRadius)) * Math::DEGREES_CONVERSION;
+      detail.sweepStep = std::min(std::max(sweepStep, LIGHT_LOD_MINIMUM_SWEEP_STEP), LIGHT_LOD_MAXIMUM_SWEEP_STEP);
+
+      float cornerOffset = (LIGHT_LOD_CORNER_DISTANCE / screenRadius) * Math::DEGREES_CONVERSION;
+      detail.cornerOffset = std::min(std::max(cornerOffset, LIGHT_LOD_MINIMUM_CORNER_OFFSET),
+                                     LIGHT_LOD_MAXIMUM_CORNER_OFFSET);
+
+      detail.circleStep = std::min(std::max(detail.sweepStep * LIGHT_LOD_CIRCLE_STEP_RATIO,
+                                            LIGHT_LOD_MINIMUM_CIRCLE_STEP),
+                                   LIGHT_LOD_MAXIMUM_CIRCLE_STEP);
+
+      detail.castsShadows = screenRadius >= LIGHT_LOD_SHADOW_MINIMUM_RADIUS;
+      return detail;
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no private methods for this class.
+
+//*********************************************************************************************************************
+// Private Methods - End
+//*********************************************************************************************************************
+}}
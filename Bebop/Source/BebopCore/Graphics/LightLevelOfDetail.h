@@ -0,0 +1,162 @@
+//*********************************************************************************************************************
+//
+// File: LightLevelOfDetail.h
+//
+// Description:
+//    This class picks how finely a light is worked out from its size on the screen and how important it is. Large
+//    lights sweep more rays so their edge stays round, small lights sweep fewer, and lights too small to matter do not
+//    cast shadows at all. The quality and the scale of the world on the screen are shared by every light, so slower
+//    machines can trade shadow accuracy for frame time in one place.
+//
+//*********************************************************************************************************************
+
+#ifndef LightLevelOfDetail_H
+#define LightLevelOfDetail_H
+
+namespace Bebop { namespace Graphics
+{
+   // How finely a light is worked out.
+   struct LightDetail
+   {
+      // The degrees between the rays swept around the light.
+      float sweepStep;
+
+      // The degrees either side of a corner the rays passing the corner are cast at.
+      float cornerOffset;
+
+      // The degrees between the rays cast at the side of a circle facing the light.
+      float circleStep;
+
+      // Whether the light is blocked by objects at all.
+      bool castsShadows;
+   };
+
+   class LightLevelOfDetail
+   {
+      //***************************************************************************************************************
+      // Methods - Start
+      //***************************************************************************************************************
+
+      public:
+
+         //************************************************************************************************************
+         //
+         // Method: SetQuality
+         //
+         // Description:
+         //    Sets the quality every light is worked out at. One is the default, lower values sweep fewer rays and
+         //    drop shadows from more small lights, and higher values do the opposite.
+         //
+         // Arguments:
+         //    aQuality - The quality of the lights. Values at or below zero are treated as the lowest quality.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         static void SetQuality(const float aQuality);
+
+         //************************************************************************************************************
+         //
+         // Method: GetQuality
+         //
+         // Description:
+         //    Returns the quality every light is worked out at.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the quality of the lights.
+         //
+         //************************************************************************************************************
+         static float GetQuality();
+
+         //************************************************************************************************************
+         //
+         // Method: SetViewScale
+         //
+         // Description:
+         //    Sets the number of screen pixels a world unit is drawn as, so lights are judged by their size on the
+         //    screen. One is the default.
+         //
+         // Arguments:
+         //    aViewScale - The screen pixels per world unit.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         static void SetViewScale(const float aViewScale);
+
+         //************************************************************************************************************
+         //
+         // Method: GetViewScale
+         //
+         // Description:
+         //    Returns the number of screen pixels a world unit is drawn as.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the screen pixels per world unit.
+         //
+         //************************************************************************************************************
+         static float GetViewScale();
+
+         //************************************************************************************************************
+         //
+         // Method: ChooseDetail
+         //
+         // Description:
+         //    Picks how finely a light is worked out. The sweep step is the widest that keeps the edge of the light
+         //    within a set number of pixels of a true circle, and the corner offset keeps the rays passing a corner a
+         //    set number of pixels from it at the edge of the light.
+         //
+         // Arguments:
+         //    aRadius     - The radius of the light in world units.
+         //    aImportance - How much the light matters, where one is a normal light. Lights that matter more are
+         //                  worked out as if they were larger.
+         //
+         // Return:
+         //    Returns the detail to work the light out at.
+         //
+         //************************************************************************************************************
+         static LightDetail ChooseDetail(const float aRadius, const float aImportance);
+
+      protected:
+
+         // There are currently no protected methods for this class.
+
+      private:
+
+         // There are currently no private methods for this class.
+
+      //***************************************************************************************************************
+      // Methods - End
+      //***************************************************************************************************************
+
+      //***************************************************************************************************************
+      // Member Variables - Start
+      //***************************************************************************************************************
+
+      public:
+
+         // There are currently no public member variables for this class.
+
+      protected:
+
+         // There are currently no protected member variables for this class.
+
+      private:
+
+         // There are currently no private member variables for this class.
+
+      //***************************************************************************************************************
+      // Member Variables - End
+      //***************************************************************************************************************
+   };
+}}
+
+#endif // LightLevelOfDetail_H
@@ -0,0 +1,293 @@
+//*********************************************************************************************************************
+//
+// File: LightScheduler.cpp
+//
+// Description:
+//    This class spreads the calculation of a layer's dynamic lights over frames so many lights moving at once do not
+//    stall a single frame. Each update the lights are ordered by how large they are and how far they have moved since
+//    they were last calculated, and are calculated in that order until a time budget is spent. The rest reuse their
+//    points from the last calculation, drawn moved along with the light. A light is always calculated once it has
+//    reused its points for the maximum number of frames in a row.
+//
+//*********************************************************************************************************************
+
+#include "LightScheduler.h"
+#include "GraphicsConstants.h"
+#include <algorithm>
+
+namespace Bebop { namespace Graphics
+{
+//*********************************************************************************************************************
+// Public Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: LightScheduler
+   //
+   // Description:
+   //    Constructor for a scheduler with the default time budget and maximum number of stale frames.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   LightScheduler::LightScheduler() :
+      mBudget(LIGHT_UPDATE_BUDGET / MICROSECONDS_PER_SECOND),
+      mMaximumStaleFrames(LIGHT_MAXIMUM_STALE_FRAMES),
+      mCalculatedCount(0),
+      mDeferredCount(0),
+      mTotalDeferredCount(0),
+      mWorstStaleFrames(0)
+   {
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: ~LightScheduler
+   //
+   // Description:
+   //    Destructor for the scheduler.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   LightScheduler::~LightScheduler()
+   {
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: SetBudget
+   //
+   // Description:
+   //    Sets the time the lights may spend being calculated each update. Lights that have reused their points for the
+   //    maximum number of frames are calculated even once the budget is spent.
+   //
+   // Arguments:
+   //    aMicroseconds - The time budget in microseconds.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void LightScheduler::SetBudget(const unsigned int aMicroseconds)
+   {
+      mBudget = aMicroseconds / MICROSECONDS_PER_SECOND;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: SetMaximumStaleFrames
+   //
+   // Description:
+   //    Sets the number of frames in a row a light may reuse its points before it is calculated regardless of the time
+   //    budget. Zero calculates every light every update.
+   //
+   // Arguments:
+   //    aFrames - The maximum number of stale frames.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void LightScheduler::SetMaximumStaleFrames(const unsigned int aFrames)
+   {
+      mMaximumStaleFrames = aFrames;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: Update
+   //
+   // Description:
+   //    Calculates the most urgent dynamic lights within the time budget and has the rest reuse their points. Static
+   //    lights are skipped. Overdue lights and lights that have never been calculated come first and are always
+   //    calculated, then the rest by their radius multiplied by how far they have moved plus one, so large lights that
+   //    moved far are calculated before small ones that stood still.
+   //
+   // Arguments:
+   //    aLights          - The light components of the layer.
+   //    aBlockingObjects - The objects that block the lights.
+   //    aElapsedTime     - The time that has elapsed since last update.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void LightScheduler::Update(const std::vector<Entities::LightComponent>& aLights,
+                               const std::vector<Objects::Object*>& aBlockingObjects, const float aElapsedTime)
+   {
+      mScheduledLights.clear();
+      for (auto iterator = aLights.begin(); iterator != aLights.end(); ++iterator)
+      {
+         if (iterator->isStatic == false)
+         {
+            Light* pLight = iterator->pLight;
+            // A light with no points to reuse would draw nothing if deferred, so it is treated like an overdue one.
+            bool isOverdue = pLight->IsCalculationNeeded() == true || pLight->GetStaleFrames() >= mMaximumStaleFrames;
+            ScheduledLight scheduledLight = {pLight, isOverdue,
+                                             pLight->GetRadius() * (pLight->GetMovedDistance() + 1.0F)};
+            mScheduledLights.push_back(scheduledLight);
+         }
+      }
+
+      std::sort(mScheduledLights.begin(), mScheduledLights.end(),
+                [](const ScheduledLight& aLeft, const ScheduledLight& aRight)
+      {
+         if (aLeft.isOverdue != aRight.isOverdue)
+         {
+            return aLeft.isOverdue == true;
+         }
+
+         return aLeft.priority > aRight.priority;
+      });
+
+      mCalculatedCount = 0;
+      mDeferredCount = 0;
+      double startTime = al_get_time();
+      for (auto iterator = mScheduledLights.begin(); iterator != mScheduledLights.end(); ++iterator)
+      {
+         if (iterator->isOverdue == true || al_get_time() - startTime < mBudget)
+         {
+            iterator->pLight->Update(aElapsedTime, aBlockingObjects);
+            ++mCalculatedCount;
+         }
+         else
+         {
+            iterator->pLight->ReusePoints();
+            mWorstStaleFrames = std::max(mWorstStaleFrames, iterator->pLight->GetStaleFrames());
+            ++mDeferredCount;
+         }
+      }
+
+      mTotalDeferredCount += mDeferredCount;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetCalculatedCount
+   //
+   // Description:
+   //    Returns the number of lights calculated by the last update.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the number of calculated lights.
+   //
+   //******************************************************************************************************************
+   unsigned int LightScheduler::GetCalculatedCount() const
+   {
+      return mCalculatedCount;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetDeferredCount
+   //
+   // Description:
+   //    Returns the number of lights that reused their points in the last update.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the number of deferred lights.
+   //
+   //******************************************************************************************************************
+   unsigned int LightScheduler::GetDeferredCount() const
+   {
+      return mDeferredCount;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetTotalDeferredCount
+   //
+   // Description:
+   //    Returns the number of times a light reused its points since the statistics were last reset.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the total number of deferred calculations.
+   //
+   //******************************************************************************************************************
+   unsigned long long LightScheduler::GetTotalDeferredCount() const
+   {
+      return mTotalDeferredCount;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetWorstStaleFrames
+   //
+   // Description:
+   //    Returns the most frames in a row any light reused its points since the statistics were last reset.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the worst staleness in frames.
+   //
+   //******************************************************************************************************************
+   unsigned int LightScheduler::GetWorstStaleFrames() const
+   {
+      return mWorstStaleFrames;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: ResetStatistics
+   //
+   // Description:
+   //    Sets the total deferred count and the worst staleness back to zero.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void LightScheduler::ResetStatistics()
+   {
+      mTotalDeferredCount = 0;
+      mWorstStaleFrames = 0;
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no private methods for this class.
+
+//*********************************************************************************************************************
+// Private Methods - End
+//*********************************************************************************************************************
+}}
@@ -0,0 +1,260 @@
+//*********************************************************************************************************************
+//
+// File: LightScheduler.h
+//
+// Description:
+//    This class spreads the calculation of a layer's dynamic lights over frames so many lights moving at once do not
+//    stall a single frame. Each update the lights are ordered by how large they are and how far they have moved since
+//    they were last calculated, and are calculated in that order until a time budget is spent. The rest reuse their
+//    points from the last calculation, drawn moved along with the light. A light is always calculated once it has
+//    reused its points for the maximum number of frames in a row.
+//
+//*********************************************************************************************************************
+
+#ifndef LightScheduler_H
+#define LightScheduler_H
+
+#include "Light.h"
+#include "../Entities/Components.h"
+#include "../Objects/Object.h"
+#include <vector>
+
+namespace Bebop { namespace Graphics
+{
+   // A dynamic light waiting to be calculated along with how urgently it needs to be.
+   struct ScheduledLight
+   {
+      Light* pLight;
+      bool isOverdue;
+      float priority;
+   };
+
+   class LightScheduler
+   {
+      //***************************************************************************************************************
+      // Methods - Start
+      //***************************************************************************************************************
+
+      public:
+
+         //************************************************************************************************************
+         //
+         // Method: LightScheduler
+         //
+         // Description:
+         //    Constructor for a scheduler with the default time budget and maximum number of stale frames.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         LightScheduler();
+
+         //************************************************************************************************************
+         //
+         // Method: ~LightScheduler
+         //
+         // Description:
+         //    Destructor for the scheduler.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         ~LightScheduler();
+
+         //************************************************************************************************************
+         //
+         // Method: SetBudget
+         //
+         // Description:
+         //    Sets the time the lights may spend being calculated each update. Lights that have reused their points
+         //    for the maximum number of frames are calculated even once the budget is spent.
+         //
+         // Arguments:
+         //    aMicroseconds - The time budget in microseconds.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void SetBudget(const unsigned int aMicroseconds);
+
+         //************************************************************************************************************
+         //
+         // Method: SetMaximumStaleFrames
+         //
+         // Description:
+         //    Sets the number of frames in a row a light may reuse its points before it is calculated regardless of
+         //    the time budget. Zero calculates every light every update.
+         //
+         // Arguments:
+         //    aFrames - The maximum number of stale frames.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void SetMaximumStaleFrames(const unsigned int aFrames);
+
+         //************************************************************************************************************
+         //
+         // Method: Update
+         //
+         // Description:
+         //    Calculates the most urgent dynamic lights within the time budget and has the rest reuse their points.
+         //    Static lights are skipped. Lights that have never been calculated are always calculated.
+         //
+         // Arguments:
+         //    aLights          - The light components of the layer.
+         //    aBlockingObjects - The objects that block the lights.
+         //    aElapsedTime     - The time that has elapsed since last update.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void Update(const std::vector<Entities::LightComponent>& aLights,
+                     const std::vector<Objects::Object*>& aBlockingObjects, const float aElapsedTime);
+
+         //************************************************************************************************************
+         //
+         // Method: GetCalculatedCount
+         //
+         // Description:
+         //    Returns the number of lights calculated by the last update.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the number of calculated lights.
+         //
+         //************************************************************************************************************
+         unsigned int GetCalculatedCount() const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetDeferredCount
+         //
+         // Description:
+         //    Returns the number of lights that reused their points in the last update.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the number of deferred lights.
+         //
+         //************************************************************************************************************
+         unsigned int GetDeferredCount() const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetTotalDeferredCount
+         //
+         // Description:
+         //    Returns the number of times a light reused its points since the statistics were last reset.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the total number of deferred calculations.
+         //
+         //************************************************************************************************************
+         unsigned long long GetTotalDeferredCount() const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetWorstStaleFrames
+         //
+         // Description:
+         //    Returns the most frames in a row any light reused its points since the statistics were last reset.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the worst staleness in frames.
+         //
+         //************************************************************************************************************
+         unsigned int GetWorstStaleFrames() const;
+
+         //************************************************************************************************************
+         //
+         // Method: ResetStatistics
+         //
+         // Description:
+         //    Sets the total deferred count and the worst staleness back to zero.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void ResetStatistics();
+
+      protected:
+
+         // There are currently no protected methods for this class.
+
+      private:
+
+         // There are currently no private methods for this class.
+
+      //***************************************************************************************************************
+      // Methods - End
+      //***************************************************************************************************************
+
+      //***************************************************************************************************************
+      // Member Variables - Start
+      //***************************************************************************************************************
+
+      public:
+
+         // There are currently no public member variables for this class.
+
+      protected:
+
+         // There are currently no protected member variables for this class.
+
+      private:
+
+         // The time in seconds the lights may spend being calculated each update.
+         double mBudget;
+
+         // The number of frames in a row a light may reuse its points before it is calculated regardless of budget.
+         unsigned int mMaximumStaleFrames;
+
+         // The dynamic lights of the current update in the order they are calculated. Kept between updates so its
+         // memory is reused every frame.
+         std::vector<ScheduledLight> mScheduledLights;
+
+         // The number of lights calculated by the last update.
+         unsigned int mCalculatedCount;
+
+         // The number of lights that reused their points in the last update.
+         unsigned int mDeferredCount;
+
+         // The number of times a light reused its points since the statistics were reset.
+         unsigned long long mTotalDeferredCount;
+
+         // The most frames in a row any light reused its points since the statistics were reset.
+         unsigned int mWorstStaleFrames;
+
+      //***************************************************************************************************************
+      // Member Variables - End
+      //***************************************************************************************************************
+   };
+}}
+
+#endif // LightScheduler_H
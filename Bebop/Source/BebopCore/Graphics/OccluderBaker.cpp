@@ -0,0 +1,177 @@
+//*********************************************************************************************************************
+//
+// File: OccluderBaker.cpp
+//
+// Description:
+//    This class merges static light blocking rectangles that touch or overlap into fewer, larger rectangles. Levels
+//    built from tiles register every wall tile as its own rectangle, and the edges and corners between neighboring
+//    tiles can never cast a visible shadow, yet lights still have to check each of them. Rectangles are first joined
+//    into runs along each row, and the runs are then joined down each column where their sides line up, which leaves
+//    no edges inside a merged area.
+//
+//*********************************************************************************************************************
+
+#include "OccluderBaker.h"
+#include "GraphicsConstants.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Bebop { namespace Graphics
+{
+   namespace
+   {
+      // The sides of a rectangle being merged.
+      struct BakeRectangle
+      {
+         float left;
+         float top;
+         float right;
+         float bottom;
+      };
+
+      //***************************************************************************************************************
+      //
+      // Method: MergeRows
+      //
+      // Description:
+      //    Joins rectangles that have the same top and bottom and touch or overlap side to side.
+      //
+      // Arguments:
+      //    apRectangles - The rectangles to merge, updated with the merged rectangles.
+      //
+      // Return:
+      //    N/A
+      //
+      //***************************************************************************************************************
+      void MergeRows(std::vector<BakeRectangle>* apRectangles)
+      {
+         std::sort(apRectangles->begin(), apRectangles->end(),
+                   [](const BakeRectangle& aFirst, const BakeRectangle& aSecond)
+                   {
+                      if (aFirst.top != aSecond.top)
+                      {
+                         return aFirst.top < aSecond.top;
+                      }
+                      if (aFirst.bottom != aSecond.bottom)
+                      {
+                         return aFirst.bottom < aSecond.bottom;
+                      }
+                      return aFirst.left < aSecond.left;
+                   });
+
+         std::vector<BakeRectangle> merged;
+         for (auto iterator = apRectangles->begin(); iterator != apRectangles->end(); ++iterator)
+         {
+            if (merged.empty() == false && merged.back().top == iterator->top &&
+                merged.back().bottom == iterator->bottom && iterator->left <= merged.back().right)
+            {
+               merged.back().right = std::max(merged.back().right, iterator->right);
+            }
+            else
+            {
+               merged.push_back(*iterator);
+            }
+         }
+
+         apRectangles->swap(merged);
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method: Transpose
+      //
+      // Description:
+      //    Swaps the X and Y axes of the rectangles, so columns can be merged the same way as rows.
+      //
+      // Arguments:
+      //    apRectangles - The rectangles to transpose.
+      //
+      // Return:
+      //    N/A
+      //
+      //***************************************************************************************************************
+      void Transpose(std::vector<BakeRectangle>* apRectangles)
+      {
+         for (auto iterator = apRectangles->begin(); iterator != apRectangles->end(); ++iterator)
+         {
+            std::swap(iterator->left, iterator->top);
+            std::swap(iterator->right, iterator->bottom);
+         }
+      }
+   }
+
+//*********************************************************************************************************************
+// Public Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: MergeRectangles
+   //
+   // Description:
+   //    Merges rectangles that share a row and touch or overlap side to side, then merges the results that share the
+   //    same sides and touch or overlap top to bottom. The passed in rectangles are not changed.
+   //
+   // Arguments:
+   //    aRectangles - The rectangles to merge.
+   //    apMerged    - Updated with the merged rectangles, replacing anything it held before. The merged rectangles
+   //                  have no color.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void OccluderBaker::MergeRectangles(const std::vector<Objects::RectangleObject*>& aRectangles,
+                                       std::vector<std::unique_ptr<Objects::RectangleObject>>* apMerged)
+   {
+      std::vector<BakeRectangle> rectangles;
+      rectangles.reserve(aRectangles.size());
+      for (auto iterator = aRectangles.begin(); iterator != aRectangles.end(); ++iterator)
+      {
+         BakeRectangle rectangle = {(*iterator)->GetCoordinateX(), (*iterator)->GetCoordinateY(),
+                                    (*iterator)->GetCoordinateX() + (*iterator)->GetWidth(),
+                                    (*iterator)->GetCoordinateY() + (*iterator)->GetHeight()};
+         rectangles.push_back(rectangle);
+      }
+
+      // Join each row into runs, then join the runs down each column.
+      MergeRows(&rectangles);
+      Transpose(&rectangles);
+      MergeRows(&rectangles);
+      Transpose(&rectangles);
+
+      apMerged->clear();
+      for (auto iterator = rectangles.begin(); iterator != rectangles.end(); ++iterator)
+      {
+         apMerged->push_back(std::unique_ptr<Objects::RectangleObject>(
+            new Objects::RectangleObject(Math::Vector2D<float>(iterator->left, iterator->top),
+                                         static_cast<int>(std::lround(iterator->right - iterator->left)),
+                                         static_cast<int>(std::lround(iterator->bottom - iterator->top)),
+                                         Color(NO_COLOR, NO_COLOR, NO_COLOR, NO_ALPHA))));
+      }
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no private methods for this class.
+
+//*********************************************************************************************************************
+// Private Methods - End
+//*********************************************************************************************************************
+}}
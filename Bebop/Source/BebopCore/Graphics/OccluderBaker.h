@@ -0,0 +1,85 @@
+//*********************************************************************************************************************
+//
+// File: OccluderBaker.h
+//
+// Description:
+//    This class merges static light blocking rectangles that touch or overlap into fewer, larger rectangles. Levels
+//    built from tiles register every wall tile as its own rectangle, and the edges and corners between neighboring
+//    tiles can never cast a visible shadow, yet lights still have to check each of them. Rectangles are first joined
+//    into runs along each row, and the runs are then joined down each column where their sides line up, which leaves
+//    no edges inside a merged area.
+//
+//*********************************************************************************************************************
+
+#ifndef OccluderBaker_H
+#define OccluderBaker_H
+
+#include "../Objects/RectangleObject.h"
+#include <memory>
+#include <vector>
+
+namespace Bebop { namespace Graphics
+{
+   class OccluderBaker
+   {
+      //***************************************************************************************************************
+      // Methods - Start
+      //***************************************************************************************************************
+
+      public:
+
+         //************************************************************************************************************
+         //
+         // Method: MergeRectangles
+         //
+         // Description:
+         //    Merges rectangles that share a row and touch or overlap side to side, then merges the results that
+         //    share the same sides and touch or overlap top to bottom. The passed in rectangles are not changed.
+         //
+         // Arguments:
+         //    aRectangles - The rectangles to merge.
+         //    apMerged    - Updated with the merged rectangles, replacing anything it held before. The merged
+         //                  rectangles have no color.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         static void MergeRectangles(const std::vector<Objects::RectangleObject*>& aRectangles,
+                                     std::vector<std::unique_ptr<Objects::RectangleObject>>* apMerged);
+
+      protected:
+
+         // There are currently no protected methods for this class.
+
+      private:
+
+         // There are currently no private methods for this class.
+
+      //***************************************************************************************************************
+      // Methods - End
+      //***************************************************************************************************************
+
+      //***************************************************************************************************************
+      // Member Variables - Start
+      //***************************************************************************************************************
+
+      public:
+
+         // There are currently no public member variables for this class.
+
+      protected:
+
+         // There are currently no protected member variables for this class.
+
+      private:
+
+         // There are currently no private member variables for this class.
+
+      //***************************************************************************************************************
+      // Member Variables - End
+      //***************************************************************************************************************
+   };
+}}
+
+#endif // OccluderBaker_H
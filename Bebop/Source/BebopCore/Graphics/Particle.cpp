@@ -138,6 +138,45 @@ namespace Bebop { namespace Graphics
       mpObject->DrawForLightBlocking(aAlpha);
    }
 
+   //******************************************************************************************************************
+   //
+   // Method: AddToBatch
+   //
+   // Description:
+   //    Adds the current particle configuration to a batch of shapes drawn together later.
+   //
+   // Arguments:
+   //    apBatch - Pointer to the batch the particle is added to.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void Particle::AddToBatch(ShapeBatch* apBatch) const
+   {
+      mpObject->AddToBatch(apBatch);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AddTintedToBatch
+   //
+   // Description:
+   //    Adds a tinted version of the particle to a batch of shapes drawn together later.
+   //
+   // Arguments:
+   //    apBatch - Pointer to the batch the particle is added to.
+   //    aAlpha  - The alpha for the tint of the particle.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void Particle::AddTintedToBatch(ShapeBatch* apBatch, unsigned int aAlpha) const
+   {
+      mpObject->AddToBatchForLightBlocking(apBatch, aAlpha);
+   }
+
 //*********************************************************************************************************************
 // Public Methods - End
 //*********************************************************************************************************************
@@ -121,6 +121,39 @@ namespace Bebop { namespace Graphics
          //************************************************************************************************************
          void DrawTinted(unsigned int aAlpha);
 
+         //************************************************************************************************************
+         //
+         // Method: AddToBatch
+         //
+         // Description:
+         //    Adds the current particle configuration to a batch of shapes drawn together later.
+         //
+         // Arguments:
+         //    apBatch - Pointer to the batch the particle is added to.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void AddToBatch(ShapeBatch* apBatch) const;
+
+         //************************************************************************************************************
+         //
+         // Method: AddTintedToBatch
+         //
+         // Description:
+         //    Adds a tinted version of the particle to a batch of shapes drawn together later.
+         //
+         // Arguments:
+         //    apBatch - Pointer to the batch the particle is added to.
+         //    aAlpha  - The alpha for the tint of the particle.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void AddTintedToBatch(ShapeBatch* apBatch, unsigned int aAlpha) const;
+
       protected:
 
          // There are currently no protected methods for this class.
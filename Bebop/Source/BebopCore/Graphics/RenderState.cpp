@@ -0,0 +1,285 @@
+//*********************************************************************************************************************
+//
+// File: RenderState.cpp
+//
+// Description:
+//    This class caches the Allegro drawing state, which is the target bitmap, the blender, and the clipping rectangle
+//    of the target, and skips calls that would set the state to what it already is. Graphics classes change the state
+//    through this class rather than calling Allegro directly so the cache stays correct. Allegro keeps the state per
+//    thread, so each thread has its own cache. The number of changes that were skipped is counted.
+//
+//*********************************************************************************************************************
+
+#include "RenderState.h"
+
+namespace Bebop { namespace Graphics
+{
+   namespace
+   {
+      // The drawing state last passed on to Allegro by a thread. The clipping rectangle belongs to the target bitmap,
+      // so it is forgotten whenever the target changes.
+      struct CachedRenderState
+      {
+         bool targetKnown;
+         ALLEGRO_BITMAP* pTarget;
+         bool blendModeKnown;
+         BlendMode blendMode;
+         bool clippingKnown;
+         int clipX;
+         int clipY;
+         int clipWidth;
+         int clipHeight;
+         unsigned long long avoidedChangeCount;
+      };
+
+      thread_local CachedRenderState cachedState =
+         {false, nullptr, false, BLEND_PREMULTIPLIED_ALPHA, false, 0, 0, 0, 0, 0};
+   }
+
+//*********************************************************************************************************************
+// Public Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: SetTargetBitmap
+   //
+   // Description:
+   //    Sets the bitmap drawn onto, unless it already is the target.
+   //
+   // Arguments:
+   //    apBitmap - The bitmap to draw onto.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void RenderState::SetTargetBitmap(ALLEGRO_BITMAP* apBitmap)
+   {
+      if (cachedState.targetKnown == true && cachedState.pTarget == apBitmap)
+      {
+         ++cachedState.avoidedChangeCount;
+         return;
+      }
+
+      al_set_target_bitmap(apBitmap);
+      cachedState.targetKnown = true;
+      cachedState.pTarget = apBitmap;
+      cachedState.clippingKnown = false;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetTargetBitmap
+   //
+   // Description:
+   //    Returns the bitmap drawn onto, asking Allegro only when the target is not known.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the target bitmap.
+   //
+   //******************************************************************************************************************
+   ALLEGRO_BITMAP* RenderState::GetTargetBitmap()
+   {
+      if (cachedState.targetKnown == false)
+      {
+         cachedState.pTarget = al_get_target_bitmap();
+         cachedState.targetKnown = true;
+      }
+
+      return cachedState.pTarget;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: SetBlendMode
+   //
+   // Description:
+   //    Sets the blender, unless it already is the blender in use.
+   //
+   // Arguments:
+   //    aBlendMode - The blender to use.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void RenderState::SetBlendMode(const BlendMode aBlendMode)
+   {
+      if (cachedState.blendModeKnown == true && cachedState.blendMode == aBlendMode)
+      {
+         ++cachedState.avoidedChangeCount;
+         return;
+      }
+
+      if (aBlendMode == BLEND_ALPHA)
+      {
+         al_set_blender(ALLEGRO_ADD, ALLEGRO_ALPHA, ALLEGRO_INVERSE_ALPHA);
+      }
+      else if (aBlendMode == BLEND_SUBTRACT_ALPHA)
+      {
+         al_set_blender(ALLEGRO_DEST_MINUS_SRC, ALLEGRO_ALPHA, ALLEGRO_INVERSE_ALPHA);
+      }
+      else if (aBlendMode == BLEND_COPY)
+      {
+         al_set_blender(ALLEGRO_ADD, ALLEGRO_ONE, ALLEGRO_ZERO);
+      }
+      else if (aBlendMode == BLEND_STRAIGHT_TO_PREMULTIPLIED)
+      {
+         al_set_separate_blender(ALLEGRO_ADD, ALLEGRO_ALPHA, ALLEGRO_INVERSE_ALPHA,
+                                 ALLEGRO_ADD, ALLEGRO_ONE, ALLEGRO_INVERSE_ALPHA);
+      }
+      else
+      {
+         al_set_blender(ALLEGRO_ADD, ALLEGRO_ONE, ALLEGRO_INVERSE_ALPHA);
+      }
+
+      cachedState.blendModeKnown = true;
+      cachedState.blendMode = aBlendMode;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: SetClippingRectangle
+   //
+   // Description:
+   //    Limits drawing on the target bitmap to a rectangle, unless the target is already clipped to it.
+   //
+   // Arguments:
+   //    aX      - The X-Coordinate of the rectangle on the target.
+   //    aY      - The Y-Coordinate of the rectangle on the target.
+   //    aWidth  - The width of the rectangle.
+   //    aHeight - The height of the rectangle.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void RenderState::SetClippingRectangle(const int aX, const int aY, const int aWidth, const int aHeight)
+   {
+      if (cachedState.clippingKnown == true && cachedState.clipX == aX && cachedState.clipY == aY &&
+          cachedState.clipWidth == aWidth && cachedState.clipHeight == aHeight)
+      {
+         ++cachedState.avoidedChangeCount;
+         return;
+      }
+
+      al_set_clipping_rectangle(aX, aY, aWidth, aHeight);
+      cachedState.clippingKnown = true;
+      cachedState.clipX = aX;
+      cachedState.clipY = aY;
+      cachedState.clipWidth = aWidth;
+      cachedState.clipHeight = aHeight;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: ResetClippingRectangle
+   //
+   // Description:
+   //    Lets drawing cover the whole target bitmap again.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void RenderState::ResetClippingRectangle()
+   {
+      ALLEGRO_BITMAP* pTarget = GetTargetBitmap();
+      if (pTarget != nullptr)
+      {
+         SetClippingRectangle(0, 0, al_get_bitmap_width(pTarget), al_get_bitmap_height(pTarget));
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: Invalidate
+   //
+   // Description:
+   //    Forgets the cached state of the calling thread so the next change of each state is passed on to Allegro. Must
+   //    be called after Allegro changes the state outside of this class, such as when a display is created.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void RenderState::Invalidate()
+   {
+      cachedState.targetKnown = false;
+      cachedState.blendModeKnown = false;
+      cachedState.clippingKnown = false;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetAvoidedChangeCount
+   //
+   // Description:
+   //    Returns the number of state changes on the calling thread that were skipped because the state was already
+   //    set.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the number of skipped changes since the count was last reset.
+   //
+   //******************************************************************************************************************
+   unsigned long long RenderState::GetAvoidedChangeCount()
+   {
+      return cachedState.avoidedChangeCount;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: ResetAvoidedChangeCount
+   //
+   // Description:
+   //    Sets the count of skipped state changes on the calling thread back to zero.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void RenderState::ResetAvoidedChangeCount()
+   {
+      cachedState.avoidedChangeCount = 0;
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no private methods for this class.
+
+//*********************************************************************************************************************
+// Private Methods - End
+//*********************************************************************************************************************
+}}
@@ -0,0 +1,208 @@
+//*********************************************************************************************************************
+//
+// File: RenderState.h
+//
+// Description:
+//    This class caches the Allegro drawing state, which is the target bitmap, the blender, and the clipping rectangle
+//    of the target, and skips calls that would set the state to what it already is. Graphics classes change the state
+//    through this class rather than calling Allegro directly so the cache stays correct. Allegro keeps the state per
+//    thread, so each thread has its own cache. The number of changes that were skipped is counted.
+//
+//*********************************************************************************************************************
+
+#ifndef RenderState_H
+#define RenderState_H
+
+#include <allegro5/allegro.h>
+
+namespace Bebop { namespace Graphics
+{
+   // The blenders used by the graphics classes. Bitmaps hold premultiplied alpha, so the default blender adds the
+   // source as is and scales the destination by the inverse of the source alpha. The straight to premultiplied
+   // blender draws colors that are not premultiplied onto a bitmap so the bitmap holds premultiplied alpha
+   // afterwards.
+   enum BlendMode
+   {
+      BLEND_PREMULTIPLIED_ALPHA,
+      BLEND_ALPHA,
+      BLEND_SUBTRACT_ALPHA,
+      BLEND_COPY,
+      BLEND_STRAIGHT_TO_PREMULTIPLIED
+   };
+
+   class RenderState
+   {
+      //***************************************************************************************************************
+      // Methods - Start
+      //***************************************************************************************************************
+
+      public:
+
+         //************************************************************************************************************
+         //
+         // Method: SetTargetBitmap
+         //
+         // Description:
+         //    Sets the bitmap drawn onto, unless it already is the target.
+         //
+         // Arguments:
+         //    apBitmap - The bitmap to draw onto.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         static void SetTargetBitmap(ALLEGRO_BITMAP* apBitmap);
+
+         //************************************************************************************************************
+         //
+         // Method: GetTargetBitmap
+         //
+         // Description:
+         //    Returns the bitmap drawn onto, asking Allegro only when the target is not known.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the target bitmap.
+         //
+         //************************************************************************************************************
+         static ALLEGRO_BITMAP* GetTargetBitmap();
+
+         //************************************************************************************************************
+         //
+         // Method: SetBlendMode
+         //
+         // Description:
+         //    Sets the blender, unless it already is the blender in use.
+         //
+         // Arguments:
+         //    aBlendMode - The blender to use.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         static void SetBlendMode(const BlendMode aBlendMode);
+
+         //************************************************************************************************************
+         //
+         // Method: SetClippingRectangle
+         //
+         // Description:
+         //    Limits drawing on the target bitmap to a rectangle, unless the target is already clipped to it.
+         //
+         // Arguments:
+         //    aX      - The X-Coordinate of the rectangle on the target.
+         //    aY      - The Y-Coordinate of the rectangle on the target.
+         //    aWidth  - The width of the rectangle.
+         //    aHeight - The height of the rectangle.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         static void SetClippingRectangle(const int aX, const int aY, const int aWidth, const int aHeight);
+
+         //************************************************************************************************************
+         //
+         // Method: ResetClippingRectangle
+         //
+         // Description:
+         //    Lets drawing cover the whole target bitmap again.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         static void ResetClippingRectangle();
+
+         //************************************************************************************************************
+         //
+         // Method: Invalidate
+         //
+         // Description:
+         //    Forgets the cached state of the calling thread so the next change of each state is passed on to Allegro.
+         //    Must be called after Allegro changes the state outside of this class, such as when a display is created.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         static void Invalidate();
+
+         //************************************************************************************************************
+         //
+         // Method: GetAvoidedChangeCount
+         //
+         // Description:
+         //    Returns the number of state changes on the calling thread that were skipped because the state was
+         //    already set.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the number of skipped changes since the count was last reset.
+         //
+         //************************************************************************************************************
+         static unsigned long long GetAvoidedChangeCount();
+
+         //************************************************************************************************************
+         //
+         // Method: ResetAvoidedChangeCount
+         //
+         // Description:
+         //    Sets the count of skipped state changes on the calling thread back to zero.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         static void ResetAvoidedChangeCount();
+
+      protected:
+
+         // There are currently no protected methods for this class.
+
+      private:
+
+         // There are currently no private methods for this class.
+
+      //***************************************************************************************************************
+      // Methods - End
+      //***************************************************************************************************************
+
+      //***************************************************************************************************************
+      // Member Variables - Start
+      //***************************************************************************************************************
+
+      public:
+
+         // There are currently no public member variables for this class.
+
+      protected:
+
+         // There are currently no protected member variables for this class.
+
+      private:
+
+         // There are currently no private member variables for this class.
+
+      //***************************************************************************************************************
+      // Member Variables - End
+      //***************************************************************************************************************
+   };
+}}
+
+#endif // RenderState_H
@@ -11,6 +11,8 @@
 
 #include "Scene.h"
 #include "GraphicsConstants.h"
+#include "RenderState.h"
+#include <algorithm>
 
 namespace Bebop { namespace Graphics
 {
@@ -54,6 +56,11 @@ namespace Bebop { namespace Graphics
    Scene::~Scene()
    {
       RemoveShadowMap();
+
+      for (auto iterator = mLayers.begin(); iterator != mLayers.end(); ++iterator)
+      {
+         delete iterator->second;
+      }
    }
 
    //******************************************************************************************************************
@@ -115,9 +122,15 @@ namespace Bebop { namespace Graphics
    //******************************************************************************************************************
    void Scene::AddNewLayer(int aLayerID)
    {
-      if (mLayers.find(aLayerID) == mLayers.end())
+      auto iterator = std::lower_bound(mLayers.begin(), mLayers.end(), aLayerID,
+                                       [](const std::pair<int, SceneLayer*>& aLayer, const int aID)
+                                       {
+                                          return aLayer.first < aID;
+                                       });
+
+      if (iterator == mLayers.end() || iterator->first != aLayerID)
       {
-         mLayers.insert(std::pair<int, SceneLayer*>(aLayerID, new SceneLayer()));
+         mLayers.insert(iterator, std::pair<int, SceneLayer*>(aLayerID, new SceneLayer()));
       }
    }
 
@@ -126,7 +139,7 @@ namespace Bebop { namespace Graphics
    // Method: GetLayer
    //
    // Description:
-   //    TODO: Add description.
+   //    Finds a layer of the scene by its identifier.
    //
    // Arguments:
    //    aLayerID - The identifier for the layer.
@@ -137,9 +150,15 @@ namespace Bebop { namespace Graphics
    //******************************************************************************************************************
    SceneLayer* Scene::GetLayer(int aLayerID)
    {
-      if (mLayers.find(aLayerID) != mLayers.end())
+      auto iterator = std::lower_bound(mLayers.begin(), mLayers.end(), aLayerID,
+                                       [](const std::pair<int, SceneLayer*>& aLayer, const int aID)
+                                       {
+                                          return aLayer.first < aID;
+                                       });
+
+      if (iterator != mLayers.end() && iterator->first == aLayerID)
       {
-         return mLayers[aLayerID];
+         return iterator->second;
       }
 
       return nullptr;
@@ -222,16 +241,16 @@ namespace Bebop { namespace Graphics
    void Scene::ResetShadowMap() const
    {
       // Retain the display bitmap information.
-      ALLEGRO_BITMAP* displayBitmap = al_get_target_bitmap();
+      ALLEGRO_BITMAP* displayBitmap = RenderState::GetTargetBitmap();
 
       // Set bitmap to the shadow layer and clear it.
-      al_set_target_bitmap(mpShadowMap);
+      RenderState::SetTargetBitmap(mpShadowMap);
 
       // TODO: This should be temprary 0 alpha. Eventually update to change this with a scene call.
       al_clear_to_color(al_map_rgba(NO_COLOR, NO_COLOR, NO_COLOR, 255));
 
       // Set the target bitmap back to the main display and reset the blending options.
-      al_set_target_bitmap(displayBitmap);
+      RenderState::SetTargetBitmap(displayBitmap);
    }
 
 //*********************************************************************************************************************
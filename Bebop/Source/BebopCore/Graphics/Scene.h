@@ -14,7 +14,7 @@
 
 #include "Sprite.h"
 #include <vector>
-#include <map>
+#include <utility>
 #include "SceneLayer.h"
 #include "AnimatedSprite.h"
 #include "Particle.h"
@@ -116,7 +116,7 @@ namespace Bebop { namespace Graphics
          // Method: GetLayer
          //
          // Description:
-         //    TODO: Add description.
+         //    Finds a layer of the scene by its identifier.
          //
          // Arguments:
          //    aLayerID - The identifier for the layer.
@@ -185,8 +185,9 @@ namespace Bebop { namespace Graphics
 
       private:
 
-         // Map containing the layers within a scene,
-         std::map<int, SceneLayer*> mLayers;
+         // The layers within a scene paired with their identifiers, kept sorted by identifier so the layers are
+         // updated and drawn in order and found with a binary search.
+         std::vector<std::pair<int, SceneLayer*>> mLayers;
 
          // The shadowmap that is overlaid ontop of the scene to simulate light and darkness of a scene.
          ALLEGRO_BITMAP* mpShadowMap;
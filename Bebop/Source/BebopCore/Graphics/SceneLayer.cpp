@@ -12,9 +12,92 @@
 
 #include "SceneLayer.h"
 #include "GraphicsConstants.h"
+#include "RenderState.h"
+#include "OccluderBaker.h"
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <limits>
 
 namespace Bebop { namespace Graphics
 {
+   namespace
+   {
+      //***************************************************************************************************************
+      //
+      // Method Name: SortKeyToBits
+      //
+      // Description:
+      //    Converts a sort key into an unsigned value that orders the same way as the float. The sign bit of positive
+      //    values is set and every bit of negative values is flipped, so negative values sort before positive ones
+      //    and larger negative values sort first.
+      //
+      // Arguments:
+      //    aSortKey - The sort key being converted.
+      //
+      // Return:
+      //    Returns the ordered bits of the sort key.
+      //
+      //***************************************************************************************************************
+      unsigned int SortKeyToBits(const float aSortKey)
+      {
+         unsigned int bits = 0;
+         std::memcpy(&bits, &aSortKey, sizeof(bits));
+
+         if ((bits & 0x80000000U) != 0)
+         {
+            return ~bits;
+         }
+
+         return bits | 0x80000000U;
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: MatchesSize
+      //
+      // Description:
+      //    Checks if a baked map exists and is the size of the bitmap it is drawn onto.
+      //
+      // Arguments:
+      //    apMap   - The baked map, or nullptr if it has not been baked.
+      //    aWidth  - The width the map must be.
+      //    aHeight - The height the map must be.
+      //
+      // Return:
+      //    True  - The map exists and is the given size.
+      //    False - The map does not exist or is a different size.
+      //
+      //***************************************************************************************************************
+      bool MatchesSize(ALLEGRO_BITMAP* apMap, const int aWidth, const int aHeight)
+      {
+         return apMap != nullptr && al_get_bitmap_width(apMap) == aWidth && al_get_bitmap_height(apMap) == aHeight;
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: ShowFrame
+      //
+      // Description:
+      //    Moves the sprite component of an animated sprite instance onto a frame of its clip.
+      //
+      // Arguments:
+      //    aFrame   - The frame being shown.
+      //    apSprite - The sprite component of the instance.
+      //
+      // Return:
+      //    N/A
+      //
+      //***************************************************************************************************************
+      void ShowFrame(const AnimationFrame& aFrame, Entities::SpriteComponent* apSprite)
+      {
+         apSprite->sourceX = aFrame.x;
+         apSprite->sourceY = aFrame.y;
+         apSprite->width = aFrame.width;
+         apSprite->height = aFrame.height;
+      }
+   }
+
 //*********************************************************************************************************************
 // Public Methods - Start
 //*********************************************************************************************************************
@@ -33,7 +116,25 @@ namespace Bebop { namespace Graphics
    //    N/A
    //
    //******************************************************************************************************************
-   SceneLayer::SceneLayer()
+   SceneLayer::SceneLayer() :
+      mNextDrawSequence(0),
+      mDrawOrderChanged(false),
+      mStaticSpritesChanged(false),
+      mLightBlockersChanged(false),
+      mClockTime(0.0),
+      mStaticOccluderCount(0),
+      mStaticLightingChanged(false),
+      mStaticLightMapStale(false),
+      mStaticShadowMapStale(false),
+      mStaticLightCount(0),
+      mpStaticLightMap(nullptr),
+      mpStaticShadowMap(nullptr),
+      mIsStatic(false),
+      mStaticAreaWidth(0),
+      mStaticAreaHeight(0),
+      mStaticCacheWidth(0),
+      mStaticCacheHeight(0),
+      mStaticChunkColumns(0)
    {
    }
 
@@ -53,6 +154,17 @@ namespace Bebop { namespace Graphics
    //******************************************************************************************************************
    SceneLayer::~SceneLayer()
    {
+      if (mpStaticLightMap != nullptr)
+      {
+         al_destroy_bitmap(mpStaticLightMap);
+      }
+
+      if (mpStaticShadowMap != nullptr)
+      {
+         al_destroy_bitmap(mpStaticShadowMap);
+      }
+
+      ReleaseStaticCache();
    }
 
    //******************************************************************************************************************
@@ -66,16 +178,22 @@ namespace Bebop { namespace Graphics
    //    apSprite - The sprite being added for this layer.
    //
    // Return:
-   //    N/A
+   //    Returns the handle of the entity for the item, which is the existing handle if the item is already on
+   //    the layer, or INVALID_ENTITY if the layer has no room for another entity.
    //
    //******************************************************************************************************************
-   void SceneLayer::AddSprite(Sprite* apSprite)
+   Entities::Entity SceneLayer::AddSprite(Sprite* apSprite)
    {
-      auto iter = std::find(mSprites.begin(), mSprites.end(), apSprite);
-      if (iter == mSprites.end())
+      Entities::Entity entity = Entities::INVALID_ENTITY;
+      if (CreateItemEntity(apSprite, &entity) == true)
       {
-         mSprites.push_back(apSprite);
+         Entities::SpriteAdapterComponent component = {apSprite};
+         mEntities.GetSpriteAdapters().AddComponent(entity, component);
+         mDrawOrderChanged = true;
+         mStaticSpritesChanged = true;
       }
+
+      return entity;
    }
 
    //******************************************************************************************************************
@@ -94,11 +212,7 @@ namespace Bebop { namespace Graphics
    //******************************************************************************************************************
    void SceneLayer::RemoveSprite(Sprite* apSprite)
    {
-      auto iter = std::find(mSprites.begin(), mSprites.end(), apSprite);
-      if (iter != mSprites.end())
-      {
-         mSprites.erase(iter);
-      }
+      DestroyItemEntity(apSprite);
    }
 
    //******************************************************************************************************************
@@ -106,22 +220,37 @@ namespace Bebop { namespace Graphics
    // Method: AddAnimatedSprite
    //
    // Description:
-   //    Adds an animated sprite to the scene layer.
+   //    Adds an animated sprite to the scene layer. A sprite played from the clock is kept apart from the sprites with
+   //    their own timer and never updated. A sprite switched to the clock with PlayFromClock after it is added is moved
+   //    over on the next update. A sprite switched back with Play is moved back when it is next drawn, and is updated
+   //    from the update after that.
    //
    // Arguments:
    //    apAniamtedSprite - The animated being added for this layer.
    //
    // Return:
-   //    N/A
+   //    Returns the handle of the entity for the item, which is the existing handle if the item is already on
+   //    the layer, or INVALID_ENTITY if the layer has no room for another entity.
    //
    //******************************************************************************************************************
-   void SceneLayer::AddAnimatedSprite(AnimatedSprite* apAniamtedSprite)
+   Entities::Entity SceneLayer::AddAnimatedSprite(AnimatedSprite* apAniamtedSprite)
    {
-      auto iter = std::find(mAnimatedSprites.begin(), mAnimatedSprites.end(), apAniamtedSprite);
-      if (iter == mAnimatedSprites.end())
+      Entities::Entity entity = Entities::INVALID_ENTITY;
+      if (CreateItemEntity(apAniamtedSprite, &entity) == true)
       {
-         mAnimatedSprites.push_back(apAniamtedSprite);
+         Entities::AnimatedSpriteAdapterComponent component = {apAniamtedSprite};
+         if (apAniamtedSprite->IsClockDriven() == true)
+         {
+            mEntities.GetClockAnimatedSpriteAdapters().AddComponent(entity, component);
+         }
+         else
+         {
+            mEntities.GetAnimatedSpriteAdapters().AddComponent(entity, component);
+         }
+         mDrawOrderChanged = true;
       }
+
+      return entity;
    }
 
    //******************************************************************************************************************
@@ -140,13 +269,154 @@ namespace Bebop { namespace Graphics
    //******************************************************************************************************************
    void SceneLayer::RemoveAnimatedSprite(AnimatedSprite* apAniamtedSprite)
    {
-      auto iter = std::find(mAnimatedSprites.begin(), mAnimatedSprites.end(), apAniamtedSprite);
-      if (iter != mAnimatedSprites.end())
+      DestroyItemEntity(apAniamtedSprite);
+   }
+   
+   //******************************************************************************************************************
+   //
+   // Method: AddSpriteInstance
+   //
+   // Description:
+   //    Adds an instance of a sprite to the scene layer. The instance keeps its own position and rotation in the
+   //    layer's packed components and only uses the sprite for its image, so many instances can share a single
+   //    sprite. The position of the sprite itself is ignored.
+   //
+   // Arguments:
+   //    apSprite  - The sprite the instance is drawn from.
+   //    aPosition - The position of the instance.
+   //    aRotation - The rotation of the instance.
+   //
+   // Return:
+   //    Returns the handle of the entity for the instance, or INVALID_ENTITY if the layer has no room for another
+   //    entity.
+   //
+   //******************************************************************************************************************
+   Entities::Entity SceneLayer::AddSpriteInstance(const Sprite* apSprite, const Math::Vector2D<float> aPosition,
+                                                  const float aRotation)
+   {
+      Entities::Entity entity = CreateInstanceEntity(apSprite, aPosition, aRotation);
+      if (entity != Entities::INVALID_ENTITY)
       {
-         mAnimatedSprites.erase(iter);
+         mStaticSpritesChanged = true;
       }
+
+      return entity;
    }
-   
+
+   //******************************************************************************************************************
+   //
+   // Method: AddAnimatedSpriteInstance
+   //
+   // Description:
+   //    Adds an instance of a sprite that plays an animation clip to the scene layer. The frames of the clip are
+   //    relative to the source of the sprite. The playback of the instance is kept in the layer's packed components
+   //    and advanced by the layer's update, so many instances can share a single sprite and clip.
+   //
+   // Arguments:
+   //    apSprite  - The sprite the instance is drawn from.
+   //    apClip    - The clip played by the instance.
+   //    aPosition - The position of the instance.
+   //    aRotation - The rotation of the instance.
+   //
+   // Return:
+   //    Returns the handle of the entity for the instance, or INVALID_ENTITY if the layer has no room for another
+   //    entity.
+   //
+   //******************************************************************************************************************
+   Entities::Entity SceneLayer::AddAnimatedSpriteInstance(const Sprite* apSprite, const AnimationClip* apClip,
+                                                          const Math::Vector2D<float> aPosition, const float aRotation)
+   {
+      Entities::Entity entity = CreateInstanceEntity(apSprite, aPosition, aRotation);
+
+      // A clip without frames has nothing to play, so the instance draws the whole sprite.
+      if (entity != Entities::INVALID_ENTITY && apClip->GetFrameCount() > 0)
+      {
+         Entities::AnimationStateComponent component = {apClip, 0.0F, 0};
+         mEntities.GetAnimationStates().AddComponent(entity, component);
+         ShowFrame(apClip->GetFrame(0), mEntities.GetSprites().GetComponent(entity));
+      }
+
+      return entity;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AddClockAnimatedSpriteInstance
+   //
+   // Description:
+   //    Adds an instance of a sprite that plays an animation clip in step with the clock of the layer. Only the clip
+   //    and the start time are kept, so updates skip the instance and its frame is worked out from the clock when the
+   //    layer is drawn. Instances started at the same time play in lockstep.
+   //
+   // Arguments:
+   //    apSprite   - The sprite the instance is drawn from.
+   //    apClip     - The clip played by the instance.
+   //    aStartTime - The clock time in seconds the clip starts at.
+   //    aPosition  - The position of the instance.
+   //    aRotation  - The rotation of the instance.
+   //
+   // Return:
+   //    Returns the handle of the entity for the instance, or INVALID_ENTITY if the layer has no room for another
+   //    entity.
+   //
+   //******************************************************************************************************************
+   Entities::Entity SceneLayer::AddClockAnimatedSpriteInstance(const Sprite* apSprite, const AnimationClip* apClip,
+                                                               const double aStartTime,
+                                                               const Math::Vector2D<float> aPosition,
+                                                               const float aRotation)
+   {
+      Entities::Entity entity = CreateInstanceEntity(apSprite, aPosition, aRotation);
+
+      // A clip without frames has nothing to play, so the instance draws the whole sprite.
+      if (entity != Entities::INVALID_ENTITY && apClip->GetFrameCount() > 0)
+      {
+         Entities::ClockAnimationComponent component = {apClip, aStartTime};
+         mEntities.GetClockAnimations().AddComponent(entity, component);
+      }
+
+      return entity;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: SetTransform
+   //
+   // Description:
+   //    Moves and rotates a sprite instance on the layer.
+   //
+   // Arguments:
+   //    aEntity   - The handle of the entity returned when the instance was added.
+   //    aPosition - The new position of the instance.
+   //    aRotation - The new rotation of the instance.
+   //
+   // Return:
+   //    True  - The instance was moved.
+   //    False - The handle does not refer to a sprite instance on this layer.
+   //
+   //******************************************************************************************************************
+   bool SceneLayer::SetTransform(const Entities::Entity aEntity, const Math::Vector2D<float> aPosition,
+                                 const float aRotation)
+   {
+      Entities::TransformComponent* pTransform = mEntities.GetTransforms().GetComponent(aEntity);
+      if (pTransform == nullptr)
+      {
+         return false;
+      }
+
+      pTransform->positionX = aPosition.GetComponentX();
+      pTransform->positionY = aPosition.GetComponentY();
+      pTransform->rotation = aRotation;
+
+      // Still instances are drawn into the cached chunks of a static layer.
+      if (mIsStatic == true && mEntities.GetAnimationStates().HasComponent(aEntity) == false &&
+          mEntities.GetClockAnimations().HasComponent(aEntity) == false)
+      {
+         InvalidateStaticCache();
+      }
+
+      return true;
+   }
+
    //******************************************************************************************************************
    //
    // Method: AddParticle
@@ -158,16 +428,21 @@ namespace Bebop { namespace Graphics
    //    apParticle - The particle being added for this layer.
    //
    // Return:
-   //    N/A
+   //    Returns the handle of the entity for the item, which is the existing handle if the item is already on
+   //    the layer, or INVALID_ENTITY if the layer has no room for another entity.
    //
    //******************************************************************************************************************
-   void SceneLayer::AddParticle(Particle* apParticle)
+   Entities::Entity SceneLayer::AddParticle(Particle* apParticle)
    {
-      auto iter = std::find(mParticles.begin(), mParticles.end(), apParticle);
-      if (iter == mParticles.end())
+      Entities::Entity entity = Entities::INVALID_ENTITY;
+      if (CreateItemEntity(apParticle, &entity) == true)
       {
-         mParticles.push_back(apParticle);
+         Entities::ParticleComponent component = {apParticle};
+         mEntities.GetParticles().AddComponent(entity, component);
+         mDrawOrderChanged = true;
       }
+
+      return entity;
    }
 
    //******************************************************************************************************************
@@ -186,11 +461,7 @@ namespace Bebop { namespace Graphics
    //******************************************************************************************************************
    void SceneLayer::RemoveParticle(Particle* apParticle)
    {
-      auto iter = std::find(mParticles.begin(), mParticles.end(), apParticle);
-      if (iter != mParticles.end())
-      {
-         mParticles.erase(iter);
-      }
+      DestroyItemEntity(apParticle);
    }
    
    //******************************************************************************************************************
@@ -204,16 +475,20 @@ namespace Bebop { namespace Graphics
    //    apLight - The light source being added for this layer.
    //
    // Return:
-   //    N/A
+   //    Returns the handle of the entity for the item, which is the existing handle if the item is already on
+   //    the layer, or INVALID_ENTITY if the layer has no room for another entity.
    //
    //******************************************************************************************************************
-   void SceneLayer::AddLight(Light* apLight)
+   Entities::Entity SceneLayer::AddLight(Light* apLight)
    {
-      auto iter = std::find(mLights.begin(), mLights.end(), apLight);
-      if (iter == mLights.end())
+      Entities::Entity entity = Entities::INVALID_ENTITY;
+      if (CreateItemEntity(apLight, &entity) == true)
       {
-         mLights.push_back(apLight);
+         Entities::LightComponent component = {apLight, false, false};
+         mEntities.GetLights().AddComponent(entity, component);
       }
+
+      return entity;
    }
 
    //******************************************************************************************************************
@@ -232,13 +507,41 @@ namespace Bebop { namespace Graphics
    //******************************************************************************************************************
    void SceneLayer::RemoveLight(Light* apLight)
    {
-      auto iter = std::find(mLights.begin(), mLights.end(), apLight);
-      if (iter != mLights.end())
+      DestroyItemEntity(apLight);
+   }
+   
+   //******************************************************************************************************************
+   //
+   // Method: AddStaticLight
+   //
+   // Description:
+   //    Adds a light that never moves while on the scene layer, such as a torch on a wall. Static lights are only
+   //    blocked by the static light blocking rectangles of the layer. They are worked out and drawn into baked light
+   //    and shadow maps once, which are drawn with a single call each frame. A static light that overlaps another
+   //    static light is left out of the shadow map and drawn onto the shadow layer on its own.
+   //
+   // Arguments:
+   //    apLight - The light source being added for this layer.
+   //
+   // Return:
+   //    Returns the handle of the entity for the item, which is the existing handle if the item is already on
+   //    the layer, or INVALID_ENTITY if the layer has no room for another entity.
+   //
+   //******************************************************************************************************************
+   Entities::Entity SceneLayer::AddStaticLight(Light* apLight)
+   {
+      Entities::Entity entity = Entities::INVALID_ENTITY;
+      if (CreateItemEntity(apLight, &entity) == true)
       {
-         mLights.erase(iter);
+         Entities::LightComponent component = {apLight, true, false};
+         mEntities.GetLights().AddComponent(entity, component);
+         ++mStaticLightCount;
+         mStaticLightingChanged = true;
       }
+
+      return entity;
    }
-   
+
    //******************************************************************************************************************
    //
    // Method: AddLightBlockingObjects
@@ -250,215 +553,1616 @@ namespace Bebop { namespace Graphics
    //    apObject - The object that will block light sources being added for this layer.
    //
    // Return:
-   //    N/A
+   //    Returns the handle of the entity for the item, which is the existing handle if the item is already on
+   //    the layer, or INVALID_ENTITY if the layer has no room for another entity.
    //
    //******************************************************************************************************************
-   void SceneLayer::AddLightBlockingObjects(Objects::Object* apObject)
+   Entities::Entity SceneLayer::AddLightBlockingObjects(Objects::Object* apObject)
    {
-      auto iter = std::find(mLightBlockingObjects.begin(), mLightBlockingObjects.end(), apObject);
-      if (iter == mLightBlockingObjects.end())
+      Entities::Entity entity = Entities::INVALID_ENTITY;
+      if (CreateItemEntity(apObject, &entity) == true)
       {
-         mLightBlockingObjects.push_back(apObject);
+         Entities::ColliderComponent component = {apObject, false};
+         mEntities.GetColliders().AddComponent(entity, component);
+         mLightBlockersChanged = true;
       }
+
+      return entity;
    }
 
    //******************************************************************************************************************
    //
-   // Method: RemoveLightBlockingObjects
+   // Method: AddStaticLightBlockingObjects
    //
    // Description:
-   //    Removes a object that will block light sources from the scene layer.
+   //    Adds a rectangle that will block light sources and never moves while on the scene layer, such as a wall tile.
+   //    Static rectangles that touch or overlap are merged into larger rectangles before being handed to the lights,
+   //    so the lights have fewer edges and corners to check.
    //
    // Arguments:
-   //    apObject - The object that will block light sources being removed from this layer.
+   //    apRectangle - The rectangle that will block light sources being added for this layer.
    //
    // Return:
-   //    N/A
+   //    Returns the handle of the entity for the item, which is the existing handle if the item is already on
+   //    the layer, or INVALID_ENTITY if the layer has no room for another entity.
    //
    //******************************************************************************************************************
-   void SceneLayer::RemoveLightBlockingObjects(Objects::Object* apObject)
+   Entities::Entity SceneLayer::AddStaticLightBlockingObjects(Objects::RectangleObject* apRectangle)
    {
-      auto iter = std::find(mLightBlockingObjects.begin(), mLightBlockingObjects.end(), apObject);
-      if (iter != mLightBlockingObjects.end())
+      Entities::Entity entity = Entities::INVALID_ENTITY;
+      if (CreateItemEntity(apRectangle, &entity) == true)
       {
-         mLightBlockingObjects.erase(iter);
+         Entities::ColliderComponent component = {apRectangle, true};
+         mEntities.GetColliders().AddComponent(entity, component);
+         mLightBlockersChanged = true;
+         mStaticLightingChanged = true;
       }
+
+      return entity;
    }
 
    //******************************************************************************************************************
    //
-   // Method: Update
+   // Method: RemoveLightBlockingObjects
    //
    // Description:
-   //    Updates items within the scene layer based on the elapsed time.
+   //    Removes a object that will block light sources from the scene layer.
    //
    // Arguments:
-   //    aElapsedTime - The time that has elapsed since last update.
+   //    apObject - The object that will block light sources being removed from this layer.
    //
    // Return:
    //    N/A
    //
    //******************************************************************************************************************
-   void SceneLayer::Update(const float aElapsedTime) const
+   void SceneLayer::RemoveLightBlockingObjects(Objects::Object* apObject)
    {
-      for (auto iterator = mAnimatedSprites.begin(); iterator != mAnimatedSprites.end(); ++iterator)
-      {
-         (*iterator)->Update(aElapsedTime);
-      }
-      
-      for (auto iterator = mParticles.begin(); iterator != mParticles.end(); ++iterator)
-      {
-         (*iterator)->Update(aElapsedTime);
-      }
-
-      for (auto iterator = mLights.begin(); iterator != mLights.end(); ++iterator)
-      {
-         (*iterator)->Update(aElapsedTime, mLightBlockingObjects);
-      }
+      DestroyItemEntity(apObject);
    }
 
    //******************************************************************************************************************
    //
-   // Method: Draw
+   // Method: RemoveEntity
    //
    // Description:
-   //    Draw objects of the scene layer onto the window.
+   //    Removes the item of an entity from the scene layer using the handle returned when the item was added.
+   //    Handles to items that were already removed are ignored.
    //
    // Arguments:
-   //    apShadowLayer - Pointer to the a shadow map used to update this shadow map for lights/shadows.
+   //    aEntity - The handle of the entity being removed.
    //
    // Return:
-   //    N/A
+   //    True  - The item was removed.
+   //    False - The handle does not refer to an item on this layer.
    //
    //******************************************************************************************************************
-   void SceneLayer::Draw(ALLEGRO_BITMAP* apShadowLayer)
+   bool SceneLayer::RemoveEntity(const Entities::Entity aEntity)
    {
-      for (auto iterator = mSprites.begin(); iterator != mSprites.end(); ++iterator)
+      if (mEntities.IsAlive(aEntity) == false)
       {
-         (*iterator)->Draw();
+         return false;
       }
 
-      for (auto iterator = mAnimatedSprites.begin(); iterator != mAnimatedSprites.end(); ++iterator)
+      const Entities::ColliderComponent* pCollider = mEntities.GetColliders().GetComponent(aEntity);
+      if (pCollider != nullptr)
       {
-         (*iterator)->Draw();
+         mLightBlockersChanged = true;
+         mStaticLightingChanged = mStaticLightingChanged || pCollider->isStatic;
       }
 
-      for (auto iterator = mParticles.begin(); iterator != mParticles.end(); ++iterator)
+      const Entities::LightComponent* pLight = mEntities.GetLights().GetComponent(aEntity);
+      if (pLight != nullptr && pLight->isStatic == true)
       {
-         (*iterator)->Draw();
+         --mStaticLightCount;
+         mStaticLightingChanged = true;
       }
 
-      DrawLightColors();
-
-      if (apShadowLayer != nullptr)
+      if (mEntities.GetSprites().HasComponent(aEntity) == true ||
+          mEntities.GetSpriteAdapters().HasComponent(aEntity) == true ||
+          mEntities.GetAnimatedSpriteAdapters().HasComponent(aEntity) == true ||
+          mEntities.GetClockAnimatedSpriteAdapters().HasComponent(aEntity) == true ||
+          mEntities.GetParticles().HasComponent(aEntity) == true)
       {
-         UpdateShadowLayer(apShadowLayer);
+         mDrawOrderChanged = true;
       }
-   }
-
-//*********************************************************************************************************************
-// Public Methods - End
-//*********************************************************************************************************************
-
-//*********************************************************************************************************************
-// Protected Methods - Start
-//*********************************************************************************************************************
-
-   // There are currently no protected methods for this class.
 
-//*********************************************************************************************************************
-// Protected Methods - End
-//*********************************************************************************************************************
+      // Only still sprites are drawn onto the cached chunks of a static layer.
+      if (IsStillSprite(aEntity) == true)
+      {
+         mStaticSpritesChanged = true;
+      }
 
-//*********************************************************************************************************************
-// Private Methods - Start
-//*********************************************************************************************************************
+      // Sprite instances have no item in the lookup.
+      if (mEntityItems[Entities::GetEntityIndex(aEntity)] != nullptr)
+      {
+         mItemEntities.erase(mEntityItems[Entities::GetEntityIndex(aEntity)]);
+         mEntityItems[Entities::GetEntityIndex(aEntity)] = nullptr;
+      }
+      mEntities.DestroyEntity(aEntity);
+      return true;
+   }
 
    //******************************************************************************************************************
    //
-   // Method: DrawLightColors
+   // Method: SetSortKey
    //
    // Description:
-   //    Draw light's color onto the main display.
+   //    Sets the draw order key of a sprite, animated sprite, or particle on the layer. Items with lower keys are
+   //    drawn first and items with equal keys are drawn in the order they were added. The draw order is only sorted
+   //    again when a key actually changes.
    //
    // Arguments:
-   //    N/A
+   //    aEntity  - The handle of the entity returned when the item was added.
+   //    aSortKey - The draw order key of the item.
    //
    // Return:
-   //    N/A
+   //    True  - The key was set.
+   //    False - The handle does not refer to an item on this layer.
    //
    //******************************************************************************************************************
-   void SceneLayer::DrawLightColors() const
+   bool SceneLayer::SetSortKey(const Entities::Entity aEntity, const float aSortKey)
    {
-      // Set to blend the colors together by adding the values together.
-      al_set_blender(ALLEGRO_ADD, ALLEGRO_ALPHA, ALLEGRO_INVERSE_ALPHA);
+      if (mEntities.IsAlive(aEntity) == false)
+      {
+         return false;
+      }
 
-      // Draw the lights to the shadow map.
-      for (auto iterator = mLights.begin(); iterator != mLights.end(); ++iterator)
+      Entities::SortKeyComponent* pSortKey = mEntities.GetSortKeys().GetComponent(aEntity);
+      if (pSortKey == nullptr)
+      {
+         Entities::SortKeyComponent component = {aSortKey};
+         mEntities.GetSortKeys().AddComponent(aEntity, component);
+         if (aSortKey != DEFAULT_SORT_KEY)
+         {
+            mDrawOrderChanged = true;
+            mStaticSpritesChanged = mStaticSpritesChanged || IsStillSprite(aEntity);
+         }
+      }
+      else if (pSortKey->sortKey != aSortKey)
       {
-         (*iterator)->Draw(true);
+         pSortKey->sortKey = aSortKey;
+         mDrawOrderChanged = true;
+         mStaticSpritesChanged = mStaticSpritesChanged || IsStillSprite(aEntity);
       }
 
-      // Set back to the default blender.
-      al_set_blender(ALLEGRO_ADD, ALLEGRO_ONE, ALLEGRO_INVERSE_ALPHA);
+      return true;
    }
 
    //******************************************************************************************************************
    //
-   // Method: DrawShadowMap
+   // Method: Update
    //
    // Description:
-   //    Draw shadow map for the lights onto the main display, this does not include the light's color.
+   //    Updates items within the scene layer based on the elapsed time.
    //
    // Arguments:
-   //    apShadowLayer - Pointer to the a shadow map used to update this shadow map for lights/shadows.
+   //    aElapsedTime - The time that has elapsed since last update.
    //
    // Return:
    //    N/A
    //
    //******************************************************************************************************************
-   void SceneLayer::UpdateShadowLayer(ALLEGRO_BITMAP* apShadowLayer)
+   void SceneLayer::Update(const float aElapsedTime)
    {
-      // Retain the display bitmap information.
-      ALLEGRO_BITMAP* displayBitmap = al_get_target_bitmap();
-
-      // Set bitmap to the shadow layer and clear it.
-      al_set_target_bitmap(apShadowLayer);
+      mClockTime += aElapsedTime;
 
-      // Draw areas for light blocking objects on the shadowmap.
-      for (auto iterator = mLightBlockingObjects.begin(); iterator != mLightBlockingObjects.end(); ++iterator)
+      // Advance the playback of the animated sprite instances in place, moving an instance's sprite component only
+      // when its frame changes.
+      std::vector<Entities::AnimationStateComponent>& animationStates =
+         mEntities.GetAnimationStates().GetComponents();
+      for (unsigned int i = 0; i < animationStates.size(); ++i)
       {
-         (*iterator)->DrawForLightBlocking(240);
+         Entities::AnimationStateComponent& state = animationStates[i];
+         state.clipTime = state.pClip->AdvanceTime(state.clipTime, aElapsedTime);
+         unsigned int frameIndex = state.pClip->GetFrameIndex(state.clipTime);
+         if (frameIndex != state.frame)
+         {
+            state.frame = frameIndex;
+            ShowFrame(state.pClip->GetFrame(frameIndex),
+                      mEntities.GetSprites().GetComponent(mEntities.GetAnimationStates().GetEntityAt(i)));
+         }
       }
 
-      // Draw blacked out area of sprites for this layer on the shadowmap.
-      for (auto iterator = mSprites.begin(); iterator != mSprites.end(); ++iterator)
+      // Sprites and instances played from the clock are kept in arrays of their own and work out their frame when
+      // drawn, so only the sprites with their own timer are walked here. A sprite switched to the clock since it was
+      // added is moved to the clock array instead of being updated, and the last sprite takes its place.
+      Entities::ComponentArray<Entities::AnimatedSpriteAdapterComponent>& animations =
+         mEntities.GetAnimatedSpriteAdapters();
+      unsigned int animationIndex = 0;
+      while (animationIndex < animations.GetSize())
       {
-         (*iterator)->DrawTinted(240);
+         AnimatedSprite* pAnimatedSprite = animations.GetComponents()[animationIndex].pAnimatedSprite;
+         if (pAnimatedSprite->IsClockDriven() == true)
+         {
+            MoveAnimatedSpriteAdapter(animations.GetEntityAt(animationIndex), true);
+         }
+         else
+         {
+            pAnimatedSprite->Update(aElapsedTime);
+            ++animationIndex;
+         }
       }
-      for (auto iterator = mAnimatedSprites.begin(); iterator != mAnimatedSprites.end(); ++iterator)
+
+      const std::vector<Entities::ParticleComponent>& particles = mEntities.GetParticles().GetComponents();
+      for (auto iterator = particles.begin(); iterator != particles.end(); ++iterator)
       {
-         (*iterator)->DrawTinted(240);
+         iterator->pParticle->Update(aElapsedTime);
       }
-      for (auto iterator = mParticles.begin(); iterator != mParticles.end(); ++iterator)
+
+      // The lights take the blocking objects as a list, which only needs to be rebuilt when the colliders change.
+      if (mLightBlockersChanged == true)
       {
-         (*iterator)->DrawTinted(240);
+         UpdateLightBlockers();
       }
 
-      // Set to blend the colors together by subtracting the light from the shadow map.
-      al_set_blender(ALLEGRO_DEST_MINUS_SRC, ALLEGRO_ALPHA, ALLEGRO_INVERSE_ALPHA);
-
-      // Draw the lights to the shadow map.
-      for (auto iterator = mLights.begin(); iterator != mLights.end(); ++iterator)
+      // Static lights are only worked out again when they or the static rectangles change.
+      if (mStaticLightingChanged == true)
       {
-         (*iterator)->Draw(false);
+         CalculateStaticLights();
       }
 
-      // Set back to the default blender.
-      al_set_blender(ALLEGRO_ADD, ALLEGRO_ONE, ALLEGRO_INVERSE_ALPHA);
+      // The dynamic lights are calculated within the time budget of the scheduler, the rest reuse their points.
+      mLightScheduler.Update(mEntities.GetLights().GetComponents(), mLightBlockingObjects, aElapsedTime);
+   }
 
-      // Set the target bitmap back to the main display and reset the blending options.
-      al_set_target_bitmap(displayBitmap);
+   //******************************************************************************************************************
+   //
+   // Method: GetClockTime
+   //
+   // Description:
+   //    Returns the clock of the layer, which is the total time the layer has been updated for. Animated sprites
+   //    played from the clock on this layer take their start time from it.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the clock time in seconds.
+   //
+   //******************************************************************************************************************
+   double SceneLayer::GetClockTime() const
+   {
+      return mClockTime;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetStaticOccluderCount
+   //
+   // Description:
+   //    Returns the number of static light blocking rectangles on the layer when they were last merged, which is at
+   //    the first update after the light blocking objects change.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the number of static rectangles before merging.
+   //
+   //******************************************************************************************************************
+   unsigned int SceneLayer::GetStaticOccluderCount() const
+   {
+      return mStaticOccluderCount;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetBakedOccluderCount
+   //
+   // Description:
+   //    Returns the number of rectangles the static light blocking rectangles were merged into.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the number of static rectangles after merging.
+   //
+   //******************************************************************************************************************
+   unsigned int SceneLayer::GetBakedOccluderCount() const
+   {
+      return static_cast<unsigned int>(mBakedOccluders.size());
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetLightScheduler
+   //
+   // Description:
+   //    Returns the scheduler that spreads the calculation of the layer's dynamic lights over frames, used to set its
+   //    time budget and read how many lights were deferred.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the light scheduler of the layer.
+   //
+   //******************************************************************************************************************
+   LightScheduler* SceneLayer::GetLightScheduler()
+   {
+      return &mLightScheduler;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: InvalidateStaticLighting
+   //
+   // Description:
+   //    Marks the baked light and shadow maps as out of date so the static lights are worked out and baked again. Must
+   //    be called after a static light is moved or changed.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void SceneLayer::InvalidateStaticLighting()
+   {
+      mStaticLightingChanged = true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: SaveStaticLighting
+   //
+   // Description:
+   //    Saves the baked light and shadow maps so they can be loaded with the level instead of being baked. The maps are
+   //    baked when the layer is drawn, so the layer must have been drawn since the static lighting last changed.
+   //
+   // Arguments:
+   //    aFilePath - The file location of the maps. The light map is saved as this path followed by _light.png and
+   //                the shadow map as this path followed by _shadow.png.
+   //
+   // Return:
+   //    True  - Both maps were saved.
+   //    False - The maps have not been baked or could not be written.
+   //
+   //******************************************************************************************************************
+   bool SceneLayer::SaveStaticLighting(const std::string aFilePath) const
+   {
+      if (mpStaticLightMap == nullptr || mpStaticShadowMap == nullptr ||
+          mStaticLightMapStale == true || mStaticShadowMapStale == true)
+      {
+         return false;
+      }
+
+      return al_save_bitmap((aFilePath + "_light.png").c_str(), mpStaticLightMap) == true &&
+             al_save_bitmap((aFilePath + "_shadow.png").c_str(), mpStaticShadowMap) == true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: LoadStaticLighting
+   //
+   // Description:
+   //    Loads light and shadow maps saved by a previous call to save in place of baking them. The static lights and
+   //    light blocking rectangles must already be on the layer. The maps are still baked again if the static lighting
+   //    changes or the maps do not match the size of the bitmaps they are drawn onto.
+   //
+   // Arguments:
+   //    aFilePath - The file location of the maps, the same as passed to save.
+   //
+   // Return:
+   //    True  - Both maps were loaded.
+   //    False - A map could not be read. The current maps are kept.
+   //
+   //******************************************************************************************************************
+   bool SceneLayer::LoadStaticLighting(const std::string aFilePath)
+   {
+      // The maps were saved already premultiplied, so they are loaded as they are.
+      ALLEGRO_BITMAP* pLightMap = al_load_bitmap_flags((aFilePath + "_light.png").c_str(),
+                                                       ALLEGRO_NO_PREMULTIPLIED_ALPHA);
+      ALLEGRO_BITMAP* pShadowMap = al_load_bitmap_flags((aFilePath + "_shadow.png").c_str(),
+                                                        ALLEGRO_NO_PREMULTIPLIED_ALPHA);
+      if (pLightMap == nullptr || pShadowMap == nullptr)
+      {
+         if (pLightMap != nullptr)
+         {
+            al_destroy_bitmap(pLightMap);
+         }
+
+         if (pShadowMap != nullptr)
+         {
+            al_destroy_bitmap(pShadowMap);
+         }
+
+         return false;
+      }
+
+      if (mpStaticLightMap != nullptr)
+      {
+         al_destroy_bitmap(mpStaticLightMap);
+      }
+
+      if (mpStaticShadowMap != nullptr)
+      {
+         al_destroy_bitmap(mpStaticShadowMap);
+      }
+
+      mpStaticLightMap = pLightMap;
+      mpStaticShadowMap = pShadowMap;
+
+      // Work out the static lights now so the next update does not mark the loaded maps out of date. The lights are
+      // still needed in case the maps have to be baked again at a different size.
+      if (mLightBlockersChanged == true)
+      {
+         UpdateLightBlockers();
+      }
+
+      if (mStaticLightingChanged == true)
+      {
+         CalculateStaticLights();
+      }
+
+      mStaticLightMapStale = false;
+      mStaticShadowMapStale = false;
+      return true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: SetStatic
+   //
+   // Description:
+   //    Sets whether the sprites of the layer never change, such as terrain and decorations. The sprites of a static
+   //    layer are drawn once onto a grid of chunk bitmaps covering the static area, and each frame only the chunks seen
+   //    through the current transform are drawn. The chunks are drawn again when sprites are added, removed, or
+   //    sorted, when a sprite finishes loading, or when the cache is invalidated. A layer holding animated sprites or
+   //    particles cannot be made static, since they are drawn between the sprites in draw order, and a static layer
+   //    they are added to draws its sprites every frame until they are gone.
+   //
+   // Arguments:
+   //    aIsStatic - True  = Draw the sprites from the cached chunks.
+   //                False = Draw the sprites every frame and free the chunks.
+   //
+   // Return:
+   //    True  - The layer was set.
+   //    False - The layer holds animated sprites or particles, so it was not made static.
+   //
+   //******************************************************************************************************************
+   bool SceneLayer::SetStatic(const bool aIsStatic)
+   {
+      if (aIsStatic == true && HoldsOnlyStillSprites() == false)
+      {
+         return false;
+      }
+
+      mIsStatic = aIsStatic;
+      if (mIsStatic == false)
+      {
+         ReleaseStaticCache();
+      }
+
+      return true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: IsStatic
+   //
+   // Description:
+   //    Returns whether the sprites of the layer are drawn from the cached chunks.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    True  - The layer is static.
+   //    False - The layer draws its sprites every frame.
+   //
+   //******************************************************************************************************************
+   bool SceneLayer::IsStatic() const
+   {
+      return mIsStatic;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: SetStaticArea
+   //
+   // Description:
+   //    Sets the area from the scene origin the cached chunks of a static layer cover. Sprites outside of the area are
+   //    not drawn while the layer is static. An area of zero by zero covers the bitmap being drawn onto, which is the
+   //    default.
+   //
+   // Arguments:
+   //    aWidth  - The width of the area.
+   //    aHeight - The height of the area.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void SceneLayer::SetStaticArea(const int aWidth, const int aHeight)
+   {
+      mStaticAreaWidth = aWidth;
+      mStaticAreaHeight = aHeight;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: InvalidateStaticCache
+   //
+   // Description:
+   //    Marks every cached chunk as out of date so the sprites are drawn onto them again. Must be called after a sprite
+   //    on a static layer is moved or changed.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void SceneLayer::InvalidateStaticCache()
+   {
+      for (auto iterator = mStaticChunks.begin(); iterator != mStaticChunks.end(); ++iterator)
+      {
+         iterator->isStale = true;
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: Draw
+   //
+   // Description:
+   //    Draw objects of the scene layer onto the window.
+   //
+   // Arguments:
+   //    apShadowLayer - Pointer to the a shadow map used to update this shadow map for lights/shadows.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void SceneLayer::Draw(ALLEGRO_BITMAP* apShadowLayer)
+   {
+      if (mDrawOrderChanged == true)
+      {
+         SortDrawOrder();
+      }
+
+      // Changes to anything other than the still sprites leave the cached chunks as they are.
+      if (mStaticSpritesChanged == true)
+      {
+         InvalidateStaticCache();
+         mStaticSpritesChanged = false;
+      }
+
+      ShowClockFrames();
+
+      // The sprites of a static layer are drawn from the cached chunks, or one by one if the chunks could not be made.
+      // Animated sprites and particles added to a static layer would be drawn out of order over the cached chunks, so
+      // the sprites are drawn one by one while there are any.
+      bool spritesCached = mIsStatic == true && HoldsOnlyStillSprites() == true && DrawStaticChunks() == true;
+
+      for (auto iterator = mDrawItems.begin(); iterator != mDrawItems.end(); ++iterator)
+      {
+         const DrawItem& item = *iterator;
+         switch (item.type)
+         {
+            case DRAW_SPRITE:
+               if (spritesCached == false)
+               {
+                  mShapeBatch.Flush();
+                  static_cast<Sprite*>(item.pItem)->Draw();
+               }
+               break;
+            case DRAW_ANIMATED_SPRITE:
+               mShapeBatch.Flush();
+               static_cast<AnimatedSprite*>(item.pItem)->DrawAtTime(mClockTime);
+               break;
+            case DRAW_CLOCK_ANIMATED_SPRITE:
+               // A sprite switched back to its own timer with Play is moved back to the sprites the update walks.
+               if (static_cast<AnimatedSprite*>(item.pItem)->IsClockDriven() == false)
+               {
+                  MoveAnimatedSpriteAdapter(mItemEntities[item.pItem], false);
+               }
+               mShapeBatch.Flush();
+               static_cast<AnimatedSprite*>(item.pItem)->DrawAtTime(mClockTime);
+               break;
+            case DRAW_SPRITE_INSTANCE:
+               if (spritesCached == false)
+               {
+                  mShapeBatch.Flush();
+                  DrawSpriteInstance(item.component, al_map_rgba_f(1.0F, 1.0F, 1.0F, 1.0F));
+               }
+               break;
+            case DRAW_ANIMATED_SPRITE_INSTANCE:
+               mShapeBatch.Flush();
+               DrawSpriteInstance(item.component, al_map_rgba_f(1.0F, 1.0F, 1.0F, 1.0F));
+               break;
+            case DRAW_PARTICLE:
+               // Particles next to each other in the draw order are drawn together once a sprite or the end of the
+               // layer is reached.
+               static_cast<Particle*>(item.pItem)->AddToBatch(&mShapeBatch);
+               break;
+         }
+      }
+      mShapeBatch.Flush();
+
+      DrawLightColors();
+
+      if (apShadowLayer != nullptr)
+      {
+         UpdateShadowLayer(apShadowLayer);
+      }
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: DrawLightColors
+   //
+   // Description:
+   //    Draw light's color onto the main display.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void SceneLayer::DrawLightColors()
+   {
+      // The static lights are drawn together from the baked light map, which is baked again when out of date.
+      ALLEGRO_BITMAP* pTarget = RenderState::GetTargetBitmap();
+      if (mStaticLightCount > 0 && pTarget != nullptr)
+      {
+         int width = al_get_bitmap_width(pTarget);
+         int height = al_get_bitmap_height(pTarget);
+         if ((mStaticLightMapStale == false && MatchesSize(mpStaticLightMap, width, height) == true) ||
+             BakeStaticLights(&mpStaticLightMap, width, height, true) == true)
+         {
+            mStaticLightMapStale = false;
+            RenderState::SetBlendMode(BLEND_PREMULTIPLIED_ALPHA);
+            al_draw_bitmap(mpStaticLightMap, SCENE_ORIGIN, SCENE_ORIGIN, NO_DRAW_FLAGS);
+         }
+      }
+
+      // Set to blend the colors together by adding the values together.
+      RenderState::SetBlendMode(BLEND_ALPHA);
+
+      // Draw the dynamic lights.
+      const std::vector<Entities::LightComponent>& lights = mEntities.GetLights().GetComponents();
+      for (auto iterator = lights.begin(); iterator != lights.end(); ++iterator)
+      {
+         if (iterator->isStatic == false)
+         {
+            iterator->pLight->Draw(true);
+         }
+      }
+
+      // Set back to the default blender.
+      RenderState::SetBlendMode(BLEND_PREMULTIPLIED_ALPHA);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: DrawShadowMap
+   //
+   // Description:
+   //    Draw shadow map for the lights onto the main display, this does not include the light's color.
+   //
+   // Arguments:
+   //    apShadowLayer - Pointer to the a shadow map used to update this shadow map for lights/shadows.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void SceneLayer::UpdateShadowLayer(ALLEGRO_BITMAP* apShadowLayer)
+   {
+      // Retain the display bitmap information.
+      ALLEGRO_BITMAP* displayBitmap = RenderState::GetTargetBitmap();
+
+      // Set bitmap to the shadow layer and clear it.
+      RenderState::SetTargetBitmap(apShadowLayer);
+
+      // Draw areas for light blocking objects and particles on the shadowmap. They all darken the map the same way,
+      // so their order does not matter and they are drawn together.
+      const std::vector<Entities::ColliderComponent>& colliders = mEntities.GetColliders().GetComponents();
+      for (auto iterator = colliders.begin(); iterator != colliders.end(); ++iterator)
+      {
+         iterator->pObject->AddToBatchForLightBlocking(&mShapeBatch, 240);
+      }
+      const std::vector<Entities::ParticleComponent>& particles = mEntities.GetParticles().GetComponents();
+      for (auto iterator = particles.begin(); iterator != particles.end(); ++iterator)
+      {
+         iterator->pParticle->AddTintedToBatch(&mShapeBatch, 240);
+      }
+      mShapeBatch.Flush();
+
+      // Draw blacked out area of sprites for this layer on the shadowmap.
+      for (unsigned int i = 0; i < mEntities.GetSprites().GetSize(); ++i)
+      {
+         DrawSpriteInstance(i, al_map_rgba(0, 0, 0, 240));
+      }
+      const std::vector<Entities::SpriteAdapterComponent>& sprites = mEntities.GetSpriteAdapters().GetComponents();
+      for (auto iterator = sprites.begin(); iterator != sprites.end(); ++iterator)
+      {
+         iterator->pSprite->DrawTinted(240);
+      }
+      const std::vector<Entities::AnimatedSpriteAdapterComponent>& animations =
+         mEntities.GetAnimatedSpriteAdapters().GetComponents();
+      for (auto iterator = animations.begin(); iterator != animations.end(); ++iterator)
+      {
+         iterator->pAnimatedSprite->DrawTinted(240);
+      }
+      const std::vector<Entities::AnimatedSpriteAdapterComponent>& clockAnimations =
+         mEntities.GetClockAnimatedSpriteAdapters().GetComponents();
+      for (auto iterator = clockAnimations.begin(); iterator != clockAnimations.end(); ++iterator)
+      {
+         iterator->pAnimatedSprite->DrawTinted(240);
+      }
+
+      // The static lights are subtracted together from the baked shadow map, which is baked again when out of date.
+      if (mStaticLightCount > 0)
+      {
+         int width = al_get_bitmap_width(apShadowLayer);
+         int height = al_get_bitmap_height(apShadowLayer);
+         if ((mStaticShadowMapStale == false && MatchesSize(mpStaticShadowMap, width, height) == true) ||
+             BakeStaticLights(&mpStaticShadowMap, width, height, false) == true)
+         {
+            mStaticShadowMapStale = false;
+            RenderState::SetBlendMode(BLEND_SUBTRACT_ALPHA);
+            al_draw_bitmap(mpStaticShadowMap, SCENE_ORIGIN, SCENE_ORIGIN, NO_DRAW_FLAGS);
+         }
+      }
+
+      // Set to blend the colors together by subtracting the light from the shadow map.
+      RenderState::SetBlendMode(BLEND_SUBTRACT_ALPHA);
+
+      // Draw the dynamic lights and the static lights left out of the baked map to the shadow map.
+      const std::vector<Entities::LightComponent>& lights = mEntities.GetLights().GetComponents();
+      for (auto iterator = lights.begin(); iterator != lights.end(); ++iterator)
+      {
+         if (iterator->isStatic == false || iterator->overlapsStaticLight == true)
+         {
+            iterator->pLight->Draw(false);
+         }
+      }
+
+      // Set back to the default blender.
+      RenderState::SetBlendMode(BLEND_PREMULTIPLIED_ALPHA);
+
+      // Set the target bitmap back to the main display and reset the blending options.
+      RenderState::SetTargetBitmap(displayBitmap);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: UpdateLightBlockers
+   //
+   // Description:
+   //    Rebuilds the list of objects handed to the lights from the collider components, merging the static rectangles
+   //    first.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void SceneLayer::UpdateLightBlockers()
+   {
+      // Static rectangles are handed over merged rather than one by one.
+      const std::vector<Entities::ColliderComponent>& colliders = mEntities.GetColliders().GetComponents();
+      std::vector<Objects::RectangleObject*> staticRectangles;
+      mLightBlockingObjects.clear();
+      for (auto iterator = colliders.begin(); iterator != colliders.end(); ++iterator)
+      {
+         if (iterator->isStatic == true)
+         {
+            staticRectangles.push_back(static_cast<Objects::RectangleObject*>(iterator->pObject));
+         }
+         else
+         {
+            mLightBlockingObjects.push_back(iterator->pObject);
+         }
+      }
+
+      OccluderBaker::MergeRectangles(staticRectangles, &mBakedOccluders);
+      mStaticOccluderCount = static_cast<unsigned int>(staticRectangles.size());
+      for (auto iterator = mBakedOccluders.begin(); iterator != mBakedOccluders.end(); ++iterator)
+      {
+         mLightBlockingObjects.push_back(iterator->get());
+      }
+      mLightBlockersChanged = false;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: CalculateStaticLights
+   //
+   // Description:
+   //    Works out the static lights against the merged static rectangles, finds the static lights that overlap each
+   //    other and marks the baked maps out of date.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void SceneLayer::CalculateStaticLights()
+   {
+      std::vector<Objects::Object*> staticBlockingObjects;
+      for (auto iterator = mBakedOccluders.begin(); iterator != mBakedOccluders.end(); ++iterator)
+      {
+         staticBlockingObjects.push_back(iterator->get());
+      }
+
+      std::vector<Entities::LightComponent>& lights = mEntities.GetLights().GetComponents();
+      for (auto iterator = lights.begin(); iterator != lights.end(); ++iterator)
+      {
+         if (iterator->isStatic == true)
+         {
+            iterator->pLight->CalculateLight(staticBlockingObjects);
+         }
+
+         iterator->overlapsStaticLight = false;
+      }
+
+      // Static lights whose radii overlap are left out of the baked shadow map and drawn onto the shadow map one by
+      // one instead.
+      for (unsigned int i = 0; i < lights.size(); ++i)
+      {
+         for (unsigned int j = i + 1; j < lights.size() && lights[i].isStatic == true; ++j)
+         {
+            if (lights[j].isStatic == true)
+            {
+               float distanceX = lights[i].pLight->GetCoordinateX() - lights[j].pLight->GetCoordinateX();
+               float distanceY = lights[i].pLight->GetCoordinateY() - lights[j].pLight->GetCoordinateY();
+               float reach = lights[i].pLight->GetRadius() + lights[j].pLight->GetRadius();
+               if ((distanceX * distanceX) + (distanceY * distanceY) < reach * reach)
+               {
+                  lights[i].overlapsStaticLight = true;
+                  lights[j].overlapsStaticLight = true;
+               }
+            }
+         }
+      }
+
+      mStaticLightingChanged = false;
+      mStaticLightMapStale = true;
+      mStaticShadowMapStale = true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: BakeStaticLights
+   //
+   // Description:
+   //    Draws the static lights onto a baked map, creating the map if it does not exist or is the wrong size. The
+   //    lights are drawn over each other with premultiplied alpha, so drawing the light map once blends the same as
+   //    drawing each light in turn. Subtracting lights from the shadow map in turn does not give the same result as
+   //    subtracting them composited together where they overlap, so the shadow map only holds the static lights that
+   //    overlap no other static light.
+   //
+   // Arguments:
+   //    appMap     - The baked map, updated when it is created again.
+   //    aWidth     - The width the map must be.
+   //    aHeight    - The height the map must be.
+   //    aWithColor - True  = Bake the light's color.
+   //                 False = Only bake the cleared area of the light.
+   //
+   // Return:
+   //    True  - The map was baked.
+   //    False - The map could not be created.
+   //
+   //******************************************************************************************************************
+   bool SceneLayer::BakeStaticLights(ALLEGRO_BITMAP** appMap, const int aWidth, const int aHeight,
+                                     const bool aWithColor)
+   {
+      if (MatchesSize(*appMap, aWidth, aHeight) == false)
+      {
+         if (*appMap != nullptr)
+         {
+            al_destroy_bitmap(*appMap);
+         }
+
+         if (nullptr == (*appMap = al_create_bitmap(aWidth, aHeight)))
+         {
+            return false;
+         }
+      }
+
+      // Retain the display bitmap information.
+      ALLEGRO_BITMAP* displayBitmap = RenderState::GetTargetBitmap();
+
+      RenderState::SetTargetBitmap(*appMap);
+      al_clear_to_color(al_map_rgba(NO_COLOR, NO_COLOR, NO_COLOR, NO_COLOR));
+      RenderState::SetBlendMode(BLEND_STRAIGHT_TO_PREMULTIPLIED);
+
+      const std::vector<Entities::LightComponent>& lights = mEntities.GetLights().GetComponents();
+      for (auto iterator = lights.begin(); iterator != lights.end(); ++iterator)
+      {
+         if (iterator->isStatic == true && (aWithColor == true || iterator->overlapsStaticLight == false))
+         {
+            iterator->pLight->Draw(aWithColor);
+         }
+      }
+
+      // Set back to the default blender and the display bitmap.
+      RenderState::SetBlendMode(BLEND_PREMULTIPLIED_ALPHA);
+      RenderState::SetTargetBitmap(displayBitmap);
+      return true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: IsStillSprite
+   //
+   // Description:
+   //    Checks if an entity is a sprite drawn onto the cached chunks of a static layer, which is a sprite added by
+   //    pointer or a sprite instance that does not play a clip.
+   //
+   // Arguments:
+   //    aEntity - The entity being checked.
+   //
+   // Return:
+   //    True  - The entity is a still sprite.
+   //    False - The entity is something else or not on the layer.
+   //
+   //******************************************************************************************************************
+   bool SceneLayer::IsStillSprite(const Entities::Entity aEntity)
+   {
+      return mEntities.GetSpriteAdapters().HasComponent(aEntity) == true ||
+             (mEntities.GetSprites().HasComponent(aEntity) == true &&
+              mEntities.GetAnimationStates().HasComponent(aEntity) == false &&
+              mEntities.GetClockAnimations().HasComponent(aEntity) == false);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: HoldsOnlyStillSprites
+   //
+   // Description:
+   //    Checks if the layer draws nothing but still sprites, so drawing them all from the cached chunks keeps the draw
+   //    order.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    True  - The layer holds no animated sprites or particles.
+   //    False - The layer holds animated sprites or particles.
+   //
+   //******************************************************************************************************************
+   bool SceneLayer::HoldsOnlyStillSprites()
+   {
+      return mEntities.GetAnimationStates().GetSize() == 0 && mEntities.GetClockAnimations().GetSize() == 0 &&
+             mEntities.GetAnimatedSpriteAdapters().GetSize() == 0 &&
+             mEntities.GetClockAnimatedSpriteAdapters().GetSize() == 0 && mEntities.GetParticles().GetSize() == 0;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: CountUnloadedSprites
+   //
+   // Description:
+   //    Counts the still sprites in draw order whose images have not finished loading.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the number of still sprites still loading.
+   //
+   //******************************************************************************************************************
+   unsigned int SceneLayer::CountUnloadedSprites()
+   {
+      unsigned int count = 0;
+      for (auto iterator = mDrawItems.begin(); iterator != mDrawItems.end(); ++iterator)
+      {
+         if ((iterator->type == DRAW_SPRITE && static_cast<Sprite*>(iterator->pItem)->IsLoaded() == false) ||
+             (iterator->type == DRAW_SPRITE_INSTANCE &&
+              mEntities.GetSprites().GetComponents()[iterator->component].pSprite->IsLoaded() == false))
+         {
+            ++count;
+         }
+      }
+
+      return count;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: DrawStaticChunks
+   //
+   // Description:
+   //    Draws the cached chunks of a static layer seen through the current transform, drawing the sprites onto any of
+   //    them that are out of date first. The grid of chunks is made again when the static area changes size.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    True  - The chunks were drawn.
+   //    False - A chunk could not be created, so nothing was drawn and the sprites must be drawn instead.
+   //
+   //******************************************************************************************************************
+   bool SceneLayer::DrawStaticChunks()
+   {
+      ALLEGRO_BITMAP* pTarget = RenderState::GetTargetBitmap();
+      if (pTarget == nullptr)
+      {
+         return false;
+      }
+
+      int targetWidth = al_get_bitmap_width(pTarget);
+      int targetHeight = al_get_bitmap_height(pTarget);
+      int areaWidth = mStaticAreaWidth > 0 ? mStaticAreaWidth : targetWidth;
+      int areaHeight = mStaticAreaHeight > 0 ? mStaticAreaHeight : targetHeight;
+      if (areaWidth != mStaticCacheWidth || areaHeight != mStaticCacheHeight)
+      {
+         ReleaseStaticCache();
+         mStaticCacheWidth = areaWidth;
+         mStaticCacheHeight = areaHeight;
+         mStaticChunkColumns = (areaWidth + STATIC_LAYER_CHUNK_SIZE - 1) / STATIC_LAYER_CHUNK_SIZE;
+         int rows = (areaHeight + STATIC_LAYER_CHUNK_SIZE - 1) / STATIC_LAYER_CHUNK_SIZE;
+         StaticLayerChunk chunk = {nullptr, true, 0};
+         mStaticChunks.assign(mStaticChunkColumns * rows, chunk);
+      }
+
+      if (mStaticChunks.empty() == true)
+      {
+         return true;
+      }
+
+      // Work out the part of the scene seen on the target by taking its corners back through the current transform.
+      ALLEGRO_TRANSFORM inverse;
+      al_copy_transform(&inverse, al_get_current_transform());
+      al_invert_transform(&inverse);
+      float corners[][2] = {{0.0F, 0.0F}, {static_cast<float>(targetWidth), 0.0F},
+                            {0.0F, static_cast<float>(targetHeight)},
+                            {static_cast<float>(targetWidth), static_cast<float>(targetHeight)}};
+      float left = std::numeric_limits<float>::max();
+      float top = std::numeric_limits<float>::max();
+      float right = -std::numeric_limits<float>::max();
+      float bottom = -std::numeric_limits<float>::max();
+      for (auto iterator = std::begin(corners); iterator != std::end(corners); ++iterator)
+      {
+         al_transform_coordinates(&inverse, &(*iterator)[0], &(*iterator)[1]);
+         left = std::min(left, (*iterator)[0]);
+         top = std::min(top, (*iterator)[1]);
+         right = std::max(right, (*iterator)[0]);
+         bottom = std::max(bottom, (*iterator)[1]);
+      }
+
+      int rows = static_cast<int>(mStaticChunks.size()) / mStaticChunkColumns;
+      int firstColumn = std::max(static_cast<int>(std::floor(left / STATIC_LAYER_CHUNK_SIZE)), 0);
+      int firstRow = std::max(static_cast<int>(std::floor(top / STATIC_LAYER_CHUNK_SIZE)), 0);
+      int lastColumn = std::min(static_cast<int>(std::floor(right / STATIC_LAYER_CHUNK_SIZE)), mStaticChunkColumns - 1);
+      int lastRow = std::min(static_cast<int>(std::floor(bottom / STATIC_LAYER_CHUNK_SIZE)), rows - 1);
+
+      // Bring every seen chunk up to date before drawing any, so a chunk that cannot be made leaves nothing half drawn.
+      // A chunk drawn while sprites were still loading is out of date once fewer of them are loading. The sprites are
+      // only counted while such a chunk is seen.
+      bool unloadedCounted = false;
+      unsigned int unloadedSprites = 0;
+      for (int row = firstRow; row <= lastRow; ++row)
+      {
+         for (int column = firstColumn; column <= lastColumn; ++column)
+         {
+            StaticLayerChunk& chunk = mStaticChunks[row * mStaticChunkColumns + column];
+            if (chunk.isStale == false && chunk.unloadedSprites > 0)
+            {
+               if (unloadedCounted == false)
+               {
+                  unloadedSprites = CountUnloadedSprites();
+                  unloadedCounted = true;
+               }
+
+               chunk.isStale = unloadedSprites < chunk.unloadedSprites;
+            }
+
+            if ((chunk.pBitmap == nullptr || chunk.isStale == true) &&
+                RenderStaticChunk(&chunk, column * STATIC_LAYER_CHUNK_SIZE, row * STATIC_LAYER_CHUNK_SIZE) == false)
+            {
+               return false;
+            }
+         }
+      }
+
+      // The chunks hold the sprites drawn over a cleared bitmap with premultiplied alpha, so drawing them the same way
+      // blends the same as drawing the sprites.
+      RenderState::SetBlendMode(BLEND_PREMULTIPLIED_ALPHA);
+      for (int row = firstRow; row <= lastRow; ++row)
+      {
+         for (int column = firstColumn; column <= lastColumn; ++column)
+         {
+            al_draw_bitmap(mStaticChunks[row * mStaticChunkColumns + column].pBitmap,
+                           static_cast<float>(column * STATIC_LAYER_CHUNK_SIZE),
+                           static_cast<float>(row * STATIC_LAYER_CHUNK_SIZE), NO_DRAW_FLAGS);
+         }
+      }
+
+      return true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: RenderStaticChunk
+   //
+   // Description:
+   //    Draws the sprites of the layer in draw order onto a chunk, creating its bitmap if it does not exist. The
+   //    number of sprites still loading is kept with the chunk.
+   //
+   // Arguments:
+   //    apChunk - The chunk being drawn onto.
+   //    aLeft   - The left of the area the chunk covers.
+   //    aTop    - The top of the area the chunk covers.
+   //
+   // Return:
+   //    True  - The chunk was drawn.
+   //    False - The bitmap of the chunk could not be created.
+   //
+   //******************************************************************************************************************
+   bool SceneLayer::RenderStaticChunk(StaticLayerChunk* apChunk, const int aLeft, const int aTop)
+   {
+      if (apChunk->pBitmap == nullptr &&
+          nullptr == (apChunk->pBitmap = al_create_bitmap(STATIC_LAYER_CHUNK_SIZE, STATIC_LAYER_CHUNK_SIZE)))
+      {
+         return false;
+      }
+
+      // Retain the display bitmap information.
+      ALLEGRO_BITMAP* displayBitmap = RenderState::GetTargetBitmap();
+
+      // The chunk is moved under the scene so the sprites are drawn at their own positions.
+      RenderState::SetTargetBitmap(apChunk->pBitmap);
+      ALLEGRO_TRANSFORM transform;
+      al_identity_transform(&transform);
+      al_translate_transform(&transform, static_cast<float>(-aLeft), static_cast<float>(-aTop));
+      al_use_transform(&transform);
+      al_clear_to_color(al_map_rgba(NO_COLOR, NO_COLOR, NO_COLOR, NO_COLOR));
+      RenderState::SetBlendMode(BLEND_PREMULTIPLIED_ALPHA);
+
+      for (auto iterator = mDrawItems.begin(); iterator != mDrawItems.end(); ++iterator)
+      {
+         const DrawItem& item = *iterator;
+         if (item.type == DRAW_SPRITE)
+         {
+            static_cast<Sprite*>(item.pItem)->Draw();
+         }
+         else if (item.type == DRAW_SPRITE_INSTANCE)
+         {
+            DrawSpriteInstance(item.component, al_map_rgba_f(1.0F, 1.0F, 1.0F, 1.0F));
+         }
+      }
+      apChunk->unloadedSprites = CountUnloadedSprites();
+
+      // Set the chunk back to the identity transform and the target back to the display bitmap.
+      al_identity_transform(&transform);
+      al_use_transform(&transform);
+      RenderState::SetTargetBitmap(displayBitmap);
+      apChunk->isStale = false;
+      return true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: ReleaseStaticCache
+   //
+   // Description:
+   //    Frees the bitmaps of the cached chunks and empties the grid.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void SceneLayer::ReleaseStaticCache()
+   {
+      for (auto iterator = mStaticChunks.begin(); iterator != mStaticChunks.end(); ++iterator)
+      {
+         if (iterator->pBitmap != nullptr)
+         {
+            al_destroy_bitmap(iterator->pBitmap);
+         }
+      }
+
+      mStaticChunks.clear();
+      mStaticCacheWidth = 0;
+      mStaticCacheHeight = 0;
+      mStaticChunkColumns = 0;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: CreateItemEntity
+   //
+   // Description:
+   //    Creates the entity for an item added to the layer. Items that already have an entity are rejected so an item
+   //    is only updated and drawn once.
+   //
+   // Arguments:
+   //    apItem   - The item being added.
+   //    apEntity - Updated with the entity created for the item, or the existing entity of the item.
+   //
+   // Return:
+   //    True  - An entity was created for the item.
+   //    False - The item is already on the layer or the layer has no room for another entity.
+   //
+   //******************************************************************************************************************
+   bool SceneLayer::CreateItemEntity(const void* apItem, Entities::Entity* apEntity)
+   {
+      auto iter = mItemEntities.find(apItem);
+      if (iter != mItemEntities.end())
+      {
+         *apEntity = iter->second;
+         return false;
+      }
+
+      *apEntity = mEntities.CreateEntity();
+      if (*apEntity == Entities::INVALID_ENTITY)
+      {
+         return false;
+      }
+
+      unsigned int index = Entities::GetEntityIndex(*apEntity);
+      if (index >= mEntityItems.size())
+      {
+         mEntityItems.resize(index + 1, nullptr);
+         mEntitySequences.resize(index + 1, 0);
+      }
+
+      mEntityItems[index] = apItem;
+      mItemEntities[apItem] = *apEntity;
+      mEntitySequences[index] = NextDrawSequence();
+      return true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: CreateInstanceEntity
+   //
+   // Description:
+   //    Creates the entity for a sprite instance along with its sprite and transform components. The sprite component
+   //    starts out drawing the whole sprite.
+   //
+   // Arguments:
+   //    apSprite  - The sprite the instance is drawn from.
+   //    aPosition - The position of the instance.
+   //    aRotation - The rotation of the instance.
+   //
+   // Return:
+   //    Returns the handle of the entity, or INVALID_ENTITY if the layer has no room for another entity.
+   //
+   //******************************************************************************************************************
+   Entities::Entity SceneLayer::CreateInstanceEntity(const Sprite* apSprite, const Math::Vector2D<float> aPosition,
+                                                     const float aRotation)
+   {
+      Entities::Entity entity = mEntities.CreateEntity();
+      if (entity == Entities::INVALID_ENTITY)
+      {
+         return entity;
+      }
+
+      // Instances have no item of their own, but every entity has a place in the item lookup.
+      unsigned int index = Entities::GetEntityIndex(entity);
+      if (index >= mEntityItems.size())
+      {
+         mEntityItems.resize(index + 1, nullptr);
+         mEntitySequences.resize(index + 1, 0);
+      }
+
+      mEntitySequences[index] = NextDrawSequence();
+
+      Entities::TransformComponent transform = {aPosition.GetComponentX(), aPosition.GetComponentY(), aRotation};
+      mEntities.GetTransforms().AddComponent(entity, transform);
+      Entities::SpriteComponent sprite = {apSprite, 0, 0, apSprite->GetWidth(), apSprite->GetHeight()};
+      mEntities.GetSprites().AddComponent(entity, sprite);
+      mDrawOrderChanged = true;
+      return entity;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: DestroyItemEntity
+   //
+   // Description:
+   //    Destroys the entity of an item removed from the layer along with its components.
+   //
+   // Arguments:
+   //    apItem - The item being removed.
+   //
+   // Return:
+   //    True  - The entity of the item was destroyed.
+   //    False - The item is not on the layer.
+   //
+   //******************************************************************************************************************
+   bool SceneLayer::DestroyItemEntity(const void* apItem)
+   {
+      auto iter = mItemEntities.find(apItem);
+      if (iter == mItemEntities.end())
+      {
+         return false;
+      }
+
+      return RemoveEntity(iter->second);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: DrawSpriteInstance
+   //
+   // Description:
+   //    Draws the sprite instance at a position of the sprite and transform component arrays.
+   //
+   // Arguments:
+   //    aComponent - The position of the instance in the sprite and transform component arrays.
+   //    aTint      - The color the instance is tinted with. White draws the instance unchanged.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void SceneLayer::DrawSpriteInstance(const unsigned int aComponent, const ALLEGRO_COLOR aTint)
+   {
+      const Entities::SpriteComponent& sprite = mEntities.GetSprites().GetComponents()[aComponent];
+      const Entities::TransformComponent& transform = mEntities.GetTransforms().GetComponents()[aComponent];
+      sprite.pSprite->DrawRegion(Math::Vector2D<int>(sprite.sourceX, sprite.sourceY), sprite.width, sprite.height,
+                                 Math::Vector2D<float>(transform.positionX, transform.positionY), transform.rotation,
+                                 aTint);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: ShowClockFrames
+   //
+   // Description:
+   //    Moves the sprite component of each instance played from the clock onto the frame shown at the current clock
+   //    time.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void SceneLayer::ShowClockFrames()
+   {
+      const std::vector<Entities::ClockAnimationComponent>& clockAnimations =
+         mEntities.GetClockAnimations().GetComponents();
+      for (unsigned int i = 0; i < clockAnimations.size(); ++i)
+      {
+         const AnimationClip* pClip = clockAnimations[i].pClip;
+         float clipTime = pClip->GetPlaybackTime(mClockTime - clockAnimations[i].startTime);
+         ShowFrame(pClip->GetFrame(pClip->GetFrameIndex(clipTime)),
+                   mEntities.GetSprites().GetComponent(mEntities.GetClockAnimations().GetEntityAt(i)));
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: MoveAnimatedSpriteAdapter
+   //
+   // Description:
+   //    Moves the adapter of an animated sprite between the sprites with their own timer and the sprites played from
+   //    the clock, after the way the sprite is played has changed. The draw order is rebuilt so the sprite is drawn as
+   //    the kind it is now.
+   //
+   // Arguments:
+   //    aEntity  - The entity of the animated sprite.
+   //    aToClock - True to move the sprite to the clock array, false to move it to the timer array.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void SceneLayer::MoveAnimatedSpriteAdapter(const Entities::Entity aEntity, const bool aToClock)
+   {
+      Entities::ComponentArray<Entities::AnimatedSpriteAdapterComponent>& from =
+         (aToClock == true) ? mEntities.GetAnimatedSpriteAdapters() : mEntities.GetClockAnimatedSpriteAdapters();
+      Entities::ComponentArray<Entities::AnimatedSpriteAdapterComponent>& to =
+         (aToClock == true) ? mEntities.GetClockAnimatedSpriteAdapters() : mEntities.GetAnimatedSpriteAdapters();
+
+      // The draw order can still name a sprite already moved until it is rebuilt on the next draw.
+      Entities::AnimatedSpriteAdapterComponent* pComponent = from.GetComponent(aEntity);
+      if (pComponent == nullptr)
+      {
+         return;
+      }
+
+      Entities::AnimatedSpriteAdapterComponent component = *pComponent;
+      from.RemoveComponent(aEntity);
+      to.AddComponent(aEntity, component);
+      mDrawOrderChanged = true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: NextDrawSequence
+   //
+   // Description:
+   //    Returns the insertion sequence for an entity being added to the layer. Each entity gets a higher sequence than
+   //    every entity added before it. When the sequences run out, the entities on the layer are numbered again from
+   //    zero in the same order.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the insertion sequence.
+   //
+   //******************************************************************************************************************
+   unsigned int SceneLayer::NextDrawSequence()
+   {
+      if (mNextDrawSequence == std::numeric_limits<unsigned int>::max())
+      {
+         std::vector<std::pair<unsigned int, unsigned int>> order;
+         for (unsigned int index = 0; index < mEntitySequences.size(); ++index)
+         {
+            order.push_back(std::make_pair(mEntitySequences[index], index));
+         }
+
+         std::sort(order.begin(), order.end());
+         mNextDrawSequence = 0;
+         for (auto iterator = order.begin(); iterator != order.end(); ++iterator)
+         {
+            mEntitySequences[iterator->second] = mNextDrawSequence++;
+         }
+
+         mDrawOrderChanged = true;
+      }
+
+      return mNextDrawSequence++;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetDrawKey
+   //
+   // Description:
+   //    Packs the sort key of a drawable entity into the high bits of its draw key and its insertion sequence into the
+   //    low bits.
+   //
+   // Arguments:
+   //    aEntity - The drawable entity.
+   //
+   // Return:
+   //    Returns the draw key of the entity.
+   //
+   //******************************************************************************************************************
+   unsigned long long SceneLayer::GetDrawKey(const Entities::Entity aEntity)
+   {
+      const Entities::SortKeyComponent* pSortKey = mEntities.GetSortKeys().GetComponent(aEntity);
+      float sortKey = pSortKey != nullptr ? pSortKey->sortKey : DEFAULT_SORT_KEY;
+      return (static_cast<unsigned long long>(SortKeyToBits(sortKey)) << 32) |
+             mEntitySequences[Entities::GetEntityIndex(aEntity)];
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: SortDrawOrder
+   //
+   // Description:
+   //    Gathers the drawable items of the layer and sorts them by their sort keys. Each item has a single key holding
+   //    the sort key in the high bits and the insertion sequence of its entity in the low bits, and the items are
+   //    sorted with a radix sort over the whole key. Items with equal sort keys are drawn in the order they were
+   //    added, however the component arrays were reordered by removals, and passes where every key has the same
+   //    digit are skipped.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void SceneLayer::SortDrawOrder()
+   {
+      mDrawItems.clear();
+
+      for (unsigned int i = 0; i < mEntities.GetSprites().GetSize(); ++i)
+      {
+         Entities::Entity entity = mEntities.GetSprites().GetEntityAt(i);
+         DrawItemType type = mEntities.GetAnimationStates().HasComponent(entity) == true ||
+                             mEntities.GetClockAnimations().HasComponent(entity) == true ?
+                             DRAW_ANIMATED_SPRITE_INSTANCE : DRAW_SPRITE_INSTANCE;
+         DrawItem item = {type, nullptr, i, GetDrawKey(entity)};
+         mDrawItems.push_back(item);
+      }
+
+      const std::vector<Entities::SpriteAdapterComponent>& sprites = mEntities.GetSpriteAdapters().GetComponents();
+      for (unsigned int i = 0; i < sprites.size(); ++i)
+      {
+         DrawItem item = {DRAW_SPRITE, sprites[i].pSprite, 0,
+                          GetDrawKey(mEntities.GetSpriteAdapters().GetEntityAt(i))};
+         mDrawItems.push_back(item);
+      }
+
+      const std::vector<Entities::AnimatedSpriteAdapterComponent>& animations =
+         mEntities.GetAnimatedSpriteAdapters().GetComponents();
+      for (unsigned int i = 0; i < animations.size(); ++i)
+      {
+         DrawItem item = {DRAW_ANIMATED_SPRITE, animations[i].pAnimatedSprite, 0,
+                          GetDrawKey(mEntities.GetAnimatedSpriteAdapters().GetEntityAt(i))};
+         mDrawItems.push_back(item);
+      }
+
+      const std::vector<Entities::AnimatedSpriteAdapterComponent>& clockAnimations =
+         mEntities.GetClockAnimatedSpriteAdapters().GetComponents();
+      for (unsigned int i = 0; i < clockAnimations.size(); ++i)
+      {
+         DrawItem item = {DRAW_CLOCK_ANIMATED_SPRITE, clockAnimations[i].pAnimatedSprite, 0,
+                          GetDrawKey(mEntities.GetClockAnimatedSpriteAdapters().GetEntityAt(i))};
+         mDrawItems.push_back(item);
+      }
+
+      const std::vector<Entities::ParticleComponent>& particles = mEntities.GetParticles().GetComponents();
+      for (unsigned int i = 0; i < particles.size(); ++i)
+      {
+         DrawItem item = {DRAW_PARTICLE, particles[i].pParticle, 0,
+                          GetDrawKey(mEntities.GetParticles().GetEntityAt(i))};
+         mDrawItems.push_back(item);
+      }
+
+      // Sort on all 64 bits one digit at a time, starting from the least significant digit. The upper digits of the
+      // insertion sequence are usually the same for every item, so their passes are skipped.
+      mDrawItemsScratch.resize(mDrawItems.size());
+      for (unsigned int shift = 0; shift < 64; shift += DRAW_ORDER_RADIX_BITS)
+      {
+         unsigned int counts[DRAW_ORDER_RADIX_BUCKETS] = {};
+         for (auto iterator = mDrawItems.begin(); iterator != mDrawItems.end(); ++iterator)
+         {
+            ++counts[(iterator->key >> shift) & (DRAW_ORDER_RADIX_BUCKETS - 1)];
+         }
+
+         // Every key shares this digit, so the pass would not move anything.
+         if (mDrawItems.empty() == true ||
+             counts[(mDrawItems.front().key >> shift) & (DRAW_ORDER_RADIX_BUCKETS - 1)] == mDrawItems.size())
+         {
+            continue;
+         }
+
+         unsigned int offset = 0;
+         for (unsigned int bucket = 0; bucket < DRAW_ORDER_RADIX_BUCKETS; ++bucket)
+         {
+            unsigned int count = counts[bucket];
+            counts[bucket] = offset;
+            offset += count;
+         }
+
+         for (auto iterator = mDrawItems.begin(); iterator != mDrawItems.end(); ++iterator)
+         {
+            mDrawItemsScratch[counts[(iterator->key >> shift) & (DRAW_ORDER_RADIX_BUCKETS - 1)]++] = *iterator;
+         }
+
+         mDrawItems.swap(mDrawItemsScratch);
+      }
+
+      mDrawOrderChanged = false;
    }
 
 //*********************************************************************************************************************
@@ -18,10 +18,48 @@
 #include "AnimatedSprite.h"
 #include "Particle.h"
 #include "Light.h"
+#include "../Entities/EntityManager.h"
+#include <unordered_map>
 #include "../Objects/Object.h"
+#include "ShapeBatch.h"
+#include "LightScheduler.h"
+#include "../Objects/RectangleObject.h"
+#include <memory>
+#include <string>
 
 namespace Bebop { namespace Graphics
 {
+   // The kind of item referred to by an entry of the draw order.
+   enum DrawItemType
+   {
+      DRAW_SPRITE,
+      DRAW_ANIMATED_SPRITE,
+      DRAW_CLOCK_ANIMATED_SPRITE,
+      DRAW_PARTICLE,
+      DRAW_SPRITE_INSTANCE,
+      DRAW_ANIMATED_SPRITE_INSTANCE
+   };
+
+   // An item drawn by the layer in the order of its draw key. Items added by pointer are drawn through the pointer,
+   // while sprite instances are drawn from their position in the sprite and transform component arrays. The draw key
+   // holds the sort key of the item in the high bits and the insertion sequence of its entity in the low bits.
+   struct DrawItem
+   {
+      DrawItemType type;
+      void* pItem;
+      unsigned int component;
+      unsigned long long key;
+   };
+
+   // A square of a static layer's sprites drawn once onto a bitmap of its own. The number of sprites still loading
+   // when the chunk was drawn is kept so the chunk is drawn again once any of them has loaded.
+   struct StaticLayerChunk
+   {
+      ALLEGRO_BITMAP* pBitmap;
+      bool isStale;
+      unsigned int unloadedSprites;
+   };
+
    class SceneLayer
    {
       //***************************************************************************************************************
@@ -73,10 +111,11 @@ namespace Bebop { namespace Graphics
          //    apSprite - The sprite being added for this layer.
          //
          // Return:
-         //    N/A
+         //    Returns the handle of the entity for the item, which is the existing handle if the item is already on
+         //    the layer, or INVALID_ENTITY if the layer has no room for another entity.
          //
          //************************************************************************************************************
-         void AddSprite(Sprite* apSprite);
+         Entities::Entity AddSprite(Sprite* apSprite);
 
          //************************************************************************************************************
          //
@@ -99,16 +138,19 @@ namespace Bebop { namespace Graphics
          // Method: AddAnimatedSprite
          //
          // Description:
-         //    Adds an animated sprite to the scene layer.
+         //    Adds an animated sprite to the scene layer. A sprite played from the clock is kept apart from the
+         //    sprites with their own timer and never updated, so it must be started with PlayFromClock before it is
+         //    added.
          //
          // Arguments:
          //    apAniamtedSprite - The animated being added for this layer.
          //
          // Return:
-         //    N/A
+         //    Returns the handle of the entity for the item, which is the existing handle if the item is already on
+         //    the layer, or INVALID_ENTITY if the layer has no room for another entity.
          //
          //************************************************************************************************************
-         void AddAnimatedSprite(AnimatedSprite* apAniamtedSprite);
+         Entities::Entity AddAnimatedSprite(AnimatedSprite* apAniamtedSprite);
 
          //************************************************************************************************************
          //
@@ -126,6 +168,97 @@ namespace Bebop { namespace Graphics
          //************************************************************************************************************
          void RemoveAnimatedSprite(AnimatedSprite* apAniamtedSprite);
 
+         //************************************************************************************************************
+         //
+         // Method: AddSpriteInstance
+         //
+         // Description:
+         //    Adds an instance of a sprite to the scene layer. The instance keeps its own position and rotation in the
+         //    layer's packed components and only uses the sprite for its image, so many instances can share a single
+         //    sprite. The position of the sprite itself is ignored.
+         //
+         // Arguments:
+         //    apSprite  - The sprite the instance is drawn from.
+         //    aPosition - The position of the instance.
+         //    aRotation - The rotation of the instance.
+         //
+         // Return:
+         //    Returns the handle of the entity for the instance, or INVALID_ENTITY if the layer has no room for
+         //    another entity.
+         //
+         //************************************************************************************************************
+         Entities::Entity AddSpriteInstance(const Sprite* apSprite, const Math::Vector2D<float> aPosition,
+                                            const float aRotation);
+
+         //************************************************************************************************************
+         //
+         // Method: AddAnimatedSpriteInstance
+         //
+         // Description:
+         //    Adds an instance of a sprite that plays an animation clip to the scene layer. The frames of the clip
+         //    are relative to the source of the sprite. The playback of the instance is kept in the layer's packed
+         //    components and advanced by the layer's update, so many instances can share a single sprite and clip.
+         //
+         // Arguments:
+         //    apSprite  - The sprite the instance is drawn from.
+         //    apClip    - The clip played by the instance.
+         //    aPosition - The position of the instance.
+         //    aRotation - The rotation of the instance.
+         //
+         // Return:
+         //    Returns the handle of the entity for the instance, or INVALID_ENTITY if the layer has no room for
+         //    another entity.
+         //
+         //************************************************************************************************************
+         Entities::Entity AddAnimatedSpriteInstance(const Sprite* apSprite, const AnimationClip* apClip,
+                                                    const Math::Vector2D<float> aPosition, const float aRotation);
+
+         //************************************************************************************************************
+         //
+         // Method: AddClockAnimatedSpriteInstance
+         //
+         // Description:
+         //    Adds an instance of a sprite that plays an animation clip in step with the clock of the layer. Only the
+         //    clip and the start time are kept, so updates skip the instance and its frame is worked out from the
+         //    clock when the layer is drawn. Instances started at the same time play in lockstep.
+         //
+         // Arguments:
+         //    apSprite   - The sprite the instance is drawn from.
+         //    apClip     - The clip played by the instance.
+         //    aStartTime - The clock time in seconds the clip starts at.
+         //    aPosition  - The position of the instance.
+         //    aRotation  - The rotation of the instance.
+         //
+         // Return:
+         //    Returns the handle of the entity for the instance, or INVALID_ENTITY if the layer has no room for
+         //    another entity.
+         //
+         //************************************************************************************************************
+         Entities::Entity AddClockAnimatedSpriteInstance(const Sprite* apSprite, const AnimationClip* apClip,
+                                                         const double aStartTime,
+                                                         const Math::Vector2D<float> aPosition,
+                                                         const float aRotation);
+
+         //************************************************************************************************************
+         //
+         // Method: SetTransform
+         //
+         // Description:
+         //    Moves and rotates a sprite instance on the layer.
+         //
+         // Arguments:
+         //    aEntity   - The handle of the entity returned when the instance was added.
+         //    aPosition - The new position of the instance.
+         //    aRotation - The new rotation of the instance.
+         //
+         // Return:
+         //    True  - The instance was moved.
+         //    False - The handle does not refer to a sprite instance on this layer.
+         //
+         //************************************************************************************************************
+         bool SetTransform(const Entities::Entity aEntity, const Math::Vector2D<float> aPosition,
+                           const float aRotation);
+
          //************************************************************************************************************
          //
          // Method: AddParticle
@@ -137,10 +270,11 @@ namespace Bebop { namespace Graphics
          //    apParticle - The particle being added for this layer.
          //
          // Return:
-         //    N/A
+         //    Returns the handle of the entity for the item, which is the existing handle if the item is already on
+         //    the layer, or INVALID_ENTITY if the layer has no room for another entity.
          //
          //************************************************************************************************************
-         void AddParticle(Particle* apParticle);
+         Entities::Entity AddParticle(Particle* apParticle);
 
          //************************************************************************************************************
          //
@@ -169,10 +303,11 @@ namespace Bebop { namespace Graphics
          //    apLight - The light source being added for this layer.
          //
          // Return:
-         //    N/A
+         //    Returns the handle of the entity for the item, which is the existing handle if the item is already on
+         //    the layer, or INVALID_ENTITY if the layer has no room for another entity.
          //
          //************************************************************************************************************
-         void AddLight(Light* apLight);
+         Entities::Entity AddLight(Light* apLight);
 
          //************************************************************************************************************
          //
@@ -190,6 +325,26 @@ namespace Bebop { namespace Graphics
          //************************************************************************************************************
          void RemoveLight(Light* apLight);
 
+         //************************************************************************************************************
+         //
+         // Method: AddStaticLight
+         //
+         // Description:
+         //    Adds a light that never moves while on the scene layer, such as a torch on a wall. Static lights are only
+         //    blocked by the static light blocking rectangles of the layer. They are worked out and drawn into baked
+         //    light and shadow maps once, which are drawn with a single call each frame. A static light that overlaps
+         //    another static light is left out of the shadow map and drawn onto the shadow layer on its own.
+         //
+         // Arguments:
+         //    apLight - The light source being added for this layer.
+         //
+         // Return:
+         //    Returns the handle of the entity for the item, which is the existing handle if the item is already on
+         //    the layer, or INVALID_ENTITY if the layer has no room for another entity.
+         //
+         //************************************************************************************************************
+         Entities::Entity AddStaticLight(Light* apLight);
+
          //************************************************************************************************************
          //
          // Method: AddLightBlockingObjects
@@ -201,10 +356,30 @@ namespace Bebop { namespace Graphics
          //    apObject - The object that will block light sources being added for this layer.
          //
          // Return:
-         //    N/A
+         //    Returns the handle of the entity for the item, which is the existing handle if the item is already on
+         //    the layer, or INVALID_ENTITY if the layer has no room for another entity.
+         //
+         //************************************************************************************************************
+         Entities::Entity AddLightBlockingObjects(Objects::Object* apObject);
+
+         //************************************************************************************************************
+         //
+         // Method: AddStaticLightBlockingObjects
+         //
+         // Description:
+         //    Adds a rectangle that will block light sources and never moves while on the scene layer, such as a wall
+         //    tile. Static rectangles that touch or overlap are merged into larger rectangles before being handed to
+         //    the lights, so the lights have fewer edges and corners to check.
+         //
+         // Arguments:
+         //    apRectangle - The rectangle that will block light sources being added for this layer.
+         //
+         // Return:
+         //    Returns the handle of the entity for the item, which is the existing handle if the item is already on
+         //    the layer, or INVALID_ENTITY if the layer has no room for another entity.
          //
          //************************************************************************************************************
-         void AddLightBlockingObjects(Objects::Object* apObject);
+         Entities::Entity AddStaticLightBlockingObjects(Objects::RectangleObject* apRectangle);
 
          //************************************************************************************************************
          //
@@ -222,6 +397,44 @@ namespace Bebop { namespace Graphics
          //************************************************************************************************************
          void RemoveLightBlockingObjects(Objects::Object* apObject);
 
+         //************************************************************************************************************
+         //
+         // Method: RemoveEntity
+         //
+         // Description:
+         //    Removes the item of an entity from the scene layer using the handle returned when the item was
+         //    added. Handles to items that were already removed are ignored.
+         //
+         // Arguments:
+         //    aEntity - The handle of the entity being removed.
+         //
+         // Return:
+         //    True  - The item was removed.
+         //    False - The handle does not refer to an item on this layer.
+         //
+         //************************************************************************************************************
+         bool RemoveEntity(const Entities::Entity aEntity);
+
+         //************************************************************************************************************
+         //
+         // Method: SetSortKey
+         //
+         // Description:
+         //    Sets the draw order key of a sprite, animated sprite, or particle on the layer. Items with lower keys
+         //    are drawn first and items with equal keys are drawn in the order they were added. Items without a key
+         //    use the default key. Top-down scenes typically pass the Y-Coordinate of the bottom of the item.
+         //
+         // Arguments:
+         //    aEntity  - The handle of the entity returned when the item was added.
+         //    aSortKey - The draw order key of the item.
+         //
+         // Return:
+         //    True  - The key was set.
+         //    False - The handle does not refer to an item on this layer.
+         //
+         //************************************************************************************************************
+         bool SetSortKey(const Entities::Entity aEntity, const float aSortKey);
+
          //************************************************************************************************************
          //
          // Method: Update
@@ -236,7 +449,206 @@ namespace Bebop { namespace Graphics
          //    N/A
          //
          //************************************************************************************************************
-         void Update(const float aElapsedTime) const;
+         void Update(const float aElapsedTime);
+
+         //************************************************************************************************************
+         //
+         // Method: GetClockTime
+         //
+         // Description:
+         //    Returns the clock of the layer, which is the total time the layer has been updated for. Animated sprites
+         //    played from the clock on this layer take their start time from it.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the clock time in seconds.
+         //
+         //************************************************************************************************************
+         double GetClockTime() const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetStaticOccluderCount
+         //
+         // Description:
+         //    Returns the number of static light blocking rectangles on the layer when they were last merged, which
+         //    is at the first update after the light blocking objects change.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the number of static rectangles before merging.
+         //
+         //************************************************************************************************************
+         unsigned int GetStaticOccluderCount() const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetBakedOccluderCount
+         //
+         // Description:
+         //    Returns the number of rectangles the static light blocking rectangles were merged into.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the number of static rectangles after merging.
+         //
+         //************************************************************************************************************
+         unsigned int GetBakedOccluderCount() const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetLightScheduler
+         //
+         // Description:
+         //    Returns the scheduler that spreads the calculation of the layer's dynamic lights over frames, used to set
+         //    its time budget and read how many lights were deferred.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the light scheduler of the layer.
+         //
+         //************************************************************************************************************
+         LightScheduler* GetLightScheduler();
+
+         //************************************************************************************************************
+         //
+         // Method: InvalidateStaticLighting
+         //
+         // Description:
+         //    Marks the baked light and shadow maps as out of date so the static lights are worked out and baked again.
+         //    Must be called after a static light is moved or changed.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void InvalidateStaticLighting();
+
+         //************************************************************************************************************
+         //
+         // Method: SaveStaticLighting
+         //
+         // Description:
+         //    Saves the baked light and shadow maps so they can be loaded with the level instead of being baked. The
+         //    maps are baked when the layer is drawn, so the layer must have been drawn since the static lighting
+         //    last changed.
+         //
+         // Arguments:
+         //    aFilePath - The file location of the maps. The light map is saved as this path followed by
+         //                _light.png and the shadow map as this path followed by _shadow.png.
+         //
+         // Return:
+         //    True  - Both maps were saved.
+         //    False - The maps have not been baked or could not be written.
+         //
+         //************************************************************************************************************
+         bool SaveStaticLighting(const std::string aFilePath) const;
+
+         //************************************************************************************************************
+         //
+         // Method: LoadStaticLighting
+         //
+         // Description:
+         //    Loads light and shadow maps saved by a previous call to save in place of baking them. The static lights
+         //    and light blocking rectangles must already be on the layer. The maps are still baked again if the static
+         //    lighting changes or the maps do not match the size of the bitmaps they are drawn onto.
+         //
+         // Arguments:
+         //    aFilePath - The file location of the maps, the same as passed to save.
+         //
+         // Return:
+         //    True  - Both maps were loaded.
+         //    False - A map could not be read. The current maps are kept.
+         //
+         //************************************************************************************************************
+         bool LoadStaticLighting(const std::string aFilePath);
+
+         //************************************************************************************************************
+         //
+         // Method: SetStatic
+         //
+         // Description:
+         //    Sets whether the sprites of the layer never change, such as terrain and decorations. The sprites of a
+         //    static layer are drawn once onto a grid of chunk bitmaps covering the static area, and each frame only
+         //    the chunks seen through the current transform are drawn. The chunks are drawn again when sprites are
+         //    added, removed, or sorted, when a sprite finishes loading, or when the cache is invalidated. A layer
+         //    holding animated sprites or particles cannot be made static, since they are drawn between the sprites
+         //    in draw order, and a static layer they are added to draws its sprites every frame until they are gone.
+         //
+         // Arguments:
+         //    aIsStatic - True  = Draw the sprites from the cached chunks.
+         //                False = Draw the sprites every frame and free the chunks.
+         //
+         // Return:
+         //    True  - The layer was set.
+         //    False - The layer holds animated sprites or particles, so it was not made static.
+         //
+         //************************************************************************************************************
+         bool SetStatic(const bool aIsStatic);
+
+         //************************************************************************************************************
+         //
+         // Method: IsStatic
+         //
+         // Description:
+         //    Returns whether the sprites of the layer are drawn from the cached chunks.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    True  - The layer is static.
+         //    False - The layer draws its sprites every frame.
+         //
+         //************************************************************************************************************
+         bool IsStatic() const;
+
+         //************************************************************************************************************
+         //
+         // Method: SetStaticArea
+         //
+         // Description:
+         //    Sets the area from the scene origin the cached chunks of a static layer cover. Sprites outside of the
+         //    area are not drawn while the layer is static. An area of zero by zero covers the bitmap being drawn onto,
+         //    which is the default.
+         //
+         // Arguments:
+         //    aWidth  - The width of the area.
+         //    aHeight - The height of the area.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void SetStaticArea(const int aWidth, const int aHeight);
+
+         //************************************************************************************************************
+         //
+         // Method: InvalidateStaticCache
+         //
+         // Description:
+         //    Marks every cached chunk as out of date so the sprites are drawn onto them again. Must be called after a
+         //    sprite on a static layer is moved or changed.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void InvalidateStaticCache();
 
          //************************************************************************************************************
          //
@@ -274,7 +686,7 @@ namespace Bebop { namespace Graphics
          //    N/A
          //
          //************************************************************************************************************
-         void DrawLightColors() const;
+         void DrawLightColors();
 
          //************************************************************************************************************
          //
@@ -292,6 +704,334 @@ namespace Bebop { namespace Graphics
          //************************************************************************************************************
          void UpdateShadowLayer(ALLEGRO_BITMAP* apShadowLayer);
 
+         //************************************************************************************************************
+         //
+         // Method: UpdateLightBlockers
+         //
+         // Description:
+         //    Rebuilds the list of objects handed to the lights from the collider components, merging the static
+         //    rectangles first.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void UpdateLightBlockers();
+
+         //************************************************************************************************************
+         //
+         // Method: CalculateStaticLights
+         //
+         // Description:
+         //    Works out the static lights against the merged static rectangles, finds the static lights that overlap
+         //    each other and marks the baked maps out of date.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void CalculateStaticLights();
+
+         //************************************************************************************************************
+         //
+         // Method: BakeStaticLights
+         //
+         // Description:
+         //    Draws the static lights onto a baked map, creating the map if it does not exist or is the wrong size. The
+         //    lights are drawn over each other with premultiplied alpha, so drawing the light map once blends the same
+         //    as drawing each light in turn. Subtracting lights from the shadow map in turn does not give the same
+         //    result as subtracting them composited together where they overlap, so the shadow map only holds the
+         //    static lights that overlap no other static light.
+         //
+         // Arguments:
+         //    appMap     - The baked map, updated when it is created again.
+         //    aWidth     - The width the map must be.
+         //    aHeight    - The height the map must be.
+         //    aWithColor - True  = Bake the light's color.
+         //                 False = Only bake the cleared area of the light.
+         //
+         // Return:
+         //    True  - The map was baked.
+         //    False - The map could not be created.
+         //
+         //************************************************************************************************************
+         bool BakeStaticLights(ALLEGRO_BITMAP** appMap, const int aWidth, const int aHeight, const bool aWithColor);
+
+         //************************************************************************************************************
+         //
+         // Method: IsStillSprite
+         //
+         // Description:
+         //    Checks if an entity is a sprite drawn onto the cached chunks of a static layer, which is a sprite added
+         //    by pointer or a sprite instance that does not play a clip.
+         //
+         // Arguments:
+         //    aEntity - The entity being checked.
+         //
+         // Return:
+         //    True  - The entity is a still sprite.
+         //    False - The entity is something else or not on the layer.
+         //
+         //************************************************************************************************************
+         bool IsStillSprite(const Entities::Entity aEntity);
+
+         //************************************************************************************************************
+         //
+         // Method: HoldsOnlyStillSprites
+         //
+         // Description:
+         //    Checks if the layer draws nothing but still sprites, so drawing them all from the cached chunks keeps
+         //    the draw order.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    True  - The layer holds no animated sprites or particles.
+         //    False - The layer holds animated sprites or particles.
+         //
+         //************************************************************************************************************
+         bool HoldsOnlyStillSprites();
+
+         //************************************************************************************************************
+         //
+         // Method: CountUnloadedSprites
+         //
+         // Description:
+         //    Counts the still sprites in draw order whose images have not finished loading.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the number of still sprites still loading.
+         //
+         //************************************************************************************************************
+         unsigned int CountUnloadedSprites();
+
+         //************************************************************************************************************
+         //
+         // Method: DrawStaticChunks
+         //
+         // Description:
+         //    Draws the cached chunks of a static layer seen through the current transform, drawing the sprites onto
+         //    any of them that are out of date first. The grid of chunks is made again when the static area changes
+         //    size.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    True  - The chunks were drawn.
+         //    False - A chunk could not be created, so nothing was drawn and the sprites must be drawn instead.
+         //
+         //************************************************************************************************************
+         bool DrawStaticChunks();
+
+         //************************************************************************************************************
+         //
+         // Method: RenderStaticChunk
+         //
+         // Description:
+         //    Draws the sprites of the layer in draw order onto a chunk, creating its bitmap if it does not exist.
+         //
+         // Arguments:
+         //    apChunk - The chunk being drawn onto.
+         //    aLeft   - The left of the area the chunk covers.
+         //    aTop    - The top of the area the chunk covers.
+         //
+         // Return:
+         //    True  - The chunk was drawn.
+         //    False - The bitmap of the chunk could not be created.
+         //
+         //************************************************************************************************************
+         bool RenderStaticChunk(StaticLayerChunk* apChunk, const int aLeft, const int aTop);
+
+         //************************************************************************************************************
+         //
+         // Method: ReleaseStaticCache
+         //
+         // Description:
+         //    Frees the bitmaps of the cached chunks and empties the grid.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void ReleaseStaticCache();
+
+         //************************************************************************************************************
+         //
+         // Method: CreateItemEntity
+         //
+         // Description:
+         //    Creates the entity for an item added to the layer. Items that already have an entity are rejected so an
+         //    item is only updated and drawn once.
+         //
+         // Arguments:
+         //    apItem   - The item being added.
+         //    apEntity - Updated with the entity created for the item, or the existing entity of the item.
+         //
+         // Return:
+         //    True  - An entity was created for the item.
+         //    False - The item is already on the layer or the layer has no room for another entity.
+         //
+         //************************************************************************************************************
+         bool CreateItemEntity(const void* apItem, Entities::Entity* apEntity);
+
+         //************************************************************************************************************
+         //
+         // Method: CreateInstanceEntity
+         //
+         // Description:
+         //    Creates the entity for a sprite instance along with its sprite and transform components. The sprite
+         //    component starts out drawing the whole sprite.
+         //
+         // Arguments:
+         //    apSprite  - The sprite the instance is drawn from.
+         //    aPosition - The position of the instance.
+         //    aRotation - The rotation of the instance.
+         //
+         // Return:
+         //    Returns the handle of the entity, or INVALID_ENTITY if the layer has no room for another entity.
+         //
+         //************************************************************************************************************
+         Entities::Entity CreateInstanceEntity(const Sprite* apSprite, const Math::Vector2D<float> aPosition,
+                                               const float aRotation);
+
+         //************************************************************************************************************
+         //
+         // Method: DestroyItemEntity
+         //
+         // Description:
+         //    Destroys the entity of an item removed from the layer along with its components.
+         //
+         // Arguments:
+         //    apItem - The item being removed.
+         //
+         // Return:
+         //    True  - The entity of the item was destroyed.
+         //    False - The item is not on the layer.
+         //
+         //************************************************************************************************************
+         bool DestroyItemEntity(const void* apItem);
+
+         //************************************************************************************************************
+         //
+         // Method: DrawSpriteInstance
+         //
+         // Description:
+         //    Draws the sprite instance at a position of the sprite and transform component arrays.
+         //
+         // Arguments:
+         //    aComponent - The position of the instance in the sprite and transform component arrays.
+         //    aTint      - The color the instance is tinted with. White draws the instance unchanged.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void DrawSpriteInstance(const unsigned int aComponent, const ALLEGRO_COLOR aTint);
+
+         //************************************************************************************************************
+         //
+         // Method: ShowClockFrames
+         //
+         // Description:
+         //    Moves the sprite component of each instance played from the clock onto the frame shown at the current
+         //    clock time.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void ShowClockFrames();
+
+         //************************************************************************************************************
+         //
+         // Method: MoveAnimatedSpriteAdapter
+         //
+         // Description:
+         //    Moves the adapter of an animated sprite between the sprites with their own timer and the sprites played
+         //    from the clock, after the way the sprite is played has changed. The draw order is rebuilt so the sprite
+         //    is drawn as the kind it is now.
+         //
+         // Arguments:
+         //    aEntity  - The entity of the animated sprite.
+         //    aToClock - True to move the sprite to the clock array, false to move it to the timer array.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void MoveAnimatedSpriteAdapter(const Entities::Entity aEntity, const bool aToClock);
+
+         //************************************************************************************************************
+         //
+         // Method: NextDrawSequence
+         //
+         // Description:
+         //    Returns the insertion sequence for an entity being added to the layer. Each entity gets a higher
+         //    sequence than every entity added before it. When the sequences run out, the entities on the layer are
+         //    numbered again from zero in the same order.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the insertion sequence.
+         //
+         //************************************************************************************************************
+         unsigned int NextDrawSequence();
+
+         //************************************************************************************************************
+         //
+         // Method: GetDrawKey
+         //
+         // Description:
+         //    Packs the sort key of a drawable entity into the high bits of its draw key and its insertion sequence
+         //    into the low bits.
+         //
+         // Arguments:
+         //    aEntity - The drawable entity.
+         //
+         // Return:
+         //    Returns the draw key of the entity.
+         //
+         //************************************************************************************************************
+         unsigned long long GetDrawKey(const Entities::Entity aEntity);
+
+         //************************************************************************************************************
+         //
+         // Method: SortDrawOrder
+         //
+         // Description:
+         //    Gathers the drawable items of the layer and sorts them by their sort keys. Each item has a single key
+         //    holding the sort key in the high bits and the insertion sequence of its entity in the low bits, and the
+         //    items are sorted with a radix sort over the whole key. Items with equal sort keys are drawn in the order
+         //    they were added, however the component arrays were reordered by removals.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void SortDrawOrder();
+
       //***************************************************************************************************************
       // Methods - End
       //***************************************************************************************************************
@@ -310,20 +1050,92 @@ namespace Bebop { namespace Graphics
 
       private:
 
-         // Vector list of the sprites within the layer.
-         std::vector<Sprite*> mSprites;
+         // The entities of the layer. Each added item is an entity with one component referring to the item.
+         Entities::EntityManager mEntities;
+
+         // The entity of each item added to the layer, used to reject duplicates and to find the entity to remove.
+         std::unordered_map<const void*, Entities::Entity> mItemEntities;
+
+         // Vector list of objects that will block lights, built from the collider components for the lights.
+         std::vector<Objects::Object*> mLightBlockingObjects;
+
+         // The item of each entity, indexed by the slot index of the entity, used to remove an item by its handle.
+         std::vector<const void*> mEntityItems;
+
+         // The insertion sequence of each entity, indexed by the slot index of the entity, used to keep items with
+         // equal sort keys in the order they were added.
+         std::vector<unsigned int> mEntitySequences;
+
+         // The insertion sequence given to the next entity added to the layer.
+         unsigned int mNextDrawSequence;
+
+         // The drawable items of the layer in draw order.
+         std::vector<DrawItem> mDrawItems;
+
+         // Scratch space for the radix sort, kept between sorts to avoid allocating each time.
+         std::vector<DrawItem> mDrawItemsScratch;
+
+         // Whether the drawable items or their sort keys changed since the draw order was sorted.
+         bool mDrawOrderChanged;
+
+         // Whether still sprites were added, removed or given new sort keys since the cached chunks were invalidated.
+         bool mStaticSpritesChanged;
+
+         // Whether the collider components changed since the blocking objects list was built.
+         bool mLightBlockersChanged;
+
+         // The total time the layer has been updated for, which clock driven animated sprites are drawn at.
+         double mClockTime;
+
+         // The shapes of the layer's light blocking objects and particles, drawn together with a single call. Kept
+         // between draws so its memory is reused every frame.
+         ShapeBatch mShapeBatch;
+
+         // The rectangles the static light blocking rectangles were merged into, handed to the lights in their place.
+         std::vector<std::unique_ptr<Objects::RectangleObject>> mBakedOccluders;
+
+         // The number of static light blocking rectangles when they were last merged.
+         unsigned int mStaticOccluderCount;
+
+         // Decides which dynamic lights are calculated each update and which reuse their points.
+         LightScheduler mLightScheduler;
+
+         // Whether the static lights or static light blocking rectangles changed since the static lights were worked
+         // out.
+         bool mStaticLightingChanged;
+
+         // Whether the static lights were worked out again since the baked light map was drawn.
+         bool mStaticLightMapStale;
+
+         // Whether the static lights were worked out again since the baked shadow map was drawn.
+         bool mStaticShadowMapStale;
+
+         // The number of static lights on the layer.
+         unsigned int mStaticLightCount;
+
+         // The colors of the static lights drawn over each other, drawn onto the main display in place of the lights.
+         ALLEGRO_BITMAP* mpStaticLightMap;
+
+         // The cleared areas of the static lights that overlap no other static light drawn over each other, subtracted
+         // from the shadow map in place of those lights.
+         ALLEGRO_BITMAP* mpStaticShadowMap;
+
+         // Whether the sprites of the layer are drawn from the cached chunks.
+         bool mIsStatic;
 
-         // Vector list of the animated sprites within the layer.
-         std::vector<AnimatedSprite*> mAnimatedSprites;
+         // The area the cached chunks cover, or zero by zero to cover the bitmap being drawn onto.
+         int mStaticAreaWidth;
+         int mStaticAreaHeight;
 
-         // Vector list of the particles within the layer.
-         std::vector<Particle*> mParticles;
+         // The size of the area the current grid of chunks was made for.
+         int mStaticCacheWidth;
+         int mStaticCacheHeight;
 
-         // Vector list of lights within the layer.
-         std::vector<Light*> mLights;
+         // The number of columns in the grid of chunks.
+         int mStaticChunkColumns;
 
-         // Vector list of objects that will block lights.
-         std::vector<Objects::Object*>  mLightBlockingObjects;
+         // The cached chunks of the layer's sprites, row by row.
+         std::vector<StaticLayerChunk> mStaticChunks;
    
       //***************************************************************************************************************
       // Member Variables - End
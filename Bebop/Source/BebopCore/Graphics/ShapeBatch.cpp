@@ -0,0 +1,366 @@
+//*********************************************************************************************************************
+//
+// File: ShapeBatch.cpp
+//
+// Description:
+//    This class collects filled rectangles, circles, triangles, and lines into one list of triangles so they can be
+//    drawn with a single primitive call instead of one call per shape. Circles are built from shared unit circle
+//    tables, with the table picked by the radius of the circle on the screen, so circles are not worked out again
+//    every time they are drawn. The triangle list is kept between flushes so its memory is reused every frame.
+//
+//*********************************************************************************************************************
+
+#include "ShapeBatch.h"
+#include "GraphicsConstants.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Bebop { namespace Graphics
+{
+   namespace
+   {
+      // The points around circles of radius one, one table for each segment count from the fewest segments to the
+      // most, doubling each time. Each table repeats its first point at the end to close the circle.
+      struct UnitCircleTables
+      {
+         UnitCircleTables()
+         {
+            const float fullTurn = 2.0F * static_cast<float>(ALLEGRO_PI);
+            for (unsigned int segments = MIN_CIRCLE_SEGMENTS; segments <= MAX_CIRCLE_SEGMENTS; segments *= 2)
+            {
+               std::vector<Math::Vector2D<float>> table;
+               for (unsigned int i = 0; i <= segments; ++i)
+               {
+                  float angle = fullTurn * static_cast<float>(i % segments) / static_cast<float>(segments);
+                  table.push_back(Math::Vector2D<float>(std::cos(angle), std::sin(angle)));
+               }
+               tables.push_back(table);
+            }
+         }
+
+         std::vector<std::vector<Math::Vector2D<float>>> tables;
+      };
+
+      const UnitCircleTables unitCircleTables;
+
+      //***************************************************************************************************************
+      //
+      // Method: GetCircleTableIndex
+      //
+      // Description:
+      //    Picks the unit circle table for a radius, which is the one with the fewest segments that still gives the
+      //    wanted quality.
+      //
+      // Arguments:
+      //    aRadius - The radius of the circle on the screen.
+      //
+      // Return:
+      //    Returns the index of the table to use.
+      //
+      //***************************************************************************************************************
+      unsigned int GetCircleTableIndex(const float aRadius)
+      {
+         float wantedSegments = CIRCLE_SEGMENT_QUALITY * std::sqrt(std::max(aRadius, 0.0F));
+         unsigned int index = 0;
+         for (unsigned int segments = MIN_CIRCLE_SEGMENTS;
+              segments < MAX_CIRCLE_SEGMENTS && static_cast<float>(segments) < wantedSegments; segments *= 2)
+         {
+            ++index;
+         }
+
+         return index;
+      }
+   }
+
+//*********************************************************************************************************************
+// Public Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: ShapeBatch
+   //
+   // Description:
+   //    Constructor for an empty batch.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   ShapeBatch::ShapeBatch()
+   {
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: ~ShapeBatch
+   //
+   // Description:
+   //    Destructor for the batch. Shapes that were not flushed are not drawn.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   ShapeBatch::~ShapeBatch()
+   {
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AddRectangle
+   //
+   // Description:
+   //    Adds a filled rectangle to the batch.
+   //
+   // Arguments:
+   //    aLeft   - The X-Coordinate of the left side of the rectangle.
+   //    aTop    - The Y-Coordinate of the top side of the rectangle.
+   //    aRight  - The X-Coordinate of the right side of the rectangle.
+   //    aBottom - The Y-Coordinate of the bottom side of the rectangle.
+   //    aColor  - The color of the rectangle.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void ShapeBatch::AddRectangle(const float aLeft, const float aTop, const float aRight, const float aBottom,
+                                 const ALLEGRO_COLOR aColor)
+   {
+      AddVertex(aLeft, aTop, aColor);
+      AddVertex(aRight, aTop, aColor);
+      AddVertex(aRight, aBottom, aColor);
+
+      AddVertex(aLeft, aTop, aColor);
+      AddVertex(aRight, aBottom, aColor);
+      AddVertex(aLeft, aBottom, aColor);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AddCircle
+   //
+   // Description:
+   //    Adds a filled circle to the batch as a fan of triangles around its center. Larger circles use a unit circle
+   //    table with more segments.
+   //
+   // Arguments:
+   //    aCenterX - The X-Coordinate of the center of the circle.
+   //    aCenterY - The Y-Coordinate of the center of the circle.
+   //    aRadius  - The radius of the circle on the screen. Circles without a radius add nothing.
+   //    aColor   - The color of the circle.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void ShapeBatch::AddCircle(const float aCenterX, const float aCenterY, const float aRadius,
+                              const ALLEGRO_COLOR aColor)
+   {
+      if (aRadius <= 0.0F)
+      {
+         return;
+      }
+
+      const std::vector<Math::Vector2D<float>>& table = unitCircleTables.tables[GetCircleTableIndex(aRadius)];
+      for (unsigned int i = 0; i + 1 < table.size(); ++i)
+      {
+         AddVertex(aCenterX, aCenterY, aColor);
+         AddVertex(aCenterX + (table[i].GetComponentX() * aRadius), aCenterY + (table[i].GetComponentY() * aRadius),
+                   aColor);
+         AddVertex(aCenterX + (table[i + 1].GetComponentX() * aRadius),
+                   aCenterY + (table[i + 1].GetComponentY() * aRadius), aColor);
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AddTriangle
+   //
+   // Description:
+   //    Adds a filled triangle to the batch, such as one piece of a convex polygon.
+   //
+   // Arguments:
+   //    aFirstPoint  - The first corner of the triangle.
+   //    aSecondPoint - The second corner of the triangle.
+   //    aThirdPoint  - The third corner of the triangle.
+   //    aColor       - The color of the triangle.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void ShapeBatch::AddTriangle(const Math::Vector2D<float>& aFirstPoint, const Math::Vector2D<float>& aSecondPoint,
+                                const Math::Vector2D<float>& aThirdPoint, const ALLEGRO_COLOR aColor)
+   {
+      AddVertex(aFirstPoint.GetComponentX(), aFirstPoint.GetComponentY(), aColor);
+      AddVertex(aSecondPoint.GetComponentX(), aSecondPoint.GetComponentY(), aColor);
+      AddVertex(aThirdPoint.GetComponentX(), aThirdPoint.GetComponentY(), aColor);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AddLine
+   //
+   // Description:
+   //    Adds a line to the batch as a thin rectangle around the line. Lines without a length add nothing.
+   //
+   // Arguments:
+   //    aStartPoint - The point the line starts at.
+   //    aEndPoint   - The point the line ends at.
+   //    aThickness  - The thickness of the line.
+   //    aColor      - The color of the line.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void ShapeBatch::AddLine(const Math::Vector2D<float>& aStartPoint, const Math::Vector2D<float>& aEndPoint,
+                            const float aThickness, const ALLEGRO_COLOR aColor)
+   {
+      Math::Vector2D<float> direction = aEndPoint - aStartPoint;
+      float length = std::sqrt(direction.Dot(direction));
+      if (length <= 0.0F)
+      {
+         return;
+      }
+
+      // Push each side of the line out by half the thickness, at a right angle to the line.
+      float scale = (aThickness * 0.5F) / length;
+      Math::Vector2D<float> side(-direction.GetComponentY() * scale, direction.GetComponentX() * scale);
+      AddTriangle(aStartPoint + side, aEndPoint + side, aEndPoint - side, aColor);
+      AddTriangle(aStartPoint + side, aEndPoint - side, aStartPoint - side, aColor);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: Flush
+   //
+   // Description:
+   //    Draws every shape added since the last flush onto the target bitmap with a single primitive call and empties
+   //    the batch. Nothing is drawn if the batch is empty.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void ShapeBatch::Flush()
+   {
+      if (mVertices.empty() == false)
+      {
+         al_draw_prim(mVertices.data(), NULL, NULL, 0, static_cast<int>(mVertices.size()),
+                      ALLEGRO_PRIM_TRIANGLE_LIST);
+         mVertices.clear();
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: Clear
+   //
+   // Description:
+   //    Empties the batch without drawing the shapes in it.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void ShapeBatch::Clear()
+   {
+      mVertices.clear();
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetVertexCount
+   //
+   // Description:
+   //    Returns the number of vertices waiting to be drawn.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the number of vertices in the batch.
+   //
+   //******************************************************************************************************************
+   unsigned int ShapeBatch::GetVertexCount() const
+   {
+      return static_cast<unsigned int>(mVertices.size());
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetCircleSegmentCount
+   //
+   // Description:
+   //    Returns the number of segments a circle of the passed in radius is built from.
+   //
+   // Arguments:
+   //    aRadius - The radius of the circle on the screen.
+   //
+   // Return:
+   //    Returns the number of segments of the unit circle table used for the radius.
+   //
+   //******************************************************************************************************************
+   unsigned int ShapeBatch::GetCircleSegmentCount(const float aRadius)
+   {
+      return static_cast<unsigned int>(unitCircleTables.tables[GetCircleTableIndex(aRadius)].size()) - 1;
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: AddVertex
+   //
+   // Description:
+   //    Adds a single untextured vertex to the batch.
+   //
+   // Arguments:
+   //    aX     - The X-Coordinate of the vertex.
+   //    aY     - The Y-Coordinate of the vertex.
+   //    aColor - The color of the vertex.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void ShapeBatch::AddVertex(const float aX, const float aY, const ALLEGRO_COLOR aColor)
+   {
+      ALLEGRO_VERTEX vertex = {aX, aY, 0, 0, 0, aColor};
+      mVertices.push_back(vertex);
+   }
+
+//*********************************************************************************************************************
+// Private Methods - End
+//*********************************************************************************************************************
+}}
@@ -0,0 +1,259 @@
+//*********************************************************************************************************************
+//
+// File: ShapeBatch.h
+//
+// Description:
+//    This class collects filled rectangles, circles, triangles, and lines into one list of triangles so they can be
+//    drawn with a single primitive call instead of one call per shape. Circles are built from shared unit circle
+//    tables, with the table picked by the radius of the circle on the screen, so circles are not worked out again
+//    every time they are drawn. The triangle list is kept between flushes so its memory is reused every frame.
+//
+//*********************************************************************************************************************
+
+#ifndef ShapeBatch_H
+#define ShapeBatch_H
+
+#include <allegro5/allegro.h>
+#include <allegro5/allegro_primitives.h>
+#include "../Math/Vector2D.h"
+#include <vector>
+
+namespace Bebop { namespace Graphics
+{
+   class ShapeBatch
+   {
+      //***************************************************************************************************************
+      // Methods - Start
+      //***************************************************************************************************************
+
+      public:
+
+         //************************************************************************************************************
+         //
+         // Method: ShapeBatch
+         //
+         // Description:
+         //    Constructor for an empty batch.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         ShapeBatch();
+
+         //************************************************************************************************************
+         //
+         // Method: ~ShapeBatch
+         //
+         // Description:
+         //    Destructor for the batch. Shapes that were not flushed are not drawn.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         ~ShapeBatch();
+
+         //************************************************************************************************************
+         //
+         // Method: AddRectangle
+         //
+         // Description:
+         //    Adds a filled rectangle to the batch.
+         //
+         // Arguments:
+         //    aLeft   - The X-Coordinate of the left side of the rectangle.
+         //    aTop    - The Y-Coordinate of the top side of the rectangle.
+         //    aRight  - The X-Coordinate of the right side of the rectangle.
+         //    aBottom - The Y-Coordinate of the bottom side of the rectangle.
+         //    aColor  - The color of the rectangle.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void AddRectangle(const float aLeft, const float aTop, const float aRight, const float aBottom,
+                           const ALLEGRO_COLOR aColor);
+
+         //************************************************************************************************************
+         //
+         // Method: AddCircle
+         //
+         // Description:
+         //    Adds a filled circle to the batch. Larger circles use a unit circle table with more segments.
+         //
+         // Arguments:
+         //    aCenterX - The X-Coordinate of the center of the circle.
+         //    aCenterY - The Y-Coordinate of the center of the circle.
+         //    aRadius  - The radius of the circle on the screen. Circles without a radius add nothing.
+         //    aColor   - The color of the circle.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void AddCircle(const float aCenterX, const float aCenterY, const float aRadius, const ALLEGRO_COLOR aColor);
+
+         //************************************************************************************************************
+         //
+         // Method: AddTriangle
+         //
+         // Description:
+         //    Adds a filled triangle to the batch, such as one piece of a convex polygon.
+         //
+         // Arguments:
+         //    aFirstPoint  - The first corner of the triangle.
+         //    aSecondPoint - The second corner of the triangle.
+         //    aThirdPoint  - The third corner of the triangle.
+         //    aColor       - The color of the triangle.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void AddTriangle(const Math::Vector2D<float>& aFirstPoint, const Math::Vector2D<float>& aSecondPoint,
+                          const Math::Vector2D<float>& aThirdPoint, const ALLEGRO_COLOR aColor);
+
+         //************************************************************************************************************
+         //
+         // Method: AddLine
+         //
+         // Description:
+         //    Adds a line to the batch as a thin rectangle around the line. Lines without a length add nothing.
+         //
+         // Arguments:
+         //    aStartPoint - The point the line starts at.
+         //    aEndPoint   - The point the line ends at.
+         //    aThickness  - The thickness of the line.
+         //    aColor      - The color of the line.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void AddLine(const Math::Vector2D<float>& aStartPoint, const Math::Vector2D<float>& aEndPoint,
+                      const float aThickness, const ALLEGRO_COLOR aColor);
+
+         //************************************************************************************************************
+         //
+         // Method: Flush
+         //
+         // Description:
+         //    Draws every shape added since the last flush onto the target bitmap with a single primitive call and
+         //    empties the batch. Nothing is drawn if the batch is empty.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void Flush();
+
+         //************************************************************************************************************
+         //
+         // Method: Clear
+         //
+         // Description:
+         //    Empties the batch without drawing the shapes in it.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void Clear();
+
+         //************************************************************************************************************
+         //
+         // Method: GetVertexCount
+         //
+         // Description:
+         //    Returns the number of vertices waiting to be drawn.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the number of vertices in the batch.
+         //
+         //************************************************************************************************************
+         unsigned int GetVertexCount() const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetCircleSegmentCount
+         //
+         // Description:
+         //    Returns the number of segments a circle of the passed in radius is built from.
+         //
+         // Arguments:
+         //    aRadius - The radius of the circle on the screen.
+         //
+         // Return:
+         //    Returns the number of segments of the unit circle table used for the radius.
+         //
+         //************************************************************************************************************
+         static unsigned int GetCircleSegmentCount(const float aRadius);
+
+      protected:
+
+         // There are currently no protected methods for this class.
+
+      private:
+
+         //************************************************************************************************************
+         //
+         // Method: AddVertex
+         //
+         // Description:
+         //    Adds a single untextured vertex to the batch.
+         //
+         // Arguments:
+         //    aX     - The X-Coordinate of the vertex.
+         //    aY     - The Y-Coordinate of the vertex.
+         //    aColor - The color of the vertex.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void AddVertex(const float aX, const float aY, const ALLEGRO_COLOR aColor);
+
+      //***************************************************************************************************************
+      // Methods - End
+      //***************************************************************************************************************
+
+      //***************************************************************************************************************
+      // Member Variables - Start
+      //***************************************************************************************************************
+
+      public:
+
+         // There are currently no public member variables for this class.
+
+      protected:
+
+         // There are currently no protected member variables for this class.
+
+      private:
+
+         // The vertices of the batched shapes, three for each triangle.
+         std::vector<ALLEGRO_VERTEX> mVertices;
+
+      //***************************************************************************************************************
+      // Member Variables - End
+      //***************************************************************************************************************
+   };
+}}
+
+#endif // ShapeBatch_H
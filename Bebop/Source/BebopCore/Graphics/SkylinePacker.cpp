@@ -0,0 +1,273 @@
+//*********************************************************************************************************************
+//
+// File: SkylinePacker.cpp
+//
+// Description:
+//    This class packs rectangles into a fixed size page using the skyline bottom-left method. The top edge of the
+//    packed rectangles is kept as a list of horizontal segments, and each new rectangle is placed where its top edge
+//    ends up the lowest, ties going to the placement that wastes the least width.
+//
+//*********************************************************************************************************************
+
+#include "SkylinePacker.h"
+
+namespace Bebop { namespace Graphics
+{
+//*********************************************************************************************************************
+// Public Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: SkylinePacker
+   //
+   // Description:
+   //    Constructor for a packer with an empty page of the passed in size.
+   //
+   // Arguments:
+   //    aWidth  - The width of the page.
+   //    aHeight - The height of the page.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   SkylinePacker::SkylinePacker(const int aWidth, const int aHeight) :
+      mWidth(aWidth), mHeight(aHeight)
+   {
+      SkylineSegment floor = {0, 0, aWidth};
+      mSkyline.push_back(floor);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: ~SkylinePacker
+   //
+   // Description:
+   //    Destructor for the skyline packer.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   SkylinePacker::~SkylinePacker()
+   {
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: Insert
+   //
+   // Description:
+   //    Finds a place for a rectangle on the page and marks the area as used.
+   //
+   // Arguments:
+   //    aWidth  - The width of the rectangle.
+   //    aHeight - The height of the rectangle.
+   //    apX     - Updated with the X-Coordinate of the top left corner of the placed rectangle.
+   //    apY     - Updated with the Y-Coordinate of the top left corner of the placed rectangle.
+   //
+   // Return:
+   //    True  - The rectangle was placed.
+   //    False - The rectangle does not fit on what is left of the page.
+   //
+   //******************************************************************************************************************
+   bool SkylinePacker::Insert(const int aWidth, const int aHeight, int* apX, int* apY)
+   {
+      if (aWidth <= 0 || aHeight <= 0)
+      {
+         return false;
+      }
+
+      bool found = false;
+      unsigned int bestSegment = 0;
+      int bestTop = 0;
+      int bestWidth = 0;
+      int bestY = 0;
+
+      for (unsigned int i = 0; i < mSkyline.size(); ++i)
+      {
+         int y = 0;
+         if (FindFitHeight(i, aWidth, aHeight, &y) == true)
+         {
+            int top = y + aHeight;
+            if (found == false || top < bestTop || (top == bestTop && mSkyline[i].width < bestWidth))
+            {
+               found = true;
+               bestSegment = i;
+               bestTop = top;
+               bestWidth = mSkyline[i].width;
+               bestY = y;
+            }
+         }
+      }
+
+      if (found == false)
+      {
+         return false;
+      }
+
+      *apX = mSkyline[bestSegment].x;
+      *apY = bestY;
+      AddSegment(bestSegment, *apX, bestTop, aWidth);
+      return true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetUsedHeight
+   //
+   // Description:
+   //    Returns the height of the tallest point of the skyline.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the used height of the page.
+   //
+   //******************************************************************************************************************
+   int SkylinePacker::GetUsedHeight() const
+   {
+      int usedHeight = 0;
+      for (auto iterator = mSkyline.begin(); iterator != mSkyline.end(); ++iterator)
+      {
+         if (iterator->y > usedHeight)
+         {
+            usedHeight = iterator->y;
+         }
+      }
+
+      return usedHeight;
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: FindFitHeight
+   //
+   // Description:
+   //    Finds the height a rectangle would rest at if its left edge is placed at the start of a segment.
+   //
+   // Arguments:
+   //    aSegment - The index of the segment the rectangle starts at.
+   //    aWidth   - The width of the rectangle.
+   //    aHeight  - The height of the rectangle.
+   //    apY      - Updated with the Y-Coordinate the rectangle would rest at.
+   //
+   // Return:
+   //    True  - The rectangle fits at the segment.
+   //    False - The rectangle runs past the right or bottom edge of the page.
+   //
+   //******************************************************************************************************************
+   bool SkylinePacker::FindFitHeight(const unsigned int aSegment, const int aWidth, const int aHeight, int* apY) const
+   {
+      if (mSkyline[aSegment].x + aWidth > mWidth)
+      {
+         return false;
+      }
+
+      // The rectangle rests on the highest segment under its width.
+      int y = 0;
+      int widthLeft = aWidth;
+      for (unsigned int i = aSegment; widthLeft > 0; ++i)
+      {
+         if (mSkyline[i].y > y)
+         {
+            y = mSkyline[i].y;
+         }
+
+         if (y + aHeight > mHeight)
+         {
+            return false;
+         }
+
+         widthLeft -= mSkyline[i].width;
+      }
+
+      *apY = y;
+      return true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AddSegment
+   //
+   // Description:
+   //    Raises the skyline over a placed rectangle, trimming the segments it covers and merging neighboring segments
+   //    of the same height.
+   //
+   // Arguments:
+   //    aSegment - The index of the segment the rectangle starts at.
+   //    aX       - The X-Coordinate of the placed rectangle.
+   //    aY       - The Y-Coordinate of the bottom of the placed rectangle.
+   //    aWidth   - The width of the placed rectangle.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void SkylinePacker::AddSegment(const unsigned int aSegment, const int aX, const int aY, const int aWidth)
+   {
+      SkylineSegment segment = {aX, aY, aWidth};
+      mSkyline.insert(mSkyline.begin() + aSegment, segment);
+
+      // Trim or remove the segments now covered by the new segment.
+      unsigned int i = aSegment + 1;
+      while (i < mSkyline.size())
+      {
+         int overlap = (aX + aWidth) - mSkyline[i].x;
+         if (overlap <= 0)
+         {
+            break;
+         }
+
+         if (overlap < mSkyline[i].width)
+         {
+            mSkyline[i].x += overlap;
+            mSkyline[i].width -= overlap;
+            break;
+         }
+
+         mSkyline.erase(mSkyline.begin() + i);
+      }
+
+      // Merge neighboring segments at the same height.
+      for (i = 0; i + 1 < mSkyline.size();)
+      {
+         if (mSkyline[i].y == mSkyline[i + 1].y)
+         {
+            mSkyline[i].width += mSkyline[i + 1].width;
+            mSkyline.erase(mSkyline.begin() + i + 1);
+         }
+         else
+         {
+            ++i;
+         }
+      }
+   }
+
+//*********************************************************************************************************************
+// Private Methods - End
+//*********************************************************************************************************************
+}}
@@ -0,0 +1,183 @@
+//*********************************************************************************************************************
+//
+// File: SkylinePacker.h
+//
+// Description:
+//    This class packs rectangles into a fixed size page using the skyline bottom-left method. The top edge of the
+//    packed rectangles is kept as a list of horizontal segments, and each new rectangle is placed where its top edge
+//    ends up the lowest, ties going to the placement that wastes the least width.
+//
+//*********************************************************************************************************************
+
+#ifndef SkylinePacker_H
+#define SkylinePacker_H
+
+#include <vector>
+
+namespace Bebop { namespace Graphics
+{
+   // A horizontal segment of the skyline. The area below the segment is used.
+   struct SkylineSegment
+   {
+      int x;
+      int y;
+      int width;
+   };
+
+   class SkylinePacker
+   {
+      //***************************************************************************************************************
+      // Methods - Start
+      //***************************************************************************************************************
+
+      public:
+
+         //************************************************************************************************************
+         //
+         // Method: SkylinePacker
+         //
+         // Description:
+         //    Constructor for a packer with an empty page of the passed in size.
+         //
+         // Arguments:
+         //    aWidth  - The width of the page.
+         //    aHeight - The height of the page.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         SkylinePacker(const int aWidth, const int aHeight);
+
+         //************************************************************************************************************
+         //
+         // Method: ~SkylinePacker
+         //
+         // Description:
+         //    Destructor for the skyline packer.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         ~SkylinePacker();
+
+         //************************************************************************************************************
+         //
+         // Method: Insert
+         //
+         // Description:
+         //    Finds a place for a rectangle on the page and marks the area as used.
+         //
+         // Arguments:
+         //    aWidth  - The width of the rectangle.
+         //    aHeight - The height of the rectangle.
+         //    apX     - Updated with the X-Coordinate of the top left corner of the placed rectangle.
+         //    apY     - Updated with the Y-Coordinate of the top left corner of the placed rectangle.
+         //
+         // Return:
+         //    True  - The rectangle was placed.
+         //    False - The rectangle does not fit on what is left of the page.
+         //
+         //************************************************************************************************************
+         bool Insert(const int aWidth, const int aHeight, int* apX, int* apY);
+
+         //************************************************************************************************************
+         //
+         // Method: GetUsedHeight
+         //
+         // Description:
+         //    Returns the height of the tallest point of the skyline.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the used height of the page.
+         //
+         //************************************************************************************************************
+         int GetUsedHeight() const;
+
+      protected:
+
+         // There are currently no protected methods for this class.
+
+      private:
+
+         //************************************************************************************************************
+         //
+         // Method: FindFitHeight
+         //
+         // Description:
+         //    Finds the height a rectangle would rest at if its left edge is placed at the start of a segment.
+         //
+         // Arguments:
+         //    aSegment - The index of the segment the rectangle starts at.
+         //    aWidth   - The width of the rectangle.
+         //    aHeight  - The height of the rectangle.
+         //    apY      - Updated with the Y-Coordinate the rectangle would rest at.
+         //
+         // Return:
+         //    True  - The rectangle fits at the segment.
+         //    False - The rectangle runs past the right or bottom edge of the page.
+         //
+         //************************************************************************************************************
+         bool FindFitHeight(const unsigned int aSegment, const int aWidth, const int aHeight, int* apY) const;
+
+         //************************************************************************************************************
+         //
+         // Method: AddSegment
+         //
+         // Description:
+         //    Raises the skyline over a placed rectangle, trimming the segments it covers and merging neighboring
+         //    segments of the same height.
+         //
+         // Arguments:
+         //    aSegment - The index of the segment the rectangle starts at.
+         //    aX       - The X-Coordinate of the placed rectangle.
+         //    aY       - The Y-Coordinate of the bottom of the placed rectangle.
+         //    aWidth   - The width of the placed rectangle.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void AddSegment(const unsigned int aSegment, const int aX, const int aY, const int aWidth);
+
+      //***************************************************************************************************************
+      // Methods - End
+      //***************************************************************************************************************
+
+      //***************************************************************************************************************
+      // Member Variables - Start
+      //***************************************************************************************************************
+
+      public:
+
+         // There are currently no public member variables for this class.
+
+      protected:
+
+         // There are currently no protected member variables for this class.
+
+      private:
+
+         // The width of the page.
+         int mWidth;
+
+         // The height of the page.
+         int mHeight;
+
+         // The segments of the skyline ordered from left to right, covering the full width of the page.
+         std::vector<SkylineSegment> mSkyline;
+
+      //***************************************************************************************************************
+      // Member Variables - End
+      //***************************************************************************************************************
+   };
+}}
+
+#endif // SkylinePacker_H
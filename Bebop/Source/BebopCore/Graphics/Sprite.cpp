@@ -8,6 +8,8 @@
 //*********************************************************************************************************************
 
 #include "Sprite.h"
+#include "GraphicsConstants.h"
+#include "RenderState.h"
 
 namespace Bebop { namespace Graphics
 {
@@ -37,7 +39,8 @@ namespace Bebop { namespace Graphics
    //******************************************************************************************************************
    Sprite::Sprite(const std::string aFilePath, const Math::Vector2D<int> aSource, const int aWidth,
                   const int aHeight, const Math::Vector2D<float> aPosition, float aRotation) :
-      mSource(aSource), mWidth(aWidth), mHeight(aHeight), mPosition(aPosition), mRotation(aRotation)
+      mSource(aSource), mWidth(aWidth), mHeight(aHeight), mPosition(aPosition), mRotation(aRotation),
+      mOwnsSpriteSheet(true)
    {
       if (nullptr == (mpSpriteSheet = al_load_bitmap(aFilePath.c_str())))
       {
@@ -46,6 +49,79 @@ namespace Bebop { namespace Graphics
 
       al_convert_mask_to_alpha(mpSpriteSheet, al_map_rgb(255, 0, 255));
    }
+
+   //******************************************************************************************************************
+   //
+   // Method: Sprite
+   //
+   // Description:
+   //    Constructor for the sprite class that draws from an image packed into a texture atlas. The source location is
+   //    given relative to the original image and is moved to the image's place in the atlas. If the image is not in
+   //    the atlas it is loaded on its own instead.
+   //
+   // Arguments:
+   //    aAtlas    - The atlas holding the image. It must outlive the sprite.
+   //    aFilePath - This string depicts the file location the image was added to the atlas with.
+   //    aSource   - The X-Coordinate and Y-Coordinate on the original image to start drawing from.
+   //    aWidth    - The width of the sprite image.
+   //    aHeight   - The height of the sprite image.
+   //    aPosition - The X-Coordinate and Y-Coordinate to draw the sprite.
+   //    aRotation - The rotation angle in radians to the rotate the image.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   Sprite::Sprite(const TextureAtlas& aAtlas, const std::string aFilePath, const Math::Vector2D<int> aSource,
+                  const int aWidth, const int aHeight, const Math::Vector2D<float> aPosition, float aRotation) :
+      mSource(aSource), mWidth(aWidth), mHeight(aHeight), mPosition(aPosition), mRotation(aRotation),
+      mpSpriteSheet(nullptr), mOwnsSpriteSheet(false)
+   {
+      AtlasRegion region;
+      if (aAtlas.GetRegion(aFilePath, &region) == true)
+      {
+         mpSpriteSheet = aAtlas.GetPage(region.page);
+         mSource.SetComponentX(mSource.GetComponentX() + region.x);
+         mSource.SetComponentY(mSource.GetComponentY() + region.y);
+         return;
+      }
+
+      mOwnsSpriteSheet = true;
+      if (nullptr == (mpSpriteSheet = al_load_bitmap(aFilePath.c_str())))
+      {
+         Terminate();
+      }
+
+      al_convert_mask_to_alpha(mpSpriteSheet, al_map_rgb(255, 0, 255));
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: Sprite
+   //
+   // Description:
+   //    Constructor for the sprite class that loads its image in the background. A placeholder rectangle is drawn in
+   //    place of the sprite until the loader has uploaded the image.
+   //
+   // Arguments:
+   //    aLoader   - The loader that loads the image.
+   //    aFilePath - This string depicts the file location of the sprite image.
+   //    aSource   - The X-Coordinate and Y-Coordinate on the image to start drawing from.
+   //    aWidth    - The width of the sprite image.
+   //    aHeight   - The height of the sprite image.
+   //    aPosition - The X-Coordinate and Y-Coordinate to draw the sprite.
+   //    aRotation - The rotation angle in radians to the rotate the image.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   Sprite::Sprite(AssetLoader& aLoader, const std::string aFilePath, const Math::Vector2D<int> aSource,
+                  const int aWidth, const int aHeight, const Math::Vector2D<float> aPosition, float aRotation) :
+      mSource(aSource), mWidth(aWidth), mHeight(aHeight), mPosition(aPosition), mRotation(aRotation),
+      mpSpriteSheet(nullptr), mOwnsSpriteSheet(false), mpSpriteSheetAsset(aLoader.RequestBitmap(aFilePath))
+   {
+   }
    
    //******************************************************************************************************************
    //
@@ -142,6 +218,44 @@ namespace Bebop { namespace Graphics
       return mPosition.GetComponentY();
    }
 
+   //******************************************************************************************************************
+   //
+   // Method: GetWidth
+   //
+   // Description:
+   //    Returns the width of the sprite.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the width of the sprite.
+   //
+   //******************************************************************************************************************
+   int Sprite::GetWidth() const
+   {
+      return mWidth;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetHeight
+   //
+   // Description:
+   //    Returns the height of the sprite.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the height of the sprite.
+   //
+   //******************************************************************************************************************
+   int Sprite::GetHeight() const
+   {
+      return mHeight;
+   }
+
    //******************************************************************************************************************
    //
    // Method: Draw
@@ -158,34 +272,8 @@ namespace Bebop { namespace Graphics
    //******************************************************************************************************************
    void Sprite::Draw() const
    {
-      // Retreive the main display drawing area so it can be reverted back to.
-      ALLEGRO_BITMAP* displayDrawingArea = al_get_target_bitmap();
-
-      // Create a temporary bitmap to retrieve the correct image from the sprite sheet.
-      ALLEGRO_BITMAP* tempBitmap = al_create_bitmap(mWidth, mHeight);
-      al_set_target_bitmap(tempBitmap);
-      al_clear_to_color(al_map_rgb(0, 0, 0));
-      al_draw_bitmap_region(mpSpriteSheet,
-                            mSource.GetComponentX(),
-                            mSource.GetComponentY(),
-                            mWidth,
-                            mHeight,
-                            0.0F,
-                            0.0F,
-                            0);
-
-      // Revert back to the main drawing area and draw the sprite image onto the main area.
-      al_set_target_bitmap(displayDrawingArea);
-      al_draw_rotated_bitmap(tempBitmap,
-                             al_get_bitmap_width(tempBitmap)/2,
-                             al_get_bitmap_height(tempBitmap)/2,
-                             mPosition.GetComponentX() + (al_get_bitmap_width(tempBitmap)/2),
-                             mPosition.GetComponentY() + (al_get_bitmap_height(tempBitmap)/2),
-                             mRotation,
-                             0);
-      
-      // Clean up memory allocation.
-      al_destroy_bitmap(tempBitmap);
+      DrawRegion(Math::Vector2D<int>(0, 0), mWidth, mHeight, mPosition, mRotation,
+                 al_map_rgba_f(1.0F, 1.0F, 1.0F, 1.0F));
    }
 
    //******************************************************************************************************************
@@ -204,37 +292,91 @@ namespace Bebop { namespace Graphics
    //******************************************************************************************************************
    void Sprite::DrawTinted(unsigned int aAlpha) const
    {
+      DrawRegion(Math::Vector2D<int>(0, 0), mWidth, mHeight, mPosition, mRotation, al_map_rgba(0, 0, 0, aAlpha));
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: DrawRegion
+   //
+   // Description:
+   //    Draws part of the sprite's image at a position and rotation that are not the sprite's own. This lets many
+   //    entities of a scene layer share one sprite as their image while keeping their position and frame themselves.
+   //
+   // Arguments:
+   //    aSource   - The X-Coordinate and Y-Coordinate to start drawing from, relative to the sprite's source.
+   //    aWidth    - The width of the part being drawn.
+   //    aHeight   - The height of the part being drawn.
+   //    aPosition - The position the part is drawn at.
+   //    aRotation - The rotation the part is drawn with.
+   //    aTint     - The color the part is tinted with. White draws the part unchanged.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void Sprite::DrawRegion(const Math::Vector2D<int> aSource, const int aWidth, const int aHeight,
+                           const Math::Vector2D<float> aPosition, const float aRotation,
+                           const ALLEGRO_COLOR aTint) const
+   {
+      ALLEGRO_BITMAP* pSpriteSheet = GetSpriteSheet();
+      if (pSpriteSheet == nullptr)
+      {
+         DrawPlaceholder(aPosition, aWidth, aHeight);
+         return;
+      }
+
       // Retreive the main display drawing area so it can be reverted back to.
-      ALLEGRO_BITMAP* displayDrawingArea = al_get_target_bitmap();
+      ALLEGRO_BITMAP* displayDrawingArea = RenderState::GetTargetBitmap();
 
       // Create a temporary bitmap to retrieve the correct image from the sprite sheet.
-      ALLEGRO_BITMAP* tempBitmap = al_create_bitmap(mWidth, mHeight);
-      al_set_target_bitmap(tempBitmap);
+      ALLEGRO_BITMAP* tempBitmap = al_create_bitmap(aWidth, aHeight);
+      RenderState::SetTargetBitmap(tempBitmap);
       al_clear_to_color(al_map_rgb(0, 0, 0));
-      al_draw_tinted_bitmap_region(mpSpriteSheet,
-                                   al_map_rgba(0, 0, 0, aAlpha),
-                                   mSource.GetComponentX(),
-                                   mSource.GetComponentY(),
-                                   mWidth,
-                                   mHeight,
+      al_draw_tinted_bitmap_region(pSpriteSheet,
+                                   aTint,
+                                   mSource.GetComponentX() + aSource.GetComponentX(),
+                                   mSource.GetComponentY() + aSource.GetComponentY(),
+                                   aWidth,
+                                   aHeight,
                                    0.0F,
                                    0.0F,
                                    0);
 
       // Revert back to the main drawing area and draw the sprite image onto the main area.
-      al_set_target_bitmap(displayDrawingArea);
+      RenderState::SetTargetBitmap(displayDrawingArea);
       al_draw_rotated_bitmap(tempBitmap,
                              al_get_bitmap_width(tempBitmap)/2,
                              al_get_bitmap_height(tempBitmap)/2,
-                             mPosition.GetComponentX() + (al_get_bitmap_width(tempBitmap)/2),
-                             mPosition.GetComponentY() + (al_get_bitmap_height(tempBitmap)/2),
-                             mRotation,
+                             aPosition.GetComponentX() + (al_get_bitmap_width(tempBitmap)/2),
+                             aPosition.GetComponentY() + (al_get_bitmap_height(tempBitmap)/2),
+                             aRotation,
                              0);
       
       // Clean up memory allocation.
       al_destroy_bitmap(tempBitmap);
    }
 
+   //******************************************************************************************************************
+   //
+   // Method: IsLoaded
+   //
+   // Description:
+   //    Checks if the sprite's image is available to draw.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    True  - The image is loaded.
+   //    False - The image is still loading in the background or failed to load.
+   //
+   //******************************************************************************************************************
+   bool Sprite::IsLoaded() const
+   {
+      return GetSpriteSheet() != nullptr;
+   }
+
 //*********************************************************************************************************************
 // Public Methods - End
 //*********************************************************************************************************************
@@ -270,7 +412,65 @@ namespace Bebop { namespace Graphics
    //******************************************************************************************************************
    void Sprite::Terminate()
    {
-      al_destroy_bitmap(mpSpriteSheet);
+      // Pages of a texture atlas belong to the atlas.
+      if (mOwnsSpriteSheet == true)
+      {
+         al_destroy_bitmap(mpSpriteSheet);
+      }
+
+      mpSpriteSheet = nullptr;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetSpriteSheet
+   //
+   // Description:
+   //    Returns the bitmap to draw the sprite from, which for a sprite loading in the background is only set once the
+   //    image has been uploaded.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the sprite(sheet) bitmap, or nullptr if it is not ready.
+   //
+   //******************************************************************************************************************
+   ALLEGRO_BITMAP* Sprite::GetSpriteSheet() const
+   {
+      if (mpSpriteSheetAsset != nullptr)
+      {
+         return mpSpriteSheetAsset->state == ASSET_READY ? mpSpriteSheetAsset->pBitmap : nullptr;
+      }
+
+      return mpSpriteSheet;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: DrawPlaceholder
+   //
+   // Description:
+   //    Draws a rectangle the size of the part of the sprite being drawn in place of an image that is not loaded
+   //    yet.
+   //
+   // Arguments:
+   //    aPosition - The position the part is drawn at.
+   //    aWidth    - The width of the part being drawn.
+   //    aHeight   - The height of the part being drawn.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void Sprite::DrawPlaceholder(const Math::Vector2D<float> aPosition, const int aWidth, const int aHeight) const
+   {
+      al_draw_filled_rectangle(aPosition.GetComponentX(),
+                               aPosition.GetComponentY(),
+                               aPosition.GetComponentX() + aWidth,
+                               aPosition.GetComponentY() + aHeight,
+                               al_map_rgba(ASSET_PLACEHOLDER_RED, ASSET_PLACEHOLDER_GREEN, ASSET_PLACEHOLDER_BLUE,
+                                           ASSET_PLACEHOLDER_ALPHA));
    }
 
 //*********************************************************************************************************************
@@ -13,6 +13,9 @@
 #include <string>
 #include <allegro5/allegro.h>
 #include "../Math/Vector2D.h"
+#include "TextureAtlas.h"
+#include "AssetLoader.h"
+#include <memory>
 
 namespace Bebop { namespace Graphics
 {
@@ -48,6 +51,55 @@ namespace Bebop { namespace Graphics
          Sprite(const std::string aFilePath, const Math::Vector2D<int> aSource, const int aWidth,
                 const int aHeight, const Math::Vector2D<float> aPosition, float aRotation);
 
+         //************************************************************************************************************
+         //
+         // Method: Sprite
+         //
+         // Description:
+         //    Constructor for the sprite class that draws from an image packed into a texture atlas. The source
+         //    location is given relative to the original image and is moved to the image's place in the atlas. If
+         //    the image is not in the atlas it is loaded on its own instead.
+         //
+         // Arguments:
+         //    aAtlas    - The atlas holding the image. It must outlive the sprite.
+         //    aFilePath - This string depicts the file location the image was added to the atlas with.
+         //    aSource   - The X-Coordinate and Y-Coordinate on the original image to start drawing from.
+         //    aWidth    - The width of the sprite image.
+         //    aHeight   - The height of the sprite image.
+         //    aPosition - The X-Coordinate and Y-Coordinate to draw the sprite.
+         //    aRotation - The rotation angle in radians to the rotate the image.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         Sprite(const TextureAtlas& aAtlas, const std::string aFilePath, const Math::Vector2D<int> aSource,
+                const int aWidth, const int aHeight, const Math::Vector2D<float> aPosition, float aRotation);
+
+         //************************************************************************************************************
+         //
+         // Method: Sprite
+         //
+         // Description:
+         //    Constructor for the sprite class that loads its image in the background. A placeholder rectangle is
+         //    drawn in place of the sprite until the loader has uploaded the image.
+         //
+         // Arguments:
+         //    aLoader   - The loader that loads the image.
+         //    aFilePath - This string depicts the file location of the sprite image.
+         //    aSource   - The X-Coordinate and Y-Coordinate on the image to start drawing from.
+         //    aWidth    - The width of the sprite image.
+         //    aHeight   - The height of the sprite image.
+         //    aPosition - The X-Coordinate and Y-Coordinate to draw the sprite.
+         //    aRotation - The rotation angle in radians to the rotate the image.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         Sprite(AssetLoader& aLoader, const std::string aFilePath, const Math::Vector2D<int> aSource,
+                const int aWidth, const int aHeight, const Math::Vector2D<float> aPosition, float aRotation);
+
          //************************************************************************************************************
          //
          // Method: ~Sprite
@@ -128,6 +180,38 @@ namespace Bebop { namespace Graphics
          //************************************************************************************************************
          float GetPositionY() const;
 
+         //************************************************************************************************************
+         //
+         // Method: GetWidth
+         //
+         // Description:
+         //    Returns the width of the sprite.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the width of the sprite.
+         //
+         //************************************************************************************************************
+         int GetWidth() const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetHeight
+         //
+         // Description:
+         //    Returns the height of the sprite.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the height of the sprite.
+         //
+         //************************************************************************************************************
+         int GetHeight() const;
+
          //************************************************************************************************************
          //
          // Method: Draw
@@ -160,10 +244,87 @@ namespace Bebop { namespace Graphics
          //************************************************************************************************************
          void DrawTinted(unsigned int aAlpha) const;
 
+         //************************************************************************************************************
+         //
+         // Method: DrawRegion
+         //
+         // Description:
+         //    Draws part of the sprite's image at a position and rotation that are not the sprite's own. This lets
+         //    many entities of a scene layer share one sprite as their image while keeping their position and frame
+         //    themselves.
+         //
+         // Arguments:
+         //    aSource   - The X-Coordinate and Y-Coordinate to start drawing from, relative to the sprite's source.
+         //    aWidth    - The width of the part being drawn.
+         //    aHeight   - The height of the part being drawn.
+         //    aPosition - The position the part is drawn at.
+         //    aRotation - The rotation the part is drawn with.
+         //    aTint     - The color the part is tinted with. White draws the part unchanged.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void DrawRegion(const Math::Vector2D<int> aSource, const int aWidth, const int aHeight,
+                         const Math::Vector2D<float> aPosition, const float aRotation, const ALLEGRO_COLOR aTint) const;
+
+         //************************************************************************************************************
+         //
+         // Method: IsLoaded
+         //
+         // Description:
+         //    Checks if the sprite's image is available to draw.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    True  - The image is loaded.
+         //    False - The image is still loading in the background or failed to load.
+         //
+         //************************************************************************************************************
+         bool IsLoaded() const;
+
       protected:
 
       private:
 
+         //************************************************************************************************************
+         //
+         // Method: GetSpriteSheet
+         //
+         // Description:
+         //    Returns the bitmap to draw the sprite from, which for a sprite loading in the background is only set
+         //    once the image has been uploaded.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the sprite(sheet) bitmap, or nullptr if it is not ready.
+         //
+         //************************************************************************************************************
+         ALLEGRO_BITMAP* GetSpriteSheet() const;
+
+         //************************************************************************************************************
+         //
+         // Method: DrawPlaceholder
+         //
+         // Description:
+         //    Draws a rectangle the size of the part of the sprite being drawn in place of an image that is not
+         //    loaded yet.
+         //
+         // Arguments:
+         //    aPosition - The position the part is drawn at.
+         //    aWidth    - The width of the part being drawn.
+         //    aHeight   - The height of the part being drawn.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void DrawPlaceholder(const Math::Vector2D<float> aPosition, const int aWidth, const int aHeight) const;
+
          //************************************************************************************************************
          //
          // Method: Terminate
@@ -215,6 +376,12 @@ namespace Bebop { namespace Graphics
          // Holds the bitmap of the sprite(sheet) containing the image(s) of sprite.
          ALLEGRO_BITMAP* mpSpriteSheet;
 
+         // Whether the sprite loaded its own sprite sheet, rather than drawing from a page of a texture atlas.
+         bool mOwnsSpriteSheet;
+
+         // The sprite sheet being loaded in the background, shared with other sprites using the same file.
+         std::shared_ptr<BitmapAsset> mpSpriteSheetAsset;
+
       //***************************************************************************************************************
       // Member Variables - End
       //***************************************************************************************************************
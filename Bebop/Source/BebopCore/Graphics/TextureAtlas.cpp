@@ -0,0 +1,469 @@
+//*********************************************************************************************************************
+//
+// File: TextureAtlas.cpp
+//
+// Description:
+//    This class packs many source images into a few large page bitmaps so sprites drawn from different files share
+//    a texture. Images are queued by file path and packed together when the atlas is built, tallest first, using a
+//    skyline packer per page. The packed pages and a manifest of where each image landed can be saved to disk and
+//    loaded again later without packing.
+//
+//*********************************************************************************************************************
+
+#include "TextureAtlas.h"
+#include "GraphicsConstants.h"
+#include "RenderState.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+namespace Bebop { namespace Graphics
+{
+//*********************************************************************************************************************
+// Public Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: TextureAtlas
+   //
+   // Description:
+   //    Constructor for an empty atlas whose pages are the passed in size.
+   //
+   // Arguments:
+   //    aPageWidth  - The width of each page bitmap.
+   //    aPageHeight - The height of each page bitmap.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   TextureAtlas::TextureAtlas(const int aPageWidth, const int aPageHeight) :
+      mPageWidth(aPageWidth), mPageHeight(aPageHeight), mpAlphaMaskCache(nullptr)
+   {
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: ~TextureAtlas
+   //
+   // Description:
+   //    Destructor for the atlas that destroys the page bitmaps. Sprites drawn from the atlas must not outlive it.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   TextureAtlas::~TextureAtlas()
+   {
+      Clear();
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AddImage
+   //
+   // Description:
+   //    Queues an image file to be packed the next time the atlas is built.
+   //
+   // Arguments:
+   //    aFilePath - The file location of the image.
+   //
+   // Return:
+   //    True  - The image was queued.
+   //    False - The image is already in the atlas or queued.
+   //
+   //******************************************************************************************************************
+   bool TextureAtlas::AddImage(const std::string aFilePath)
+   {
+      if (mRegions.find(aFilePath) != mRegions.end() ||
+          std::find(mQueuedImages.begin(), mQueuedImages.end(), aFilePath) != mQueuedImages.end())
+      {
+         return false;
+      }
+
+      mQueuedImages.push_back(aFilePath);
+      return true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: Build
+   //
+   // Description:
+   //    Loads the queued images, packs them into the pages, and copies them onto the page bitmaps. New pages are
+   //    created when the images do not fit on the existing ones. Packing the tallest images first keeps the skyline
+   //    flat and leaves less wasted space.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    True  - Every queued image was packed.
+   //    False - An image failed to load or is larger than a page. The other images are still packed.
+   //
+   //******************************************************************************************************************
+   bool TextureAtlas::Build()
+   {
+      bool result = true;
+
+      // Load every queued image so they can be ordered by size.
+      std::vector<std::pair<std::string, ALLEGRO_BITMAP*>> images;
+      for (auto iterator = mQueuedImages.begin(); iterator != mQueuedImages.end(); ++iterator)
+      {
+         ALLEGRO_BITMAP* pImage = nullptr;
+         if (mpAlphaMaskCache != nullptr)
+         {
+            pImage = mpAlphaMaskCache->LoadMaskedBitmap(*iterator);
+         }
+         else if (nullptr != (pImage = al_load_bitmap(iterator->c_str())))
+         {
+            al_convert_mask_to_alpha(pImage, al_map_rgb(255, 0, 255));
+         }
+
+         if (pImage == nullptr)
+         {
+            result = false;
+            continue;
+         }
+
+         images.push_back(std::pair<std::string, ALLEGRO_BITMAP*>(*iterator, pImage));
+      }
+      mQueuedImages.clear();
+
+      std::stable_sort(images.begin(), images.end(),
+                       [](const std::pair<std::string, ALLEGRO_BITMAP*>& aFirst,
+                          const std::pair<std::string, ALLEGRO_BITMAP*>& aSecond)
+                       {
+                          return al_get_bitmap_height(aFirst.second) > al_get_bitmap_height(aSecond.second);
+                       });
+
+      // Copy the images without blending so their alpha is kept as is.
+      ALLEGRO_BITMAP* displayBitmap = RenderState::GetTargetBitmap();
+      RenderState::SetBlendMode(BLEND_COPY);
+
+      for (auto iterator = images.begin(); iterator != images.end(); ++iterator)
+      {
+         AtlasRegion region = {0, 0, 0, al_get_bitmap_width(iterator->second), al_get_bitmap_height(iterator->second)};
+         int paddedWidth = region.width + ATLAS_PADDING;
+         int paddedHeight = region.height + ATLAS_PADDING;
+
+         bool placed = false;
+         for (unsigned int page = 0; page < mPackers.size() && placed == false; ++page)
+         {
+            if (mPackers[page].Insert(paddedWidth, paddedHeight, &region.x, &region.y) == true)
+            {
+               region.page = page;
+               placed = true;
+            }
+         }
+
+         // Start a new page when the image does not fit on any of the existing ones.
+         if (placed == false && paddedWidth <= mPageWidth && paddedHeight <= mPageHeight)
+         {
+            ALLEGRO_BITMAP* pPage = al_create_bitmap(mPageWidth, mPageHeight);
+            if (pPage != nullptr)
+            {
+               RenderState::SetTargetBitmap(pPage);
+               al_clear_to_color(al_map_rgba(NO_COLOR, NO_COLOR, NO_COLOR, NO_ALPHA));
+
+               mPages.push_back(pPage);
+               mPackers.push_back(SkylinePacker(mPageWidth, mPageHeight));
+               region.page = static_cast<unsigned int>(mPages.size()) - 1;
+               placed = mPackers.back().Insert(paddedWidth, paddedHeight, &region.x, &region.y);
+            }
+         }
+
+         if (placed == true)
+         {
+            RenderState::SetTargetBitmap(mPages[region.page]);
+            al_draw_bitmap(iterator->second, region.x, region.y, NO_DRAW_FLAGS);
+            mRegions[iterator->first] = region;
+         }
+         else
+         {
+            result = false;
+         }
+
+         al_destroy_bitmap(iterator->second);
+      }
+
+      // Set back to the default blender and drawing area.
+      RenderState::SetBlendMode(BLEND_PREMULTIPLIED_ALPHA);
+      RenderState::SetTargetBitmap(displayBitmap);
+
+      return result;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: Save
+   //
+   // Description:
+   //    Saves each page bitmap next to the manifest and writes the manifest listing the pages and the region of every
+   //    image. The source path is the last item of each region line so paths with spaces read back correctly.
+   //
+   // Arguments:
+   //    aManifestPath - The file location of the manifest. The pages are saved as this path followed by the page
+   //                    number and a .png extension.
+   //
+   // Return:
+   //    True  - The pages and manifest were saved.
+   //    False - A page or the manifest could not be written.
+   //
+   //******************************************************************************************************************
+   bool TextureAtlas::Save(const std::string aManifestPath) const
+   {
+      std::ofstream manifest(aManifestPath.c_str());
+      if (manifest.is_open() == false)
+      {
+         return false;
+      }
+
+      manifest << "atlas " << mPageWidth << " " << mPageHeight << " " << mPages.size() << "\n";
+
+      for (unsigned int page = 0; page < mPages.size(); ++page)
+      {
+         std::ostringstream pagePath;
+         pagePath << aManifestPath << page << ".png";
+         if (al_save_bitmap(pagePath.str().c_str(), mPages[page]) == false)
+         {
+            return false;
+         }
+
+         manifest << "page " << pagePath.str() << "\n";
+      }
+
+      for (auto iterator = mRegions.begin(); iterator != mRegions.end(); ++iterator)
+      {
+         const AtlasRegion& region = iterator->second;
+         manifest << "region " << region.page << " " << region.x << " " << region.y << " " << region.width << " "
+                  << region.height << " " << iterator->first << "\n";
+      }
+
+      return manifest.good();
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: Load
+   //
+   // Description:
+   //    Replaces the contents of the atlas with pages and regions saved by a previous call to save. The loaded pages
+   //    are treated as full, so images added afterwards are packed onto new pages.
+   //
+   // Arguments:
+   //    aManifestPath - The file location of the manifest.
+   //
+   // Return:
+   //    True  - The atlas was loaded.
+   //    False - The manifest or a page could not be read. The atlas is left empty.
+   //
+   //******************************************************************************************************************
+   bool TextureAtlas::Load(const std::string aManifestPath)
+   {
+      Clear();
+
+      std::ifstream manifest(aManifestPath.c_str());
+      if (manifest.is_open() == false)
+      {
+         return false;
+      }
+
+      std::string tag;
+      unsigned int pageCount = 0;
+      manifest >> tag >> mPageWidth >> mPageHeight >> pageCount;
+      if (manifest.fail() == true || tag != "atlas")
+      {
+         return false;
+      }
+
+      for (unsigned int page = 0; page < pageCount; ++page)
+      {
+         std::string pagePath;
+         manifest >> tag;
+         manifest.ignore(1);
+         std::getline(manifest, pagePath);
+
+         // The pages were saved already premultiplied, so they are loaded as they are.
+         ALLEGRO_BITMAP* pPage = nullptr;
+         if (tag == "page")
+         {
+            pPage = al_load_bitmap_flags(pagePath.c_str(), ALLEGRO_NO_PREMULTIPLIED_ALPHA);
+         }
+         if (pPage == nullptr)
+         {
+            Clear();
+            return false;
+         }
+
+         mPages.push_back(pPage);
+         mPackers.push_back(SkylinePacker(mPageWidth, mPageHeight));
+
+         int x = 0;
+         int y = 0;
+         mPackers.back().Insert(mPageWidth, mPageHeight, &x, &y);
+      }
+
+      AtlasRegion region;
+      while (manifest >> tag >> region.page >> region.x >> region.y >> region.width >> region.height)
+      {
+         std::string sourcePath;
+         manifest.ignore(1);
+         std::getline(manifest, sourcePath);
+
+         if (tag != "region" || region.page >= mPages.size())
+         {
+            Clear();
+            return false;
+         }
+
+         mRegions[sourcePath] = region;
+      }
+
+      return true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetRegion
+   //
+   // Description:
+   //    Finds where an image was placed in the atlas.
+   //
+   // Arguments:
+   //    aFilePath - The file location the image was added with.
+   //    apRegion  - Updated with the region of the image.
+   //
+   // Return:
+   //    True  - The image is in the atlas.
+   //    False - The image was not packed into the atlas.
+   //
+   //******************************************************************************************************************
+   bool TextureAtlas::GetRegion(const std::string& aFilePath, AtlasRegion* apRegion) const
+   {
+      auto iterator = mRegions.find(aFilePath);
+      if (iterator == mRegions.end())
+      {
+         return false;
+      }
+
+      *apRegion = iterator->second;
+      return true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetPage
+   //
+   // Description:
+   //    Returns a page bitmap of the atlas.
+   //
+   // Arguments:
+   //    aPage - The index of the page.
+   //
+   // Return:
+   //    Returns the page bitmap, or nullptr if there is no such page.
+   //
+   //******************************************************************************************************************
+   ALLEGRO_BITMAP* TextureAtlas::GetPage(const unsigned int aPage) const
+   {
+      if (aPage >= mPages.size())
+      {
+         return nullptr;
+      }
+
+      return mPages[aPage];
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetPageCount
+   //
+   // Description:
+   //    Returns the number of pages in the atlas.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the number of pages.
+   //
+   //******************************************************************************************************************
+   unsigned int TextureAtlas::GetPageCount() const
+   {
+      return static_cast<unsigned int>(mPages.size());
+   }
+
+   //*******************************************************************************************************************
+   //
+   // Method: SetAlphaMaskCache
+   //
+   // Description:
+   //    Sets the cache used to load images, so images that were loaded before skip decoding and the mask conversion.
+   //    Without a cache every image is decoded and converted.
+   //
+   // Arguments:
+   //    apCache - The cache to load images through, or nullptr to stop using one. It must outlive the atlas.
+   //
+   // Return:
+   //    N/A
+   //
+   //*******************************************************************************************************************
+   void TextureAtlas::SetAlphaMaskCache(const AlphaMaskCache* apCache)
+   {
+      mpAlphaMaskCache = apCache;
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: Clear
+   //
+   // Description:
+   //    Destroys the page bitmaps and forgets every region and queued image.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void TextureAtlas::Clear()
+   {
+      for (auto iterator = mPages.begin(); iterator != mPages.end(); ++iterator)
+      {
+         al_destroy_bitmap(*iterator);
+      }
+
+      mPages.clear();
+      mPackers.clear();
+      mRegions.clear();
+      mQueuedImages.clear();
+   }
+
+//*********************************************************************************************************************
+// Private Methods - End
+//*********************************************************************************************************************
+}}
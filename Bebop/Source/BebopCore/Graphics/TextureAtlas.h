@@ -0,0 +1,283 @@
+//*********************************************************************************************************************
+//
+// File: TextureAtlas.h
+//
+// Description:
+//    This class packs many source images into a few large page bitmaps so sprites drawn from different files share
+//    a texture. Images are queued by file path and packed together when the atlas is built, tallest first, using a
+//    skyline packer per page. The packed pages and a manifest of where each image landed can be saved to disk and
+//    loaded again later without packing.
+//
+//*********************************************************************************************************************
+
+#ifndef TextureAtlas_H
+#define TextureAtlas_H
+
+#include "SkylinePacker.h"
+#include "AlphaMaskCache.h"
+#include <allegro5/allegro.h>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace Bebop { namespace Graphics
+{
+   // Where a source image was placed in the atlas.
+   struct AtlasRegion
+   {
+      unsigned int page;
+      int x;
+      int y;
+      int width;
+      int height;
+   };
+
+   class TextureAtlas
+   {
+      //***************************************************************************************************************
+      // Methods - Start
+      //***************************************************************************************************************
+
+      public:
+
+         //************************************************************************************************************
+         //
+         // Method: TextureAtlas
+         //
+         // Description:
+         //    Constructor for an empty atlas whose pages are the passed in size.
+         //
+         // Arguments:
+         //    aPageWidth  - The width of each page bitmap.
+         //    aPageHeight - The height of each page bitmap.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         TextureAtlas(const int aPageWidth, const int aPageHeight);
+
+         //************************************************************************************************************
+         //
+         // Method: ~TextureAtlas
+         //
+         // Description:
+         //    Destructor for the atlas that destroys the page bitmaps. Sprites drawn from the atlas must not outlive
+         //    it.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         ~TextureAtlas();
+
+         //************************************************************************************************************
+         //
+         // Method: AddImage
+         //
+         // Description:
+         //    Queues an image file to be packed the next time the atlas is built.
+         //
+         // Arguments:
+         //    aFilePath - The file location of the image.
+         //
+         // Return:
+         //    True  - The image was queued.
+         //    False - The image is already in the atlas or queued.
+         //
+         //************************************************************************************************************
+         bool AddImage(const std::string aFilePath);
+
+         //************************************************************************************************************
+         //
+         // Method: Build
+         //
+         // Description:
+         //    Loads the queued images, packs them into the pages, and copies them onto the page bitmaps. New pages are
+         //    created when the images do not fit on the existing ones. The magenta mask color of each image is turned
+         //    into alpha the same way a sprite does when it loads its own sheet.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    True  - Every queued image was packed.
+         //    False - An image failed to load or is larger than a page. The other images are still packed.
+         //
+         //************************************************************************************************************
+         bool Build();
+
+         //************************************************************************************************************
+         //
+         // Method: Save
+         //
+         // Description:
+         //    Saves each page bitmap next to the manifest and writes the manifest listing the pages and the region of
+         //    every image.
+         //
+         // Arguments:
+         //    aManifestPath - The file location of the manifest. The pages are saved as this path followed by the
+         //                    page number and a .png extension.
+         //
+         // Return:
+         //    True  - The pages and manifest were saved.
+         //    False - A page or the manifest could not be written.
+         //
+         //************************************************************************************************************
+         bool Save(const std::string aManifestPath) const;
+
+         //************************************************************************************************************
+         //
+         // Method: Load
+         //
+         // Description:
+         //    Replaces the contents of the atlas with pages and regions saved by a previous call to save.
+         //
+         // Arguments:
+         //    aManifestPath - The file location of the manifest.
+         //
+         // Return:
+         //    True  - The atlas was loaded.
+         //    False - The manifest or a page could not be read. The atlas is left empty.
+         //
+         //************************************************************************************************************
+         bool Load(const std::string aManifestPath);
+
+         //************************************************************************************************************
+         //
+         // Method: GetRegion
+         //
+         // Description:
+         //    Finds where an image was placed in the atlas.
+         //
+         // Arguments:
+         //    aFilePath - The file location the image was added with.
+         //    apRegion  - Updated with the region of the image.
+         //
+         // Return:
+         //    True  - The image is in the atlas.
+         //    False - The image was not packed into the atlas.
+         //
+         //************************************************************************************************************
+         bool GetRegion(const std::string& aFilePath, AtlasRegion* apRegion) const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetPage
+         //
+         // Description:
+         //    Returns a page bitmap of the atlas.
+         //
+         // Arguments:
+         //    aPage - The index of the page.
+         //
+         // Return:
+         //    Returns the page bitmap, or nullptr if there is no such page.
+         //
+         //************************************************************************************************************
+         ALLEGRO_BITMAP* GetPage(const unsigned int aPage) const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetPageCount
+         //
+         // Description:
+         //    Returns the number of pages in the atlas.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the number of pages.
+         //
+         //************************************************************************************************************
+         unsigned int GetPageCount() const;
+
+         //*************************************************************************************************************
+         //
+         // Method: SetAlphaMaskCache
+         //
+         // Description:
+         //    Sets the cache used to load images, so images that were loaded before skip decoding and the mask
+         //    conversion. Without a cache every image is decoded and converted.
+         //
+         // Arguments:
+         //    apCache - The cache to load images through, or nullptr to stop using one. It must outlive the atlas.
+         //
+         // Return:
+         //    N/A
+         //
+         //*************************************************************************************************************
+         void SetAlphaMaskCache(const AlphaMaskCache* apCache);
+
+      protected:
+
+         // There are currently no protected methods for this class.
+
+      private:
+
+         //************************************************************************************************************
+         //
+         // Method: Clear
+         //
+         // Description:
+         //    Destroys the page bitmaps and forgets every region and queued image.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void Clear();
+
+      //***************************************************************************************************************
+      // Methods - End
+      //***************************************************************************************************************
+
+      //***************************************************************************************************************
+      // Member Variables - Start
+      //***************************************************************************************************************
+
+      public:
+
+         // There are currently no public member variables for this class.
+
+      protected:
+
+         // There are currently no protected member variables for this class.
+
+      private:
+
+         // The width of each page bitmap.
+         int mPageWidth;
+
+         // The height of each page bitmap.
+         int mPageHeight;
+
+         // The page bitmaps holding the packed images.
+         std::vector<ALLEGRO_BITMAP*> mPages;
+
+         // The packer of each page, kept so later builds can fill the space left on existing pages.
+         std::vector<SkylinePacker> mPackers;
+
+         // The region of each packed image keyed by the file path it was added with.
+         std::unordered_map<std::string, AtlasRegion> mRegions;
+
+         // The images waiting for the next build.
+         std::vector<std::string> mQueuedImages;
+
+         // The cache images are loaded through when building.
+         const AlphaMaskCache* mpAlphaMaskCache;
+
+      //***************************************************************************************************************
+      // Member Variables - End
+      //***************************************************************************************************************
+   };
+}}
+
+#endif // TextureAtlas_H
@@ -8,6 +8,7 @@
 //*********************************************************************************************************************
 
 #include "Window.h"
+#include "RenderState.h"
 
 namespace Bebop { namespace Graphics
 {
@@ -98,6 +99,9 @@ namespace Bebop { namespace Graphics
       {
          return false;
       }
+
+      // Creating the display makes its backbuffer the target and resets the blender.
+      RenderState::Invalidate();
    
       return true;
    }
@@ -121,6 +125,7 @@ namespace Bebop { namespace Graphics
    {
       al_destroy_display(mpWindow);
       mpWindow = nullptr;
+      RenderState::Invalidate();
    }
 
 //*********************************************************************************************************************
@@ -11,12 +11,483 @@
 #include "CollisionChecker.h"
 #include "../MathConstants.h"
 #include "../Vector2D.h"
+#include "../SimdSupport.h"
 // TODO: Delete this iostream when no longer needed
 #include <iostream>
 #include <algorithm>
+#include <limits>
 
 namespace Bebop { namespace Math
 {
+   namespace
+   {
+      //***************************************************************************************************************
+      //
+      // Method Name: Orientation
+      //
+      // Description:
+      //    Find the orientation between ordered triplet points.
+      //
+      // Arguments:
+      //    aPointOneX   - The origin X-Coordinate of the first point.
+      //    aPointOneY   - The origin Y-Coordinate of the first point.
+      //    aPointTwoX   - The origin X-Coordinate of the two point.
+      //    aPointTwoY   - The origin Y-Coordinate of the two point.
+      //    aPointThreeX - The origin X-Coordinate of the three point.
+      //    aPointThreeY - The origin Y-Coordinate of the three point.
+      //
+      // Return:
+      //    0 = Points are collinear.
+      //    1 = Points are in Clockwise orientation.
+      //    2 = Points are in Counterclockwise orientation.
+      //
+      //***************************************************************************************************************
+      int Orientation(Vector2D<float> aPointOne,
+                      Vector2D<float> aPointTwo,
+                      Vector2D<float> aPointThree)
+      {
+         int val = static_cast<int>((aPointTwo.GetComponentY() - aPointOne.GetComponentY()) * (aPointThree.GetComponentX() - aPointTwo.GetComponentX()) -
+                                    (aPointTwo.GetComponentX() - aPointOne.GetComponentX()) * (aPointThree.GetComponentY() - aPointTwo.GetComponentY()));
+
+         // Check if the points are collinear.
+         if (val == 0)
+         {
+            return 0;
+         }
+
+         // If the value is larger than 0 the points are in clockwise orientation.
+         // Else the value is less than 0 and the points are counterclockwise orientation.
+         return (val > 0) ? 1: 2;
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: OnSegment
+      //
+      // Description:
+      //    Given three collinear points (One, two, and Three), this function checks if point Two lies on line segment
+      //    One->Three.
+      //
+      // Arguments:
+      //    aPointOneX   - The origin X-Coordinate of the first point.
+      //    aPointOneY   - The origin Y-Coordinate of the first point.
+      //    aPointTwoX   - The origin X-Coordinate of the two point.
+      //    aPointTwoY   - The origin Y-Coordinate of the two point.
+      //    aPointThreeX - The origin X-Coordinate of the three point.
+      //    aPointThreeY - The origin Y-Coordinate of the three point.
+      //
+      // Return:
+      //    True  - Point Two lies on line segment One->Three.
+      //    False - Point Two does not lie on line segment One->Three.
+      //
+      //***************************************************************************************************************
+      bool OnSegment(Vector2D<float> aPointOne,
+                     Vector2D<float> aPointTwo,
+                     Vector2D<float> aPointThree)
+      {
+         // Check if point Two lies on line segment One-Three.
+         if (aPointTwo.GetComponentX() <= std::max(aPointOne.GetComponentX(), aPointThree.GetComponentX()) &&
+             aPointTwo.GetComponentX() >= std::min(aPointOne.GetComponentX(), aPointThree.GetComponentX()) && 
+             aPointTwo.GetComponentY() <= std::max(aPointOne.GetComponentY(), aPointThree.GetComponentY()) &&
+             aPointTwo.GetComponentY() >= std::min(aPointOne.GetComponentY(), aPointThree.GetComponentY()))
+         {
+            return true; 
+         }
+  
+         // Point Two does not lie on line segment One->Three.
+         return false; 
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: SlabCollisionTimes
+      //
+      // Description:
+      //    Finds the times a line is between a pair of parallel box edges along one axis. A line running along the
+      //    edges is between them for all time if its origin is, and never otherwise, which keeps lines lying on an
+      //    edge of the box colliding with it.
+      //
+      // Arguments:
+      //    aOrigin     - The coordinate of the origin of the line along the axis.
+      //    aInverse    - The reciprocal of the line direction along the axis. Unused when the line is parallel.
+      //    aIsParallel - Whether the line runs along the edges.
+      //    aMin        - The lower edge along the axis.
+      //    aMax        - The upper edge along the axis.
+      //    apNearTime  - The time the line crosses the nearer edge.
+      //    apFarTime   - The time the line crosses the farther edge.
+      //
+      // Return:
+      //    N/A
+      //
+      //***************************************************************************************************************
+      void SlabCollisionTimes(const float aOrigin, const float aInverse, const bool aIsParallel,
+                              const float aMin, const float aMax, float* apNearTime, float* apFarTime)
+      {
+         if (aIsParallel == true)
+         {
+            bool isInside = aOrigin >= aMin && aOrigin <= aMax;
+            *apFarTime = (isInside == true) ? std::numeric_limits<float>::max() : -std::numeric_limits<float>::max();
+            *apNearTime = -*apFarTime;
+            return;
+         }
+
+         float minTime = (aMin - aOrigin) * aInverse;
+         float maxTime = (aMax - aOrigin) * aInverse;
+         *apNearTime = std::min(minTime, maxTime);
+         *apFarTime = std::max(minTime, maxTime);
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: LineBoxCollisionTime
+      //
+      // Description:
+      //    Finds the time a line segment enters an axis aligned box using the slab method. The line is clipped
+      //    against the pair of vertical edges and the pair of horizontal edges, and collides if the two clipped time
+      //    ranges overlap within the segment. A line that starts inside the box collides at time 0.0.
+      //
+      // Arguments:
+      //    aOriginX - The X-Coordinate of the origin of the line.
+      //    aOriginY - The Y-Coordinate of the origin of the line.
+      //    aDeltaX  - The X-Component of the line from the origin to the end point.
+      //    aDeltaY  - The Y-Component of the line from the origin to the end point.
+      //    aMinX    - The left edge of the box.
+      //    aMinY    - The top edge of the box.
+      //    aMaxX    - The right edge of the box.
+      //    aMaxY    - The bottom edge of the box.
+      //
+      // Return:
+      //    Returns the collision time between 0.0 and 1.0, or NO_COLLISION_TIME if the line misses the box.
+      //
+      //***************************************************************************************************************
+      float LineBoxCollisionTime(const float aOriginX, const float aOriginY,
+                                 const float aDeltaX, const float aDeltaY,
+                                 const float aMinX, const float aMinY,
+                                 const float aMaxX, const float aMaxY)
+      {
+         const bool isParallelX = fabsf(aDeltaX) < MINIMUM_LINE_DIRECTION;
+         const bool isParallelY = fabsf(aDeltaY) < MINIMUM_LINE_DIRECTION;
+         const float inverseX = (isParallelX == true) ? 0.0F : 1.0F / aDeltaX;
+         const float inverseY = (isParallelY == true) ? 0.0F : 1.0F / aDeltaY;
+
+         // Times the line is between each pair of edges of the box.
+         float nearTimeX = 0.0F;
+         float farTimeX = 0.0F;
+         float nearTimeY = 0.0F;
+         float farTimeY = 0.0F;
+         SlabCollisionTimes(aOriginX, inverseX, isParallelX, aMinX, aMaxX, &nearTimeX, &farTimeX);
+         SlabCollisionTimes(aOriginY, inverseY, isParallelY, aMinY, aMaxY, &nearTimeY, &farTimeY);
+
+         // The line is inside the box after it has crossed both near edges and before it crosses either far edge.
+         float entryTime = std::max(std::max(nearTimeX, nearTimeY), 0.0F);
+         float exitTime = std::min(std::min(farTimeX, farTimeY), 1.0F);
+
+         return (entryTime <= exitTime + LINE_BOX_TIME_TOLERANCE) ? entryTime : NO_COLLISION_TIME;
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: AddEdgeCrossing
+      //
+      // Description:
+      //    Adds the point where a vertical edge crosses a horizontal edge to the contacts if the point lies on both
+      //    edges and has not already been added.
+      //
+      // Arguments:
+      //    aVerticalX      - The X-Coordinate of the vertical edge.
+      //    aVerticalMinY   - The top of the vertical edge.
+      //    aVerticalMaxY   - The bottom of the vertical edge.
+      //    aHorizontalY    - The Y-Coordinate of the horizontal edge.
+      //    aHorizontalMinX - The left of the horizontal edge.
+      //    aHorizontalMaxX - The right of the horizontal edge.
+      //    apContacts      - The contacts the point is added to.
+      //
+      // Return:
+      //    N/A
+      //
+      //***************************************************************************************************************
+      void AddEdgeCrossing(const float aVerticalX, const float aVerticalMinY, const float aVerticalMaxY,
+                           const float aHorizontalY, const float aHorizontalMinX, const float aHorizontalMaxX,
+                           RectangleContacts* apContacts)
+      {
+         // The edges only cross if the vertical edge is within the horizontal edge and the other way around.
+         if (aVerticalX < aHorizontalMinX || aVerticalX > aHorizontalMaxX ||
+             aHorizontalY < aVerticalMinY || aHorizontalY > aVerticalMaxY)
+         {
+            return;
+         }
+
+         // Corners shared by both rectangles are found by more than one pair of edges.
+         for (unsigned int i = 0; i < apContacts->count; ++i)
+         {
+            if (apContacts->pointX[i] == aVerticalX && apContacts->pointY[i] == aHorizontalY)
+            {
+               return;
+            }
+         }
+
+         if (apContacts->count < MAXIMUM_RECTANGLE_CONTACTS)
+         {
+            apContacts->pointX[apContacts->count] = aVerticalX;
+            apContacts->pointY[apContacts->count] = aHorizontalY;
+            ++apContacts->count;
+         }
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: LineCircleCollisionTime
+      //
+      // Description:
+      //    Finds the time a line segment enters a circle by solving for where the distance from the line to the
+      //    circle center equals the radius. A line that starts inside the circle collides at time 0.0.
+      //
+      // Arguments:
+      //    aOriginX - The X-Coordinate of the origin of the line.
+      //    aOriginY - The Y-Coordinate of the origin of the line.
+      //    aDeltaX  - The X-Component of the line from the origin to the end point.
+      //    aDeltaY  - The Y-Component of the line from the origin to the end point.
+      //    aCenterX - The X-Coordinate of the circle center.
+      //    aCenterY - The Y-Coordinate of the circle center.
+      //    aRadius  - The radius of the circle.
+      //
+      // Return:
+      //    Returns the collision time between 0.0 and 1.0, or NO_COLLISION_TIME if the line misses the circle.
+      //
+      //***************************************************************************************************************
+      float LineCircleCollisionTime(const float aOriginX, const float aOriginY,
+                                    const float aDeltaX, const float aDeltaY,
+                                    const float aCenterX, const float aCenterY,
+                                    const float aRadius)
+      {
+         // Vector from the circle center to the origin of the line.
+         const float offsetX = aOriginX - aCenterX;
+         const float offsetY = aOriginY - aCenterY;
+
+         // Solve a*t^2 + 2*b*t + c = 0 for the times the line is exactly the radius away from the center.
+         const float c = (offsetX * offsetX) + (offsetY * offsetY) - (aRadius * aRadius);
+         if (c <= 0.0F)
+         {
+            return 0.0F;
+         }
+
+         const float a = (aDeltaX * aDeltaX) + (aDeltaY * aDeltaY);
+         const float b = (offsetX * aDeltaX) + (offsetY * aDeltaY);
+
+         // The line starts outside the circle, so it must be moving toward the center and reach the circle.
+         const float discriminant = (b * b) - (a * c);
+         if (b >= 0.0F || discriminant < 0.0F)
+         {
+            return NO_COLLISION_TIME;
+         }
+
+         const float collisionTime = (-b - sqrtf(discriminant)) / a;
+         return (collisionTime <= 1.0F) ? collisionTime : NO_COLLISION_TIME;
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: LineEdgeCollisionTime
+      //
+      // Description:
+      //    Finds the time a line segment crosses an edge. Lines running parallel to the edge do not cross it.
+      //
+      // Arguments:
+      //    aOriginPoint - The origin point of the line.
+      //    aDelta       - The line from the origin to the end point.
+      //    aEdgeStart   - The point the edge starts at.
+      //    aEdgeEnd     - The point the edge ends at.
+      //
+      // Return:
+      //    Returns the collision time between 0.0 and 1.0, or NO_COLLISION_TIME if the line misses the edge.
+      //
+      //***************************************************************************************************************
+      float LineEdgeCollisionTime(const Vector2D<float>& aOriginPoint, const Vector2D<float>& aDelta,
+                                  const Vector2D<float>& aEdgeStart, const Vector2D<float>& aEdgeEnd)
+      {
+         // Solve origin + delta * time = edgeStart + edge * edgeTime with two dimensional cross products.
+         const Vector2D<float> edge = aEdgeEnd - aEdgeStart;
+         const Vector2D<float> toEdge = aEdgeStart - aOriginPoint;
+         const float denominator = (aDelta.GetComponentX() * edge.GetComponentY()) -
+                                   (aDelta.GetComponentY() * edge.GetComponentX());
+         if (denominator == 0.0F)
+         {
+            return NO_COLLISION_TIME;
+         }
+
+         const float collisionTime = ((toEdge.GetComponentX() * edge.GetComponentY()) -
+                                      (toEdge.GetComponentY() * edge.GetComponentX())) / denominator;
+         const float edgeTime = ((toEdge.GetComponentX() * aDelta.GetComponentY()) -
+                                 (toEdge.GetComponentY() * aDelta.GetComponentX())) / denominator;
+         if (collisionTime < 0.0F || collisionTime > 1.0F || edgeTime < 0.0F || edgeTime > 1.0F)
+         {
+            return NO_COLLISION_TIME;
+         }
+
+         return collisionTime;
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: PointEdgeDistanceSquared
+      //
+      // Description:
+      //    Finds the squared distance from a point to the closest point on an edge.
+      //
+      // Arguments:
+      //    aPoint     - The point being measured from.
+      //    aEdgeStart - The point the edge starts at.
+      //    aEdgeEnd   - The point the edge ends at.
+      //
+      // Return:
+      //    Returns the squared distance.
+      //
+      //***************************************************************************************************************
+      float PointEdgeDistanceSquared(const Vector2D<float>& aPoint, const Vector2D<float>& aEdgeStart,
+                                     const Vector2D<float>& aEdgeEnd)
+      {
+         const Vector2D<float> edge = aEdgeEnd - aEdgeStart;
+         const float lengthSquared = edge.Dot(edge);
+         float edgeTime = 0.0F;
+         if (lengthSquared > 0.0F)
+         {
+            edgeTime = std::max(0.0F, std::min(1.0F, (aPoint - aEdgeStart).Dot(edge) / lengthSquared));
+         }
+
+         const Vector2D<float> closestPoint(aEdgeStart.GetComponentX() + edge.GetComponentX() * edgeTime,
+                                            aEdgeStart.GetComponentY() + edge.GetComponentY() * edgeTime);
+         return PointDistancesSquared(aPoint, closestPoint);
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: PointInPolygon
+      //
+      // Description:
+      //    Checks if a point is inside a convex polygon, which is when the point is on the same side of every edge.
+      //
+      // Arguments:
+      //    aPoint    - The point being checked.
+      //    apPolygon - The polygon being checked against.
+      //
+      // Return:
+      //    True  - The point is inside or on the edge of the polygon.
+      //    False - The point is outside the polygon.
+      //
+      //***************************************************************************************************************
+      bool PointInPolygon(const Vector2D<float>& aPoint, const Objects::PolygonObject* apPolygon)
+      {
+         const unsigned int pointCount = apPolygon->GetPointCount();
+         if (pointCount < 3)
+         {
+            return false;
+         }
+
+         bool hasPositiveSide = false;
+         bool hasNegativeSide = false;
+         for (unsigned int i = 0; i < pointCount; ++i)
+         {
+            const Vector2D<float> edgeStart = apPolygon->GetPoint(i);
+            const Vector2D<float> edge = apPolygon->GetPoint((i + 1) % pointCount) - edgeStart;
+            const Vector2D<float> toPoint = aPoint - edgeStart;
+            const float side = (edge.GetComponentX() * toPoint.GetComponentY()) -
+                               (edge.GetComponentY() * toPoint.GetComponentX());
+            hasPositiveSide = hasPositiveSide || side > 0.0F;
+            hasNegativeSide = hasNegativeSide || side < 0.0F;
+         }
+
+         return hasPositiveSide == false || hasNegativeSide == false;
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: ProjectObject
+      //
+      // Description:
+      //    Finds the range a rectangle or polygon covers when its corners are projected onto an axis.
+      //
+      // Arguments:
+      //    apObject  - The rectangle or polygon being projected.
+      //    aAxis     - The axis being projected onto.
+      //    apMinimum - Updated with the lowest projected value.
+      //    apMaximum - Updated with the highest projected value.
+      //
+      // Return:
+      //    N/A
+      //
+      //***************************************************************************************************************
+      void ProjectObject(const Objects::Object* apObject, const Vector2D<float>& aAxis, float* apMinimum,
+                         float* apMaximum)
+      {
+         if (apObject->GetObjectType() == Objects::ObjectType::RECTANGLE)
+         {
+            const Objects::RectangleObject* rectangle = static_cast<const Objects::RectangleObject*>(apObject);
+            const float minX = rectangle->GetCoordinateX();
+            const float minY = rectangle->GetCoordinateY();
+            const float maxX = minX + rectangle->GetWidth();
+            const float maxY = minY + rectangle->GetHeight();
+            const float corners[] = {minX * aAxis.GetComponentX() + minY * aAxis.GetComponentY(),
+                                     maxX * aAxis.GetComponentX() + minY * aAxis.GetComponentY(),
+                                     minX * aAxis.GetComponentX() + maxY * aAxis.GetComponentY(),
+                                     maxX * aAxis.GetComponentX() + maxY * aAxis.GetComponentY()};
+            *apMinimum = *std::min_element(corners, corners + 4);
+            *apMaximum = *std::max_element(corners, corners + 4);
+         }
+         else if (apObject->GetObjectType() == Objects::ObjectType::POLYGON)
+         {
+            const Objects::PolygonObject* polygon = static_cast<const Objects::PolygonObject*>(apObject);
+            *apMinimum = std::numeric_limits<float>::max();
+            *apMaximum = -std::numeric_limits<float>::max();
+            for (unsigned int i = 0; i < polygon->GetPointCount(); ++i)
+            {
+               const float projection = polygon->GetPoint(i).Dot(aAxis);
+               *apMinimum = std::min(*apMinimum, projection);
+               *apMaximum = std::max(*apMaximum, projection);
+            }
+         }
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: SeparatedOnPolygonAxes
+      //
+      // Description:
+      //    Checks the edge normals of a polygon for an axis along which the polygon and another rectangle or polygon
+      //    do not overlap.
+      //
+      // Arguments:
+      //    apPolygon - The polygon whose edge normals are checked.
+      //    apOther   - The rectangle or polygon being checked against.
+      //
+      // Return:
+      //    True  - There is an axis separating the shapes, so they do not collide.
+      //    False - The shapes overlap along every edge normal of the polygon.
+      //
+      //***************************************************************************************************************
+      bool SeparatedOnPolygonAxes(const Objects::PolygonObject* apPolygon, const Objects::Object* apOther)
+      {
+         const unsigned int pointCount = apPolygon->GetPointCount();
+         for (unsigned int i = 0; i < pointCount; ++i)
+         {
+            const Vector2D<float> edge = apPolygon->GetPoint((i + 1) % pointCount) - apPolygon->GetPoint(i);
+            const Vector2D<float> normal(-edge.GetComponentY(), edge.GetComponentX());
+
+            float polygonMinimum = 0.0F;
+            float polygonMaximum = 0.0F;
+            float otherMinimum = 0.0F;
+            float otherMaximum = 0.0F;
+            ProjectObject(apPolygon, normal, &polygonMinimum, &polygonMaximum);
+            ProjectObject(apOther, normal, &otherMinimum, &otherMaximum);
+            if (polygonMaximum < otherMinimum || otherMaximum < polygonMinimum)
+            {
+               return true;
+            }
+         }
+
+         return false;
+      }
+   }
+
    //******************************************************************************************************************
    //
    // Method Name: RectangleRectangleCollision
@@ -35,136 +506,86 @@ namespace Bebop { namespace Math
                                     Objects::RectangleObject* mpRectangleTwo,
                                     std::vector<Vector2D<float>>* apCollisionPoints)
    {
-      if (mpRectangleOne->GetCoordinateX() <= mpRectangleTwo->GetCoordinateX() + mpRectangleTwo->GetWidth() &&
-          mpRectangleOne->GetCoordinateX() + mpRectangleOne->GetWidth() >= mpRectangleTwo->GetCoordinateX() &&
-          mpRectangleOne->GetCoordinateY() <= mpRectangleTwo->GetCoordinateY() + mpRectangleTwo->GetHeight() &&
-          mpRectangleOne->GetCoordinateY() + mpRectangleOne->GetHeight() >= mpRectangleTwo->GetCoordinateY())
+      // Only gather the crossing points when the caller wants them.
+      if (apCollisionPoints == nullptr)
       {
-         // Gather collision points.
-         if (apCollisionPoints != nullptr)
-         {
-            Vector2D<float>* collisionPoint = new Vector2D<float>(0.0F, 0.0F);
+         return RectangleRectangleContacts(mpRectangleOne, mpRectangleTwo, nullptr);
+      }
 
-            // Rectangle One Top vs Rectangle Two Top
-            if (LineLineCollision(mpRectangleOne->GetTopLeftCorner(), mpRectangleOne->GetTopRightCorner(),
-                                  mpRectangleTwo->GetTopLeftCorner(), mpRectangleTwo->GetTopRightCorner(),
-                                  collisionPoint) == true)
-            {
-               apCollisionPoints->push_back(*collisionPoint);
-            }
-            // Rectangle One Top vs Rectangle Two Left Side
-            if (LineLineCollision(mpRectangleOne->GetTopLeftCorner(), mpRectangleOne->GetTopRightCorner(),
-                                  mpRectangleTwo->GetTopLeftCorner(), mpRectangleTwo->GetBottomLeftCorner(),
-                                  collisionPoint) == true)
-            {
-               apCollisionPoints->push_back(*collisionPoint);
-            }
-            // Rectangle One Top vs Rectangle Two Right Side
-            if (LineLineCollision(mpRectangleOne->GetTopLeftCorner(), mpRectangleOne->GetTopRightCorner(),
-                                  mpRectangleTwo->GetTopRightCorner(), mpRectangleTwo->GetBottomRightCorner(),
-                                  collisionPoint) == true)
-            {
-               apCollisionPoints->push_back(*collisionPoint);
-            }
-            // Rectangle One Top vs Rectangle Two Bottom
-            if (LineLineCollision(mpRectangleOne->GetTopLeftCorner(), mpRectangleOne->GetTopRightCorner(),
-                                  mpRectangleTwo->GetBottomLeftCorner(), mpRectangleTwo->GetBottomRightCorner(),
-                                  collisionPoint) == true)
-            {
-               apCollisionPoints->push_back(*collisionPoint);
-            }
-            // Rectangle One Left vs Rectangle Two Top
-            if (LineLineCollision(mpRectangleOne->GetTopLeftCorner(), mpRectangleOne->GetBottomLeftCorner(),
-                                  mpRectangleTwo->GetTopLeftCorner(), mpRectangleTwo->GetTopRightCorner(),
-                                  collisionPoint) == true)
-            {
-               apCollisionPoints->push_back(*collisionPoint);
-            }
-            // Rectangle One Left vs Rectangle Two Left Side
-            if (LineLineCollision(mpRectangleOne->GetTopLeftCorner(), mpRectangleOne->GetBottomLeftCorner(),
-                                  mpRectangleTwo->GetTopLeftCorner(), mpRectangleTwo->GetBottomLeftCorner(),
-                                  collisionPoint) == true)
-            {
-               apCollisionPoints->push_back(*collisionPoint);
-            }
-            // Rectangle One Left vs Rectangle Two Right Side
-            if (LineLineCollision(mpRectangleOne->GetTopLeftCorner(), mpRectangleOne->GetBottomLeftCorner(),
-                                  mpRectangleTwo->GetTopRightCorner(), mpRectangleTwo->GetBottomRightCorner(),
-                                  collisionPoint) == true)
-            {
-               apCollisionPoints->push_back(*collisionPoint);
-            }
-            // Rectangle One Left vs Rectangle Two Bottom
-            if (LineLineCollision(mpRectangleOne->GetTopLeftCorner(), mpRectangleOne->GetBottomLeftCorner(),
-                                  mpRectangleTwo->GetBottomLeftCorner(), mpRectangleTwo->GetBottomRightCorner(),
-                                  collisionPoint) == true)
-            {
-               apCollisionPoints->push_back(*collisionPoint);
-            }
-            // Rectangle One Right vs Rectangle Two Top
-            if (LineLineCollision(mpRectangleOne->GetTopRightCorner(), mpRectangleOne->GetBottomRightCorner(),
-                                  mpRectangleTwo->GetTopLeftCorner(), mpRectangleTwo->GetTopRightCorner(),
-                                  collisionPoint) == true)
-            {
-               apCollisionPoints->push_back(*collisionPoint);
-            }
-            // Rectangle One Right vs Rectangle Two Left Side
-            if (LineLineCollision(mpRectangleOne->GetTopRightCorner(), mpRectangleOne->GetBottomRightCorner(),
-                                  mpRectangleTwo->GetTopLeftCorner(), mpRectangleTwo->GetBottomLeftCorner(),
-                                  collisionPoint) == true)
-            {
-               apCollisionPoints->push_back(*collisionPoint);
-            }
-            // Rectangle One Right vs Rectangle Two Right Side
-            if (LineLineCollision(mpRectangleOne->GetTopRightCorner(), mpRectangleOne->GetBottomRightCorner(),
-                                  mpRectangleTwo->GetTopRightCorner(), mpRectangleTwo->GetBottomRightCorner(),
-                                  collisionPoint) == true)
-            {
-               apCollisionPoints->push_back(*collisionPoint);
-            }
-            // Rectangle One Right vs Rectangle Two Bottom
-            if (LineLineCollision(mpRectangleOne->GetTopRightCorner(), mpRectangleOne->GetBottomRightCorner(),
-                                  mpRectangleTwo->GetBottomLeftCorner(), mpRectangleTwo->GetBottomRightCorner(),
-                                  collisionPoint) == true)
-            {
-               apCollisionPoints->push_back(*collisionPoint);
-            }
-            // Rectangle One Bottom vs Rectangle Two Top
-            if (LineLineCollision(mpRectangleOne->GetBottomLeftCorner(), mpRectangleOne->GetBottomRightCorner(),
-                                  mpRectangleTwo->GetTopLeftCorner(), mpRectangleTwo->GetTopRightCorner(),
-                                  collisionPoint) == true)
-            {
-               apCollisionPoints->push_back(*collisionPoint);
-            }
-            // Rectangle One Bottom vs Rectangle Two Left Side
-            if (LineLineCollision(mpRectangleOne->GetBottomLeftCorner(), mpRectangleOne->GetBottomRightCorner(),
-                                  mpRectangleTwo->GetTopLeftCorner(), mpRectangleTwo->GetBottomLeftCorner(),
-                                  collisionPoint) == true)
-            {
-               apCollisionPoints->push_back(*collisionPoint);
-            }
-            // Rectangle One Bottom vs Rectangle Two Right Side
-            if (LineLineCollision(mpRectangleOne->GetBottomLeftCorner(), mpRectangleOne->GetBottomRightCorner(),
-                                  mpRectangleTwo->GetTopRightCorner(), mpRectangleTwo->GetBottomRightCorner(),
-                                  collisionPoint) == true)
-            {
-               apCollisionPoints->push_back(*collisionPoint);
-            }
-            // Rectangle One Bottom vs Rectangle Two Bottom
-            if (LineLineCollision(mpRectangleOne->GetBottomLeftCorner(), mpRectangleOne->GetBottomRightCorner(),
-                                  mpRectangleTwo->GetBottomLeftCorner(), mpRectangleTwo->GetBottomRightCorner(),
-                                  collisionPoint) == true)
-            {
-               apCollisionPoints->push_back(*collisionPoint);
-            }
-         }
+      RectangleContacts contacts;
+      if (RectangleRectangleContacts(mpRectangleOne, mpRectangleTwo, &contacts) == false)
+      {
+         return false;
+      }
 
-         return true;
+      for (unsigned int i = 0; i < contacts.count; ++i)
+      {
+         apCollisionPoints->push_back(Vector2D<float>(contacts.pointX[i], contacts.pointY[i]));
       }
-      else
+
+      return true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: RectangleRectangleContacts
+   //
+   // Description:
+   //    Checks two rectangular objects for collision and finds the points where their edges cross. Since both
+   //    rectangles are axis aligned, each vertical edge of one rectangle can only cross the horizontal edges of the
+   //    other, so the points are found directly from the edge coordinates. Duplicate points, such as from shared
+   //    edges, are only stored once.
+   //
+   // Arguments:
+   //    apRectangleOne - The first rectangular object to be checked for collision.
+   //    apRectangleTwo - The second rectangular object to be checked for collision.
+   //    apContacts     - The contacts updated with the crossing points. May be nullptr if only the collision is
+   //                     needed.
+   //
+   // Return:
+   //    True  - The rectangles collide.
+   //    False - The rectangles do not collide.
+   //
+   //******************************************************************************************************************
+   bool RectangleRectangleContacts(const Objects::RectangleObject* apRectangleOne,
+                                   const Objects::RectangleObject* apRectangleTwo,
+                                   RectangleContacts* apContacts)
+   {
+      const float oneMinX = apRectangleOne->GetCoordinateX();
+      const float oneMinY = apRectangleOne->GetCoordinateY();
+      const float oneMaxX = oneMinX + apRectangleOne->GetWidth();
+      const float oneMaxY = oneMinY + apRectangleOne->GetHeight();
+      const float twoMinX = apRectangleTwo->GetCoordinateX();
+      const float twoMinY = apRectangleTwo->GetCoordinateY();
+      const float twoMaxX = twoMinX + apRectangleTwo->GetWidth();
+      const float twoMaxY = twoMinY + apRectangleTwo->GetHeight();
+
+      if (apContacts != nullptr)
+      {
+         apContacts->count = 0;
+      }
+
+      if (oneMinX > twoMaxX || oneMaxX < twoMinX || oneMinY > twoMaxY || oneMaxY < twoMinY)
       {
          return false;
       }
+
+      if (apContacts != nullptr)
+      {
+         // Rectangle One Left and Right vs Rectangle Two Top and Bottom
+         AddEdgeCrossing(oneMinX, oneMinY, oneMaxY, twoMinY, twoMinX, twoMaxX, apContacts);
+         AddEdgeCrossing(oneMinX, oneMinY, oneMaxY, twoMaxY, twoMinX, twoMaxX, apContacts);
+         AddEdgeCrossing(oneMaxX, oneMinY, oneMaxY, twoMinY, twoMinX, twoMaxX, apContacts);
+         AddEdgeCrossing(oneMaxX, oneMinY, oneMaxY, twoMaxY, twoMinX, twoMaxX, apContacts);
+
+         // Rectangle Two Left and Right vs Rectangle One Top and Bottom
+         AddEdgeCrossing(twoMinX, twoMinY, twoMaxY, oneMinY, oneMinX, oneMaxX, apContacts);
+         AddEdgeCrossing(twoMinX, twoMinY, twoMaxY, oneMaxY, oneMinX, oneMaxX, apContacts);
+         AddEdgeCrossing(twoMaxX, twoMinY, twoMaxY, oneMinY, oneMinX, oneMaxX, apContacts);
+         AddEdgeCrossing(twoMaxX, twoMinY, twoMaxY, oneMaxY, oneMinX, oneMaxX, apContacts);
+      }
+
+      return true;
    }
 
    //******************************************************************************************************************
@@ -210,14 +631,13 @@ namespace Bebop { namespace Math
          tempCircleY = mpRectangle->GetCoordinateY() + mpRectangle->GetHeight();
       }
 
-      // Get the distance from the edge found edge and the circle's center using Pythagorean Theorem
-      float distanceX = mpCircle->GetCoordinateX() - tempCircleX;
-      float distanceY = mpCircle->GetCoordinateY() - tempCircleY;
-      float distance = sqrt((distanceX*distanceX) + (distanceY*distanceY));
+      // Get the squared distance from the found edge and the circle's center using Pythagorean Theorem.
+      float distanceSquared = PointDistancesSquared(mpCircle->GetCoordinates(),
+                                                    Vector2D<float>(tempCircleX, tempCircleY));
 
-      // Compare the distance found to the radius. If the distance is less than or equal to the radius then there is a
-      // collision.
-      if (distance <= mpCircle->GetRadius())
+      // Compare the squared distance found to the squared radius. If the distance is less than or equal to the radius
+      // then there is a collision.
+      if (distanceSquared <= static_cast<float>(mpCircle->GetRadius() * mpCircle->GetRadius()))
       {
          return true;
       }
@@ -244,17 +664,19 @@ namespace Bebop { namespace Math
                               Objects::CircleObject* mpCircleTwo,
                               std::vector<Vector2D<float>>* apCollisionPoints)
    {
-      // Get the distance from the center of the first circle to the second circle.
-      float distanceX = mpCircleOne->GetCoordinateX() - mpCircleTwo->GetCoordinateX();
-      float distanceY = mpCircleOne->GetCoordinateY() - mpCircleTwo->GetCoordinateY();
-      float distance = sqrt((distanceX*distanceX) + (distanceY*distanceY));
+      // Get the squared distance from the center of the first circle to the second circle.
+      float distanceSquared = PointDistancesSquared(mpCircleOne->GetCoordinates(), mpCircleTwo->GetCoordinates());
+      float radiusSum = static_cast<float>(mpCircleOne->GetRadius() + mpCircleTwo->GetRadius());
 
       // Check if the distance found is less than the sum of the two circle's radius and if there is then collision
       // has happened.
-      if (distance < mpCircleOne->GetRadius() + mpCircleTwo->GetRadius())
+      if (distanceSquared < radiusSum * radiusSum)
       {
          if (apCollisionPoints != nullptr)
          {
+            // The actual distance is only needed to find the intersection points.
+            float distance = sqrtf(distanceSquared);
+
             // Avoid circles that overlap.
             if (distance != 0.0F)
             {
@@ -286,12 +708,110 @@ namespace Bebop { namespace Math
       return false;
    }
 
+   //******************************************************************************************************************
+   //
+   // Method Name: SweptRectangleRectangleCollision
+   //
+   // Description:
+   //    Finds when a moving rectangle first touches a still rectangle during a movement. The still rectangle is grown
+   //    by the size of the moving rectangle so the check becomes the top left corner of the moving rectangle
+   //    travelling as a line through the grown rectangle. This catches collisions that would be missed by only
+   //    checking the start and end positions of a fast moving rectangle.
+   //
+   // Arguments:
+   //    apMovingRectangle - The rectangle being moved, at its position before the movement.
+   //    aMovement         - The distance the moving rectangle travels along each axis.
+   //    apStillRectangle  - The rectangle that is not moving.
+   //
+   // Return:
+   //    Returns the time of impact between 0.0 (start of the movement) and 1.0 (end of the movement), or
+   //    NO_COLLISION_TIME if the rectangles do not touch during the movement. Rectangles already touching return
+   //    0.0.
+   //
+   //******************************************************************************************************************
+   float SweptRectangleRectangleCollision(const Objects::RectangleObject* apMovingRectangle,
+                                          const Vector2D<float>& aMovement,
+                                          const Objects::RectangleObject* apStillRectangle)
+   {
+      // Grow the still rectangle by the size of the moving rectangle so only the top left corner needs to be moved.
+      return LineBoxCollisionTime(apMovingRectangle->GetCoordinateX(), apMovingRectangle->GetCoordinateY(),
+                                  aMovement.GetComponentX(), aMovement.GetComponentY(),
+                                  apStillRectangle->GetCoordinateX() - apMovingRectangle->GetWidth(),
+                                  apStillRectangle->GetCoordinateY() - apMovingRectangle->GetHeight(),
+                                  apStillRectangle->GetCoordinateX() + apStillRectangle->GetWidth(),
+                                  apStillRectangle->GetCoordinateY() + apStillRectangle->GetHeight());
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: SweptCircleRectangleCollision
+   //
+   // Description:
+   //    Finds when a moving circle first touches a still rectangle during a movement. The rectangle is grown by the
+   //    radius of the circle so the check becomes the circle center travelling as a line through the grown
+   //    rectangle. When the line enters near a corner, the grown rectangle is rounded there, so the line is checked
+   //    against a circle of the same radius around that corner instead.
+   //
+   // Arguments:
+   //    apMovingCircle   - The circle being moved, at its position before the movement.
+   //    aMovement        - The distance the moving circle travels along each axis.
+   //    apStillRectangle - The rectangle that is not moving.
+   //
+   // Return:
+   //    Returns the time of impact between 0.0 (start of the movement) and 1.0 (end of the movement), or
+   //    NO_COLLISION_TIME if the circle and rectangle do not touch during the movement. Shapes already touching
+   //    return 0.0.
+   //
+   //******************************************************************************************************************
+   float SweptCircleRectangleCollision(const Objects::CircleObject* apMovingCircle,
+                                       const Vector2D<float>& aMovement,
+                                       const Objects::RectangleObject* apStillRectangle)
+   {
+      const float radius = static_cast<float>(apMovingCircle->GetRadius());
+      const float centerX = apMovingCircle->GetCoordinateX();
+      const float centerY = apMovingCircle->GetCoordinateY();
+      const float movementX = aMovement.GetComponentX();
+      const float movementY = aMovement.GetComponentY();
+      const float minX = apStillRectangle->GetCoordinateX();
+      const float minY = apStillRectangle->GetCoordinateY();
+      const float maxX = minX + apStillRectangle->GetWidth();
+      const float maxY = minY + apStillRectangle->GetHeight();
+
+      // Grow the rectangle by the radius so only the circle center needs to be moved.
+      float collisionTime = LineBoxCollisionTime(centerX, centerY, movementX, movementY,
+                                                 minX - radius, minY - radius, maxX + radius, maxY + radius);
+      if (collisionTime == NO_COLLISION_TIME)
+      {
+         return NO_COLLISION_TIME;
+      }
+
+      // The grown rectangle is only square along the edges. If the center enters it past a corner of the rectangle
+      // on both axes, the actual shape there is a circle around that corner.
+      float hitX = centerX + movementX * collisionTime;
+      float hitY = centerY + movementY * collisionTime;
+      bool pastLeft = hitX < minX;
+      bool pastRight = hitX > maxX;
+      bool pastTop = hitY < minY;
+      bool pastBottom = hitY > maxY;
+
+      if ((pastLeft == true || pastRight == true) && (pastTop == true || pastBottom == true))
+      {
+         return LineCircleCollisionTime(centerX, centerY, movementX, movementY,
+                                        (pastLeft == true) ? minX : maxX,
+                                        (pastTop == true) ? minY : maxY,
+                                        radius);
+      }
+
+      return collisionTime;
+   }
+
    //******************************************************************************************************************
    //
    // Method Name: LineRectangleCollision
    //
    // Description:
-   //    Checks line segment and rectangle collision.
+   //    Checks line segment and rectangle collision. If there is a collision, the collision point is updated with the
+   //    point where the line first enters the rectangle, or the origin if the line starts inside the rectangle.
    //
    // Arguments:
    //    aOriginPointX - The origin X-Coordinate of the line being tested.
@@ -312,94 +832,249 @@ namespace Bebop { namespace Math
                                Objects::RectangleObject* mpRectangle,
                                Vector2D<float>* aCollisionPoint)
    {
-      Vector2D<float>* left = new Vector2D<float>(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
-      Vector2D<float>* top = new Vector2D<float>(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
-      Vector2D<float>* right = new Vector2D<float>(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
-      Vector2D<float>* bottom = new Vector2D<float>(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
-      bool leftCollided = false;
-      bool topCollided = false;
-      bool rightCollided = false;
-      bool bottomCollided = false;
-
-      if (aOriginPoint.GetComponentX() >= mpRectangle->GetCoordinateX() &&
-          aOriginPoint.GetComponentX() <= mpRectangle->GetCoordinateX() + mpRectangle->GetWidth() &&
-          aOriginPoint.GetComponentY() >= mpRectangle->GetCoordinateY() &&
-          aOriginPoint.GetComponentY() <= mpRectangle->GetCoordinateY() + mpRectangle->GetHeight())
-      {
-         if (aCollisionPoint != nullptr)
-            *aCollisionPoint = aOriginPoint;
+      float deltaX = aEndPoint.GetComponentX() - aOriginPoint.GetComponentX();
+      float deltaY = aEndPoint.GetComponentY() - aOriginPoint.GetComponentY();
+
+      // Clip the line against the rectangle's edges to find where it first enters the rectangle.
+      float collisionTime = LineBoxCollisionTime(aOriginPoint.GetComponentX(), aOriginPoint.GetComponentY(),
+                                                 deltaX, deltaY,
+                                                 mpRectangle->GetCoordinateX(),
+                                                 mpRectangle->GetCoordinateY(),
+                                                 mpRectangle->GetCoordinateX() + mpRectangle->GetWidth(),
+                                                 mpRectangle->GetCoordinateY() + mpRectangle->GetHeight());
+
+      if (collisionTime == NO_COLLISION_TIME)
+      {
+         return false;
+      }
+
+      if (aCollisionPoint != nullptr)
+      {
+         aCollisionPoint->SetComponentX(aOriginPoint.GetComponentX() + deltaX * collisionTime);
+         aCollisionPoint->SetComponentY(aOriginPoint.GetComponentY() + deltaY * collisionTime);
+      }
+
+      return true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: LineRectanglesCollision
+   //
+   // Description:
+   //    Checks one line segment against many rectangles at once. The rectangles are passed as separate arrays of
+   //    their edges so groups of rectangles can be checked together in SIMD lanes. For each rectangle the collision
+   //    time is written, where 0.0 is the origin of the line and 1.0 is the end of the line. A collision point can be
+   //    found with aOriginPoint + (aEndPoint - aOriginPoint) * time.
+   //
+   // Arguments:
+   //    aOriginPoint      - The origin point of the line being tested.
+   //    aEndPoint         - The end point of the line being tested.
+   //    apMinX            - The left edge of each rectangle.
+   //    apMinY            - The top edge of each rectangle.
+   //    apMaxX            - The right edge of each rectangle.
+   //    apMaxY            - The bottom edge of each rectangle.
+   //    aCount            - The number of rectangles in the arrays.
+   //    apCollisionTimes  - Array of aCount values for the collision time with each rectangle. Rectangles that do not
+   //                        collide with the line are given NO_COLLISION_TIME.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void LineRectanglesCollision(const Vector2D<float>& aOriginPoint,
+                                const Vector2D<float>& aEndPoint,
+                                const float* apMinX,
+                                const float* apMinY,
+                                const float* apMaxX,
+                                const float* apMaxY,
+                                const unsigned int aCount,
+                                float* apCollisionTimes)
+   {
+      const float originX = aOriginPoint.GetComponentX();
+      const float originY = aOriginPoint.GetComponentY();
+      const float deltaX = aEndPoint.GetComponentX() - originX;
+      const float deltaY = aEndPoint.GetComponentY() - originY;
+
+      // The line is the same for every rectangle so the reciprocal of its direction is only found once.
+      const bool isParallelX = fabsf(deltaX) < MINIMUM_LINE_DIRECTION;
+      const bool isParallelY = fabsf(deltaY) < MINIMUM_LINE_DIRECTION;
+      const float inverseX = (isParallelX == true) ? 0.0F : 1.0F / deltaX;
+      const float inverseY = (isParallelY == true) ? 0.0F : 1.0F / deltaY;
+
+      unsigned int index = 0;
+
+#if defined(BEBOP_SIMD_SSE)
+      const __m128 originXLanes = _mm_set1_ps(originX);
+      const __m128 originYLanes = _mm_set1_ps(originY);
+      const __m128 inverseXLanes = _mm_set1_ps(inverseX);
+      const __m128 inverseYLanes = _mm_set1_ps(inverseY);
+      const __m128 zeroLanes = _mm_setzero_ps();
+      const __m128 oneLanes = _mm_set1_ps(1.0F);
+      const __m128 noCollisionLanes = _mm_set1_ps(NO_COLLISION_TIME);
+      const __m128 toleranceLanes = _mm_set1_ps(LINE_BOX_TIME_TOLERANCE);
+      const __m128 allTimeLanes = _mm_set1_ps(std::numeric_limits<float>::max());
+      const __m128 noTimeLanes = _mm_set1_ps(-std::numeric_limits<float>::max());
+
+      for (; index + SIMD_LANE_WIDTH <= aCount; index += SIMD_LANE_WIDTH)
+      {
+         __m128 minX = _mm_loadu_ps(apMinX + index);
+         __m128 maxX = _mm_loadu_ps(apMaxX + index);
+         __m128 minY = _mm_loadu_ps(apMinY + index);
+         __m128 maxY = _mm_loadu_ps(apMaxY + index);
+         __m128 minTimeX = _mm_mul_ps(_mm_sub_ps(minX, originXLanes), inverseXLanes);
+         __m128 maxTimeX = _mm_mul_ps(_mm_sub_ps(maxX, originXLanes), inverseXLanes);
+         __m128 minTimeY = _mm_mul_ps(_mm_sub_ps(minY, originYLanes), inverseYLanes);
+         __m128 maxTimeY = _mm_mul_ps(_mm_sub_ps(maxY, originYLanes), inverseYLanes);
+         __m128 nearTimeX = _mm_min_ps(minTimeX, maxTimeX);
+         __m128 farTimeX = _mm_max_ps(minTimeX, maxTimeX);
+         __m128 nearTimeY = _mm_min_ps(minTimeY, maxTimeY);
+         __m128 farTimeY = _mm_max_ps(minTimeY, maxTimeY);
+
+         // A line running along a pair of edges is between them for all time if its origin is, and never otherwise.
+         if (isParallelX == true)
+         {
+            __m128 inside = _mm_and_ps(_mm_cmple_ps(minX, originXLanes), _mm_cmple_ps(originXLanes, maxX));
+            nearTimeX = _mm_or_ps(_mm_and_ps(inside, noTimeLanes), _mm_andnot_ps(inside, allTimeLanes));
+            farTimeX = _mm_or_ps(_mm_and_ps(inside, allTimeLanes), _mm_andnot_ps(inside, noTimeLanes));
+         }
+         if (isParallelY == true)
+         {
+            __m128 inside = _mm_and_ps(_mm_cmple_ps(minY, originYLanes), _mm_cmple_ps(originYLanes, maxY));
+            nearTimeY = _mm_or_ps(_mm_and_ps(inside, noTimeLanes), _mm_andnot_ps(inside, allTimeLanes));
+            farTimeY = _mm_or_ps(_mm_and_ps(inside, allTimeLanes), _mm_andnot_ps(inside, noTimeLanes));
+         }
+
+         __m128 entryTime = _mm_max_ps(_mm_max_ps(nearTimeX, nearTimeY), zeroLanes);
+         __m128 exitTime = _mm_min_ps(_mm_min_ps(farTimeX, farTimeY), oneLanes);
+
+         // Keep the entry time for the lanes that collided and replace the rest with the no collision time.
+         __m128 collided = _mm_cmple_ps(entryTime, _mm_add_ps(exitTime, toleranceLanes));
+         _mm_storeu_ps(apCollisionTimes + index, _mm_or_ps(_mm_and_ps(collided, entryTime),
+                                                           _mm_andnot_ps(collided, noCollisionLanes)));
+      }
+#endif
+
+      for (; index < aCount; ++index)
+      {
+         float nearTimeX = 0.0F;
+         float farTimeX = 0.0F;
+         float nearTimeY = 0.0F;
+         float farTimeY = 0.0F;
+         SlabCollisionTimes(originX, inverseX, isParallelX, apMinX[index], apMaxX[index], &nearTimeX, &farTimeX);
+         SlabCollisionTimes(originY, inverseY, isParallelY, apMinY[index], apMaxY[index], &nearTimeY, &farTimeY);
+
+         float entryTime = std::max(std::max(nearTimeX, nearTimeY), 0.0F);
+         float exitTime = std::min(std::min(farTimeX, farTimeY), 1.0F);
+
+         apCollisionTimes[index] = (entryTime <= exitTime + LINE_BOX_TIME_TOLERANCE) ? entryTime : NO_COLLISION_TIME;
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: LinesRectangleCollision
+   //
+   // Description:
+   //    Checks many line segments that share an origin point against one rectangle at once. The end points are passed
+   //    as separate arrays of their components so groups of lines can be checked together in SIMD lanes. For each
+   //    line the collision time is written, where 0.0 is the origin of the line and 1.0 is the end of the line.
+   //
+   // Arguments:
+   //    aOriginPoint     - The origin point shared by all of the lines.
+   //    apEndPointX      - The X-Coordinate of the end point of each line.
+   //    apEndPointY      - The Y-Coordinate of the end point of each line.
+   //    aCount           - The number of lines in the arrays.
+   //    apRectangle      - The rectangle being tested against.
+   //    apCollisionTimes - Array of aCount values for the collision time of each line. Lines that do not collide with
+   //                       the rectangle are given NO_COLLISION_TIME.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void LinesRectangleCollision(const Vector2D<float>& aOriginPoint,
+                                const float* apEndPointX,
+                                const float* apEndPointY,
+                                const unsigned int aCount,
+                                const Objects::RectangleObject* apRectangle,
+                                float* apCollisionTimes)
+   {
+      const float originX = aOriginPoint.GetComponentX();
+      const float originY = aOriginPoint.GetComponentY();
 
-         return true;
-      }
+      // The rectangle is the same for every line so its edges relative to the origin are only found once.
+      const float minX = apRectangle->GetCoordinateX() - originX;
+      const float minY = apRectangle->GetCoordinateY() - originY;
+      const float maxX = minX + apRectangle->GetWidth();
+      const float maxY = minY + apRectangle->GetHeight();
 
-      // Check line collision on left side of the rectangle.
-      if (true == LineLineCollision(aOriginPoint, aEndPoint,
-                                    mpRectangle->GetTopLeftCorner(), mpRectangle->GetBottomLeftCorner(),
-                                    left))
-      {
-         leftCollided = true;
-      }
-      // Check line collision on the top of the rectangle.
-      if (true == LineLineCollision(aOriginPoint, aEndPoint,
-                                    mpRectangle->GetTopLeftCorner(), mpRectangle->GetTopRightCorner(),
-                                    top))
-      {
-         topCollided = true;
-      }
-      // Check line collision on the right side of the rectangle.
-      if (true == LineLineCollision(aOriginPoint, aEndPoint,
-                                    mpRectangle->GetTopRightCorner(), mpRectangle->GetBottomRightCorner(),
-                                    right))
-      {
-         rightCollided = true;
-      }
-      // Check line collision on the bottom side of the rectangle.
-      if (true == LineLineCollision(aOriginPoint, aEndPoint,
-                                    mpRectangle->GetBottomLeftCorner(), mpRectangle->GetBottomRightCorner(),
-                                    bottom))
-      {
-         bottomCollided = true;
-      }
+      unsigned int index = 0;
+
+#if defined(BEBOP_SIMD_SSE)
+      const __m128 originXLanes = _mm_set1_ps(originX);
+      const __m128 originYLanes = _mm_set1_ps(originY);
+      const __m128 minXLanes = _mm_set1_ps(minX);
+      const __m128 minYLanes = _mm_set1_ps(minY);
+      const __m128 maxXLanes = _mm_set1_ps(maxX);
+      const __m128 maxYLanes = _mm_set1_ps(maxY);
+      const __m128 zeroLanes = _mm_setzero_ps();
+      const __m128 oneLanes = _mm_set1_ps(1.0F);
+      const __m128 noCollisionLanes = _mm_set1_ps(NO_COLLISION_TIME);
+      const __m128 toleranceLanes = _mm_set1_ps(LINE_BOX_TIME_TOLERANCE);
+      const __m128 minimumDirectionLanes = _mm_set1_ps(MINIMUM_LINE_DIRECTION);
+      const __m128 signMask = _mm_set1_ps(-0.0F);
+
+      // Lines running along a pair of edges are between them for all time if the origin is, and never otherwise.
+      const bool isInsideX = minX <= 0.0F && maxX >= 0.0F;
+      const bool isInsideY = minY <= 0.0F && maxY >= 0.0F;
+      const float allTime = std::numeric_limits<float>::max();
+      const __m128 parallelNearXLanes = _mm_set1_ps((isInsideX == true) ? -allTime : allTime);
+      const __m128 parallelFarXLanes = _mm_set1_ps((isInsideX == true) ? allTime : -allTime);
+      const __m128 parallelNearYLanes = _mm_set1_ps((isInsideY == true) ? -allTime : allTime);
+      const __m128 parallelFarYLanes = _mm_set1_ps((isInsideY == true) ? allTime : -allTime);
 
-      // Check if any of sides collided and then find the closest point between all the sides.
-      if(leftCollided == true || topCollided == true || rightCollided == true || bottomCollided == true)
+      for (; index + SIMD_LANE_WIDTH <= aCount; index += SIMD_LANE_WIDTH)
       {
-         Vector2D<float>* closestPoint = left;
-         float closestDistance = PointDistances(aOriginPoint, *closestPoint);
+         __m128 deltaX = _mm_sub_ps(_mm_loadu_ps(apEndPointX + index), originXLanes);
+         __m128 deltaY = _mm_sub_ps(_mm_loadu_ps(apEndPointY + index), originYLanes);
 
-         if (PointDistances(aOriginPoint, *top) < closestDistance)
-         {
-            closestPoint = top;
-            closestDistance = PointDistances(aOriginPoint, *top);
-         }
-         if (PointDistances(aOriginPoint, *right) < closestDistance)
-         {
-            closestPoint = right;
-            closestDistance = PointDistances(aOriginPoint, *right);
-         }
-         if (PointDistances(aOriginPoint, *bottom) < closestDistance)
-         {
-            closestPoint = bottom;
-            closestDistance = PointDistances(aOriginPoint, *bottom);
-         }
+         // Replace direction components that are too small to invert so the division stays finite. The times of those
+         // lanes are replaced afterwards.
+         __m128 smallX = _mm_cmplt_ps(_mm_andnot_ps(signMask, deltaX), minimumDirectionLanes);
+         __m128 smallY = _mm_cmplt_ps(_mm_andnot_ps(signMask, deltaY), minimumDirectionLanes);
+         deltaX = _mm_or_ps(_mm_and_ps(smallX, minimumDirectionLanes), _mm_andnot_ps(smallX, deltaX));
+         deltaY = _mm_or_ps(_mm_and_ps(smallY, minimumDirectionLanes), _mm_andnot_ps(smallY, deltaY));
 
-         if (aCollisionPoint != nullptr)
-            *aCollisionPoint = *closestPoint;
+         __m128 minTimeX = _mm_div_ps(minXLanes, deltaX);
+         __m128 maxTimeX = _mm_div_ps(maxXLanes, deltaX);
+         __m128 minTimeY = _mm_div_ps(minYLanes, deltaY);
+         __m128 maxTimeY = _mm_div_ps(maxYLanes, deltaY);
+         __m128 nearTimeX = _mm_or_ps(_mm_and_ps(smallX, parallelNearXLanes),
+                                      _mm_andnot_ps(smallX, _mm_min_ps(minTimeX, maxTimeX)));
+         __m128 farTimeX = _mm_or_ps(_mm_and_ps(smallX, parallelFarXLanes),
+                                     _mm_andnot_ps(smallX, _mm_max_ps(minTimeX, maxTimeX)));
+         __m128 nearTimeY = _mm_or_ps(_mm_and_ps(smallY, parallelNearYLanes),
+                                      _mm_andnot_ps(smallY, _mm_min_ps(minTimeY, maxTimeY)));
+         __m128 farTimeY = _mm_or_ps(_mm_and_ps(smallY, parallelFarYLanes),
+                                     _mm_andnot_ps(smallY, _mm_max_ps(minTimeY, maxTimeY)));
 
-         delete left;
-         delete top;
-         delete right;
-         delete bottom;
+         __m128 entryTime = _mm_max_ps(_mm_max_ps(nearTimeX, nearTimeY), zeroLanes);
+         __m128 exitTime = _mm_min_ps(_mm_min_ps(farTimeX, farTimeY), oneLanes);
 
-         return true;
+         // Keep the entry time for the lanes that collided and replace the rest with the no collision time.
+         __m128 collided = _mm_cmple_ps(entryTime, _mm_add_ps(exitTime, toleranceLanes));
+         _mm_storeu_ps(apCollisionTimes + index, _mm_or_ps(_mm_and_ps(collided, entryTime),
+                                                           _mm_andnot_ps(collided, noCollisionLanes)));
       }
+#endif
 
-      delete left;
-      delete top;
-      delete right;
-      delete bottom;
-
-      return false;
+      for (; index < aCount; ++index)
+      {
+         apCollisionTimes[index] = LineBoxCollisionTime(0.0F, 0.0F,
+                                                        apEndPointX[index] - originX, apEndPointY[index] - originY,
+                                                        minX, minY, maxX, maxY);
+      }
    }
 
    //******************************************************************************************************************
@@ -431,9 +1106,9 @@ namespace Bebop { namespace Math
    {
       Vector2D<float> circleCenter(apCircle->GetCoordinateX(), apCircle->GetCoordinateY());
 
-      float originCircleDistance = PointDistances(aOriginPoint, apCircle->GetCoordinates());
+      float originCircleDistanceSquared = PointDistancesSquared(aOriginPoint, apCircle->GetCoordinates());
       // Check if the origin is within the circle.
-      if (originCircleDistance <= apCircle->GetRadius())
+      if (originCircleDistanceSquared <= static_cast<float>(apCircle->GetRadius() * apCircle->GetRadius()))
       {
          if (aCollisionPoint != nullptr)
             *aCollisionPoint = aOriginPoint;
@@ -467,8 +1142,8 @@ namespace Bebop { namespace Math
       Vector2D<float> p2(aOriginPoint.GetComponentX() - endToOrigin.GetComponentX() * abScalingFactor2,
                          aOriginPoint.GetComponentY() - endToOrigin.GetComponentY() * abScalingFactor2);
 
-      float p1ToOrigin = PointDistances(aOriginPoint, p1);
-      float p2ToOrigin = PointDistances(aOriginPoint, p2);
+      float p1ToOrigin = PointDistancesSquared(aOriginPoint, p1);
+      float p2ToOrigin = PointDistancesSquared(aOriginPoint, p2);
 
       // Find the closest intersection point to the origin.
       Vector2D<float> closestPoint(0.0F, 0.0F);
@@ -626,6 +1301,265 @@ namespace Bebop { namespace Math
       return false;
    }
 
+   //******************************************************************************************************************
+   //
+   // Method Name: LineLineSegmentCollision
+   //
+   // Description:
+   //    Checks line segment and line segment object collision. If there is a collision, the collision point is
+   //    updated with where the line crosses the line segment object. Lines that run along the line segment object
+   //    without crossing it do not collide.
+   //
+   // Arguments:
+   //    aOriginPoint    - The origin point of the line being tested.
+   //    aEndPoint       - The end point of the line being tested.
+   //    apLineSegment   - The line segment object being tested against.
+   //    aCollisionPoint - Pointer for the intersection point. May be nullptr if only the collision is needed.
+   //
+   // Return:
+   //    True  - There is collision between the line segment and line segment object.
+   //    False - There is no collision between the line segment and line segment object.
+   //
+   //******************************************************************************************************************
+   bool LineLineSegmentCollision(Vector2D<float> aOriginPoint,
+                                 Vector2D<float> aEndPoint,
+                                 const Objects::LineSegmentObject* apLineSegment,
+                                 Vector2D<float>* aCollisionPoint)
+   {
+      Vector2D<float> delta = aEndPoint - aOriginPoint;
+      float collisionTime = LineEdgeCollisionTime(aOriginPoint, delta, apLineSegment->GetStartPoint(),
+                                                  apLineSegment->GetEndPoint());
+      if (collisionTime == NO_COLLISION_TIME)
+      {
+         return false;
+      }
+
+      if (aCollisionPoint != nullptr)
+      {
+         aCollisionPoint->SetComponentX(aOriginPoint.GetComponentX() + delta.GetComponentX() * collisionTime);
+         aCollisionPoint->SetComponentY(aOriginPoint.GetComponentY() + delta.GetComponentY() * collisionTime);
+      }
+
+      return true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: LinePolygonCollision
+   //
+   // Description:
+   //    Checks line segment and convex polygon collision by checking the line against each edge of the polygon. If
+   //    there is a collision, the collision point is updated with the closest collision point (from the origin). A
+   //    line that starts inside the polygon collides at its origin.
+   //
+   // Arguments:
+   //    aOriginPoint    - The origin point of the line being tested.
+   //    aEndPoint       - The end point of the line being tested.
+   //    apPolygon       - The polygon being tested against.
+   //    aCollisionPoint - Pointer for the closest intersection point. May be nullptr if only the collision is needed.
+   //
+   // Return:
+   //    True  - There is collision between the line segment and polygon.
+   //    False - There is no collision between the line segment and polygon.
+   //
+   //******************************************************************************************************************
+   bool LinePolygonCollision(Vector2D<float> aOriginPoint,
+                             Vector2D<float> aEndPoint,
+                             const Objects::PolygonObject* apPolygon,
+                             Vector2D<float>* aCollisionPoint)
+   {
+      if (PointInPolygon(aOriginPoint, apPolygon) == true)
+      {
+         if (aCollisionPoint != nullptr)
+            *aCollisionPoint = aOriginPoint;
+
+         return true;
+      }
+
+      // The closest crossing of any edge is where the line enters the polygon.
+      Vector2D<float> delta = aEndPoint - aOriginPoint;
+      float closestTime = NO_COLLISION_TIME;
+      const unsigned int pointCount = apPolygon->GetPointCount();
+      for (unsigned int i = 0; i < pointCount; ++i)
+      {
+         closestTime = std::min(closestTime, LineEdgeCollisionTime(aOriginPoint, delta, apPolygon->GetPoint(i),
+                                                                   apPolygon->GetPoint((i + 1) % pointCount)));
+      }
+
+      if (closestTime == NO_COLLISION_TIME)
+      {
+         return false;
+      }
+
+      if (aCollisionPoint != nullptr)
+      {
+         aCollisionPoint->SetComponentX(aOriginPoint.GetComponentX() + delta.GetComponentX() * closestTime);
+         aCollisionPoint->SetComponentY(aOriginPoint.GetComponentY() + delta.GetComponentY() * closestTime);
+      }
+
+      return true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: LineSegmentCircleCollision
+   //
+   // Description:
+   //    Checks line segment object and circle object collision by finding the point on the line segment closest to
+   //    the circle center.
+   //
+   // Arguments:
+   //    apLineSegment - The line segment object to be checked for collision.
+   //    apCircle      - The circle object to be checked for collision.
+   //
+   // Return:
+   //    True  - The line segment and circle collide.
+   //    False - The line segment and circle do not collide.
+   //
+   //******************************************************************************************************************
+   bool LineSegmentCircleCollision(const Objects::LineSegmentObject* apLineSegment,
+                                   const Objects::CircleObject* apCircle)
+   {
+      const float radius = static_cast<float>(apCircle->GetRadius());
+      return PointEdgeDistanceSquared(apCircle->GetCoordinates(), apLineSegment->GetStartPoint(),
+                                      apLineSegment->GetEndPoint()) <= radius * radius;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: LineSegmentRectangleCollision
+   //
+   // Description:
+   //    Checks line segment object and rectangle object collision.
+   //
+   // Arguments:
+   //    apLineSegment - The line segment object to be checked for collision.
+   //    apRectangle   - The rectangle object to be checked for collision.
+   //
+   // Return:
+   //    True  - The line segment and rectangle collide.
+   //    False - The line segment and rectangle do not collide.
+   //
+   //******************************************************************************************************************
+   bool LineSegmentRectangleCollision(const Objects::LineSegmentObject* apLineSegment,
+                                      const Objects::RectangleObject* apRectangle)
+   {
+      Vector2D<float> startPoint = apLineSegment->GetStartPoint();
+      Vector2D<float> delta = apLineSegment->GetEndPoint() - startPoint;
+      return LineBoxCollisionTime(startPoint.GetComponentX(), startPoint.GetComponentY(),
+                                  delta.GetComponentX(), delta.GetComponentY(),
+                                  apRectangle->GetCoordinateX(), apRectangle->GetCoordinateY(),
+                                  apRectangle->GetCoordinateX() + apRectangle->GetWidth(),
+                                  apRectangle->GetCoordinateY() + apRectangle->GetHeight()) != NO_COLLISION_TIME;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: PolygonCircleCollision
+   //
+   // Description:
+   //    Checks convex polygon object and circle object collision. They collide when the circle center is inside the
+   //    polygon or an edge of the polygon is within the radius of the center.
+   //
+   // Arguments:
+   //    apPolygon - The polygon object to be checked for collision.
+   //    apCircle  - The circle object to be checked for collision.
+   //
+   // Return:
+   //    True  - The polygon and circle collide.
+   //    False - The polygon and circle do not collide.
+   //
+   //******************************************************************************************************************
+   bool PolygonCircleCollision(const Objects::PolygonObject* apPolygon, const Objects::CircleObject* apCircle)
+   {
+      if (PointInPolygon(apCircle->GetCoordinates(), apPolygon) == true)
+      {
+         return true;
+      }
+
+      const float radiusSquared = static_cast<float>(apCircle->GetRadius() * apCircle->GetRadius());
+      const unsigned int pointCount = apPolygon->GetPointCount();
+      for (unsigned int i = 0; i < pointCount; ++i)
+      {
+         if (PointEdgeDistanceSquared(apCircle->GetCoordinates(), apPolygon->GetPoint(i),
+                                      apPolygon->GetPoint((i + 1) % pointCount)) <= radiusSquared)
+         {
+            return true;
+         }
+      }
+
+      return false;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: PolygonRectangleCollision
+   //
+   // Description:
+   //    Checks convex polygon object and rectangle object collision with the separating axis test. The shapes do not
+   //    collide if there is an edge direction of either shape along which their projections do not overlap.
+   //
+   // Arguments:
+   //    apPolygon   - The polygon object to be checked for collision.
+   //    apRectangle - The rectangle object to be checked for collision.
+   //
+   // Return:
+   //    True  - The polygon and rectangle collide.
+   //    False - The polygon and rectangle do not collide.
+   //
+   //******************************************************************************************************************
+   bool PolygonRectangleCollision(const Objects::PolygonObject* apPolygon,
+                                  const Objects::RectangleObject* apRectangle)
+   {
+      // The edge normals of the rectangle are the X and Y axes.
+      float polygonMinimum = 0.0F;
+      float polygonMaximum = 0.0F;
+      ProjectObject(apPolygon, Vector2D<float>(1.0F, 0.0F), &polygonMinimum, &polygonMaximum);
+      if (polygonMaximum < apRectangle->GetCoordinateX() ||
+          polygonMinimum > apRectangle->GetCoordinateX() + apRectangle->GetWidth())
+      {
+         return false;
+      }
+
+      ProjectObject(apPolygon, Vector2D<float>(0.0F, 1.0F), &polygonMinimum, &polygonMaximum);
+      if (polygonMaximum < apRectangle->GetCoordinateY() ||
+          polygonMinimum > apRectangle->GetCoordinateY() + apRectangle->GetHeight())
+      {
+         return false;
+      }
+
+      return SeparatedOnPolygonAxes(apPolygon, apRectangle) == false;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: PolygonPolygonCollision
+   //
+   // Description:
+   //    Checks two convex polygon objects for collision with the separating axis test.
+   //
+   // Arguments:
+   //    apPolygonOne - The first polygon object to be checked for collision.
+   //    apPolygonTwo - The second polygon object to be checked for collision.
+   //
+   // Return:
+   //    True  - The polygons collide.
+   //    False - The polygons do not collide.
+   //
+   //******************************************************************************************************************
+   bool PolygonPolygonCollision(const Objects::PolygonObject* apPolygonOne,
+                                const Objects::PolygonObject* apPolygonTwo)
+   {
+      // A polygon whose points were rejected has no edges to separate it along, so it is ruled out first.
+      if (apPolygonOne->GetPointCount() == 0 || apPolygonTwo->GetPointCount() == 0)
+      {
+         return false;
+      }
+
+      return SeparatedOnPolygonAxes(apPolygonOne, apPolygonTwo) == false &&
+             SeparatedOnPolygonAxes(apPolygonTwo, apPolygonOne) == false;
+   }
+
    //******************************************************************************************************************
    //
    // Method Name: PointDistances
@@ -649,83 +1583,26 @@ namespace Bebop { namespace Math
                    (aEndPoint.GetComponentY() - aOriginPoint.GetComponentY())*(aEndPoint.GetComponentY() - aOriginPoint.GetComponentY()));
    }
 
-   namespace
+   //******************************************************************************************************************
+   //
+   // Method Name: PointDistancesSquared
+   //
+   // Description:
+   //    Returns the squared distance between two points. This avoids the square root and should be used instead of
+   //    PointDistances when the distance is only compared against another distance or a threshold.
+   //
+   // Arguments:
+   //    aOriginPoint - The origin point of the distance being tested.
+   //    aEndPoint    - The end point of the distance being tested.
+   //
+   // Return:
+   //    Returns the squared distance between two points.
+   //
+   //******************************************************************************************************************
+   float PointDistancesSquared(const Vector2D<float>& aOriginPoint, const Vector2D<float>& aEndPoint)
    {
-      //***************************************************************************************************************
-      //
-      // Method Name: Orientation
-      //
-      // Description:
-      //    Find the orientation between ordered triplet points.
-      //
-      // Arguments:
-      //    aPointOneX   - The origin X-Coordinate of the first point.
-      //    aPointOneY   - The origin Y-Coordinate of the first point.
-      //    aPointTwoX   - The origin X-Coordinate of the two point.
-      //    aPointTwoY   - The origin Y-Coordinate of the two point.
-      //    aPointThreeX - The origin X-Coordinate of the three point.
-      //    aPointThreeY - The origin Y-Coordinate of the three point.
-      //
-      // Return:
-      //    0 = Points are collinear.
-      //    1 = Points are in Clockwise orientation.
-      //    2 = Points are in Counterclockwise orientation.
-      //
-      //***************************************************************************************************************
-      int Orientation(Vector2D<float> aPointOne,
-                      Vector2D<float> aPointTwo,
-                      Vector2D<float> aPointThree)
-      {
-         int val = static_cast<int>((aPointTwo.GetComponentY() - aPointOne.GetComponentY()) * (aPointThree.GetComponentX() - aPointTwo.GetComponentX()) -
-                                    (aPointTwo.GetComponentX() - aPointOne.GetComponentX()) * (aPointThree.GetComponentY() - aPointTwo.GetComponentY()));
-
-         // Check if the points are collinear.
-         if (val == 0)
-         {
-            return 0;
-         }
-
-         // If the value is larger than 0 the points are in clockwise orientation.
-         // Else the value is less than 0 and the points are counterclockwise orientation.
-         return (val > 0) ? 1: 2;
-      }
-
-      //***************************************************************************************************************
-      //
-      // Method Name: OnSegment
-      //
-      // Description:
-      //    Given three collinear points (One, two, and Three), this function checks if point Two lies on line segment
-      //    One->Three.
-      //
-      // Arguments:
-      //    aPointOneX   - The origin X-Coordinate of the first point.
-      //    aPointOneY   - The origin Y-Coordinate of the first point.
-      //    aPointTwoX   - The origin X-Coordinate of the two point.
-      //    aPointTwoY   - The origin Y-Coordinate of the two point.
-      //    aPointThreeX - The origin X-Coordinate of the three point.
-      //    aPointThreeY - The origin Y-Coordinate of the three point.
-      //
-      // Return:
-      //    True  - Point Two lies on line segment One->Three.
-      //    False - Point Two does not lie on line segment One->Three.
-      //
-      //***************************************************************************************************************
-      bool OnSegment(Vector2D<float> aPointOne,
-                     Vector2D<float> aPointTwo,
-                     Vector2D<float> aPointThree)
-      {
-         // Check if point Two lies on line segment One-Three.
-         if (aPointTwo.GetComponentX() <= std::max(aPointOne.GetComponentX(), aPointThree.GetComponentX()) &&
-             aPointTwo.GetComponentX() >= std::min(aPointOne.GetComponentX(), aPointThree.GetComponentX()) && 
-             aPointTwo.GetComponentY() <= std::max(aPointOne.GetComponentY(), aPointThree.GetComponentY()) &&
-             aPointTwo.GetComponentY() >= std::min(aPointOne.GetComponentY(), aPointThree.GetComponentY()))
-         {
-            return true; 
-         }
-  
-         // Point Two does not lie on line segment One->Three.
-         return false; 
-      }
+      float distanceX = aEndPoint.GetComponentX() - aOriginPoint.GetComponentX();
+      float distanceY = aEndPoint.GetComponentY() - aOriginPoint.GetComponentY();
+      return (distanceX * distanceX) + (distanceY * distanceY);
    }
 }}
\ No newline at end of file
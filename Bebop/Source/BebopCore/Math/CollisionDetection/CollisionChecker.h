@@ -13,10 +13,26 @@
 
 #include "../../Objects/RectangleObject.h"
 #include "../../Objects/CircleObject.h"
+#include "../../Objects/LineSegmentObject.h"
+#include "../../Objects/PolygonObject.h"
+#include "../MathConstants.h"
 #include <vector>
 
 namespace Bebop { namespace Math
 {
+   // The points where the edges of two rectangles cross. The points are stored inline so finding them never allocates.
+   struct RectangleContacts
+   {
+      // The number of valid points stored.
+      unsigned int count;
+
+      // The X-Coordinate of each point.
+      float pointX[MAXIMUM_RECTANGLE_CONTACTS];
+
+      // The Y-Coordinate of each point.
+      float pointY[MAXIMUM_RECTANGLE_CONTACTS];
+   };
+
    //******************************************************************************************************************
    //
    // Method Name: RectangleRectangleCollision
@@ -35,6 +51,31 @@ namespace Bebop { namespace Math
    bool RectangleRectangleCollision(Objects::RectangleObject* mpRectangleOne,
                                     Objects::RectangleObject* mpRectangleTwo,
                                     std::vector<Vector2D<float>>* apCollisionPoints);
+
+   //******************************************************************************************************************
+   //
+   // Method Name: RectangleRectangleContacts
+   //
+   // Description:
+   //    Checks two rectangular objects for collision and finds the points where their edges cross. Since both
+   //    rectangles are axis aligned, each vertical edge of one rectangle can only cross the horizontal edges of the
+   //    other, so the points are found directly from the edge coordinates. Duplicate points, such as from shared
+   //    edges, are only stored once.
+   //
+   // Arguments:
+   //    apRectangleOne - The first rectangular object to be checked for collision.
+   //    apRectangleTwo - The second rectangular object to be checked for collision.
+   //    apContacts     - The contacts updated with the crossing points. May be nullptr if only the collision is
+   //                     needed.
+   //
+   // Return:
+   //    True  - The rectangles collide.
+   //    False - The rectangles do not collide.
+   //
+   //******************************************************************************************************************
+   bool RectangleRectangleContacts(const Objects::RectangleObject* apRectangleOne,
+                                   const Objects::RectangleObject* apRectangleTwo,
+                                   RectangleContacts* apContacts);
    
    //******************************************************************************************************************
    //
@@ -71,6 +112,56 @@ namespace Bebop { namespace Math
    bool CircleCircleCollision(Objects::CircleObject* mpCircleOne, Objects::CircleObject* mpCircleTwo,
                               std::vector<Vector2D<float>>* apCollisionPoints);
    
+   //******************************************************************************************************************
+   //
+   // Method Name: SweptRectangleRectangleCollision
+   //
+   // Description:
+   //    Finds when a moving rectangle first touches a still rectangle during a movement. The still rectangle is grown
+   //    by the size of the moving rectangle so the check becomes the top left corner of the moving rectangle
+   //    travelling as a line through the grown rectangle. This catches collisions that would be missed by only
+   //    checking the start and end positions of a fast moving rectangle.
+   //
+   // Arguments:
+   //    apMovingRectangle - The rectangle being moved, at its position before the movement.
+   //    aMovement         - The distance the moving rectangle travels along each axis.
+   //    apStillRectangle  - The rectangle that is not moving.
+   //
+   // Return:
+   //    Returns the time of impact between 0.0 (start of the movement) and 1.0 (end of the movement), or
+   //    NO_COLLISION_TIME if the rectangles do not touch during the movement. Rectangles already touching return
+   //    0.0.
+   //
+   //******************************************************************************************************************
+   float SweptRectangleRectangleCollision(const Objects::RectangleObject* apMovingRectangle,
+                                          const Vector2D<float>& aMovement,
+                                          const Objects::RectangleObject* apStillRectangle);
+
+   //******************************************************************************************************************
+   //
+   // Method Name: SweptCircleRectangleCollision
+   //
+   // Description:
+   //    Finds when a moving circle first touches a still rectangle during a movement. The rectangle is grown by the
+   //    radius of the circle so the check becomes the circle center travelling as a line through the grown
+   //    rectangle. When the line enters near a corner, the grown rectangle is rounded there, so the line is checked
+   //    against a circle of the same radius around that corner instead.
+   //
+   // Arguments:
+   //    apMovingCircle   - The circle being moved, at its position before the movement.
+   //    aMovement        - The distance the moving circle travels along each axis.
+   //    apStillRectangle - The rectangle that is not moving.
+   //
+   // Return:
+   //    Returns the time of impact between 0.0 (start of the movement) and 1.0 (end of the movement), or
+   //    NO_COLLISION_TIME if the circle and rectangle do not touch during the movement. Shapes already touching
+   //    return 0.0.
+   //
+   //******************************************************************************************************************
+   float SweptCircleRectangleCollision(const Objects::CircleObject* apMovingCircle,
+                                       const Vector2D<float>& aMovement,
+                                       const Objects::RectangleObject* apStillRectangle);
+
    //******************************************************************************************************************
    //
    // Method Name: LineRectangleCollision
@@ -96,7 +187,70 @@ namespace Bebop { namespace Math
                                Vector2D<float> aEndPoint,
                                Objects::RectangleObject* mpRectangle,
                                Vector2D<float>* aCollisionPoint);
-   
+
+   //******************************************************************************************************************
+   //
+   // Method Name: LineRectanglesCollision
+   //
+   // Description:
+   //    Checks one line segment against many rectangles at once. The rectangles are passed as separate arrays of
+   //    their edges so groups of rectangles can be checked together in SIMD lanes. For each rectangle the collision
+   //    time is written, where 0.0 is the origin of the line and 1.0 is the end of the line. A collision point can
+   //    be found with aOriginPoint + (aEndPoint - aOriginPoint) * time.
+   //
+   // Arguments:
+   //    aOriginPoint      - The origin point of the line being tested.
+   //    aEndPoint         - The end point of the line being tested.
+   //    apMinX            - The left edge of each rectangle.
+   //    apMinY            - The top edge of each rectangle.
+   //    apMaxX            - The right edge of each rectangle.
+   //    apMaxY            - The bottom edge of each rectangle.
+   //    aCount            - The number of rectangles in the arrays.
+   //    apCollisionTimes  - Array of aCount values for the collision time with each rectangle. Rectangles that do not
+   //                        collide with the line are given NO_COLLISION_TIME.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void LineRectanglesCollision(const Vector2D<float>& aOriginPoint,
+                                const Vector2D<float>& aEndPoint,
+                                const float* apMinX,
+                                const float* apMinY,
+                                const float* apMaxX,
+                                const float* apMaxY,
+                                const unsigned int aCount,
+                                float* apCollisionTimes);
+
+   //******************************************************************************************************************
+   //
+   // Method Name: LinesRectangleCollision
+   //
+   // Description:
+   //    Checks many line segments that share an origin point against one rectangle at once. The end points are
+   //    passed as separate arrays of their components so groups of lines can be checked together in SIMD lanes. For
+   //    each line the collision time is written, where 0.0 is the origin of the line and 1.0 is the end of the line.
+   //
+   // Arguments:
+   //    aOriginPoint     - The origin point shared by all of the lines.
+   //    apEndPointX      - The X-Coordinate of the end point of each line.
+   //    apEndPointY      - The Y-Coordinate of the end point of each line.
+   //    aCount           - The number of lines in the arrays.
+   //    apRectangle      - The rectangle being tested against.
+   //    apCollisionTimes - Array of aCount values for the collision time of each line. Lines that do not collide with
+   //                       the rectangle are given NO_COLLISION_TIME.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void LinesRectangleCollision(const Vector2D<float>& aOriginPoint,
+                                const float* apEndPointX,
+                                const float* apEndPointY,
+                                const unsigned int aCount,
+                                const Objects::RectangleObject* apRectangle,
+                                float* apCollisionTimes);
+
    //******************************************************************************************************************
    //
    // Method Name: LineCircleCollision
@@ -154,6 +308,153 @@ namespace Bebop { namespace Math
                           Vector2D<float> aLineTwoEndPoint,
                           Vector2D<float>* aCollisionPoint);
 
+   //******************************************************************************************************************
+   //
+   // Method Name: LineLineSegmentCollision
+   //
+   // Description:
+   //    Checks line segment and line segment object collision. If there is a collision, the collision point is
+   //    updated with where the line crosses the line segment object. Lines that run along the line segment object
+   //    without crossing it do not collide.
+   //
+   // Arguments:
+   //    aOriginPoint    - The origin point of the line being tested.
+   //    aEndPoint       - The end point of the line being tested.
+   //    apLineSegment   - The line segment object being tested against.
+   //    aCollisionPoint - Pointer for the intersection point. May be nullptr if only the collision is needed.
+   //
+   // Return:
+   //    True  - There is collision between the line segment and line segment object.
+   //    False - There is no collision between the line segment and line segment object.
+   //
+   //******************************************************************************************************************
+   bool LineLineSegmentCollision(Vector2D<float> aOriginPoint,
+                                 Vector2D<float> aEndPoint,
+                                 const Objects::LineSegmentObject* apLineSegment,
+                                 Vector2D<float>* aCollisionPoint);
+
+   //******************************************************************************************************************
+   //
+   // Method Name: LinePolygonCollision
+   //
+   // Description:
+   //    Checks line segment and convex polygon collision by checking the line against each edge of the polygon. If
+   //    there is a collision, the collision point is updated with the closest collision point (from the origin). A
+   //    line that starts inside the polygon collides at its origin.
+   //
+   // Arguments:
+   //    aOriginPoint    - The origin point of the line being tested.
+   //    aEndPoint       - The end point of the line being tested.
+   //    apPolygon       - The polygon being tested against.
+   //    aCollisionPoint - Pointer for the closest intersection point. May be nullptr if only the collision is needed.
+   //
+   // Return:
+   //    True  - There is collision between the line segment and polygon.
+   //    False - There is no collision between the line segment and polygon.
+   //
+   //******************************************************************************************************************
+   bool LinePolygonCollision(Vector2D<float> aOriginPoint,
+                             Vector2D<float> aEndPoint,
+                             const Objects::PolygonObject* apPolygon,
+                             Vector2D<float>* aCollisionPoint);
+
+   //******************************************************************************************************************
+   //
+   // Method Name: LineSegmentCircleCollision
+   //
+   // Description:
+   //    Checks line segment object and circle object collision by finding the point on the line segment closest to
+   //    the circle center.
+   //
+   // Arguments:
+   //    apLineSegment - The line segment object to be checked for collision.
+   //    apCircle      - The circle object to be checked for collision.
+   //
+   // Return:
+   //    True  - The line segment and circle collide.
+   //    False - The line segment and circle do not collide.
+   //
+   //******************************************************************************************************************
+   bool LineSegmentCircleCollision(const Objects::LineSegmentObject* apLineSegment,
+                                   const Objects::CircleObject* apCircle);
+
+   //******************************************************************************************************************
+   //
+   // Method Name: LineSegmentRectangleCollision
+   //
+   // Description:
+   //    Checks line segment object and rectangle object collision.
+   //
+   // Arguments:
+   //    apLineSegment - The line segment object to be checked for collision.
+   //    apRectangle   - The rectangle object to be checked for collision.
+   //
+   // Return:
+   //    True  - The line segment and rectangle collide.
+   //    False - The line segment and rectangle do not collide.
+   //
+   //******************************************************************************************************************
+   bool LineSegmentRectangleCollision(const Objects::LineSegmentObject* apLineSegment,
+                                      const Objects::RectangleObject* apRectangle);
+
+   //******************************************************************************************************************
+   //
+   // Method Name: PolygonCircleCollision
+   //
+   // Description:
+   //    Checks convex polygon object and circle object collision. They collide when the circle center is inside the
+   //    polygon or an edge of the polygon is within the radius of the center.
+   //
+   // Arguments:
+   //    apPolygon - The polygon object to be checked for collision.
+   //    apCircle  - The circle object to be checked for collision.
+   //
+   // Return:
+   //    True  - The polygon and circle collide.
+   //    False - The polygon and circle do not collide.
+   //
+   //******************************************************************************************************************
+   bool PolygonCircleCollision(const Objects::PolygonObject* apPolygon, const Objects::CircleObject* apCircle);
+
+   //******************************************************************************************************************
+   //
+   // Method Name: PolygonRectangleCollision
+   //
+   // Description:
+   //    Checks convex polygon object and rectangle object collision with the separating axis test. The shapes do not
+   //    collide if there is an edge direction of either shape along which their projections do not overlap.
+   //
+   // Arguments:
+   //    apPolygon   - The polygon object to be checked for collision.
+   //    apRectangle - The rectangle object to be checked for collision.
+   //
+   // Return:
+   //    True  - The polygon and rectangle collide.
+   //    False - The polygon and rectangle do not collide.
+   //
+   //******************************************************************************************************************
+   bool PolygonRectangleCollision(const Objects::PolygonObject* apPolygon,
+                                  const Objects::RectangleObject* apRectangle);
+
+   //******************************************************************************************************************
+   //
+   // Method Name: PolygonPolygonCollision
+   //
+   // Description:
+   //    Checks two convex polygon objects for collision with the separating axis test.
+   //
+   // Arguments:
+   //    apPolygonOne - The first polygon object to be checked for collision.
+   //    apPolygonTwo - The second polygon object to be checked for collision.
+   //
+   // Return:
+   //    True  - The polygons collide.
+   //    False - The polygons do not collide.
+   //
+   //******************************************************************************************************************
+   bool PolygonPolygonCollision(const Objects::PolygonObject* apPolygonOne,
+                                const Objects::PolygonObject* apPolygonTwo);
+
    //******************************************************************************************************************
    //
    // Method Name: PointDistances
@@ -173,58 +474,23 @@ namespace Bebop { namespace Math
    //******************************************************************************************************************
    float PointDistances(Vector2D<float> aOriginPoint, Vector2D<float> aEndPoint);
 
-   namespace
-   {
-      //***************************************************************************************************************
-      //
-      // Method Name: Orientation
-      //
-      // Description:
-      //    Find the orientation between ordered triplet points.
-      //
-      // Arguments:
-      //    aPointOneX   - The origin X-Coordinate of the first point.
-      //    aPointOneY   - The origin Y-Coordinate of the first point.
-      //    aPointTwoX   - The origin X-Coordinate of the two point.
-      //    aPointTwoY   - The origin Y-Coordinate of the two point.
-      //    aPointThreeX - The origin X-Coordinate of the three point.
-      //    aPointThreeY - The origin Y-Coordinate of the three point.
-      //
-      // Return:
-      //    0 = Points are collinear.
-      //    1 = Points are in Clockwise orientation.
-      //    2 = Points are in Counterclockwise orientation.
-      //
-      //***************************************************************************************************************
-      int Orientation(Vector2D<float> aPointOne,
-                      Vector2D<float> aPointTwo,
-                      Vector2D<float> aPointThree);
-      
-      //***************************************************************************************************************
-      //
-      // Method Name: OnSegment
-      //
-      // Description:
-      //    Given three collinear points (One, two, and Three), this function checks if point Two lies on line
-      //    segment One->Three.
-      //
-      // Arguments:
-      //    aPointOneX   - The origin X-Coordinate of the first point.
-      //    aPointOneY   - The origin Y-Coordinate of the first point.
-      //    aPointTwoX   - The origin X-Coordinate of the two point.
-      //    aPointTwoY   - The origin Y-Coordinate of the two point.
-      //    aPointThreeX - The origin X-Coordinate of the three point.
-      //    aPointThreeY - The origin Y-Coordinate of the three point.
-      //
-      // Return:
-      //    True  - Point Two lies on line segment One->Three.
-      //    False - Point Two does not lie on line segment One->Three.
-      //
-      //***************************************************************************************************************
-      bool OnSegment(Vector2D<float> aPointOne,
-                     Vector2D<float> aPointTwo,
-                     Vector2D<float> aPointThree);
-   }
+   //******************************************************************************************************************
+   //
+   // Method Name: PointDistancesSquared
+   //
+   // Description:
+   //    Returns the squared distance between two points. This avoids the square root and should be used instead of
+   //    PointDistances when the distance is only compared against another distance or a threshold.
+   //
+   // Arguments:
+   //    aOriginPoint - The origin point of the distance being tested.
+   //    aEndPoint    - The end point of the distance being tested.
+   //
+   // Return:
+   //    Returns the squared distance between two points.
+   //
+   //******************************************************************************************************************
+   float PointDistancesSquared(const Vector2D<float>& aOriginPoint, const Vector2D<float>& aEndPoint);
 }}
 
 #endif // CollisionChecker_H
\ No newline at end of file
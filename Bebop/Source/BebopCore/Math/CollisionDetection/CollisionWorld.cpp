@@ -0,0 +1,551 @@
+//*********************************************************************************************************************
+//
+// File: CollisionWorld.cpp
+//
+// Description:
+//    This class handles finding all overlapping pairs of registered objects. A sweep-and-prune broadphase keeps the
+//    objects sorted by the low edge of their bounding box along the axis they are most spread out on, so only objects
+//    whose boxes overlap are handed to the narrow-phase checks in the collision checker. Objects usually move a small
+//    amount between steps, so the sorted order is mostly kept and is repaired with an insertion sort.
+//
+//*********************************************************************************************************************
+
+#include "CollisionWorld.h"
+#include "CollisionChecker.h"
+#include "../MathConstants.h"
+#include "../../Objects/RectangleObject.h"
+#include "../../Objects/CircleObject.h"
+#include "../../Objects/LineSegmentObject.h"
+#include "../../Objects/PolygonObject.h"
+#include <algorithm>
+
+namespace Bebop { namespace Math
+{
+//*********************************************************************************************************************
+// Public Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: CollisionWorld
+   //
+   // Description:
+   //    Constructor for the collision world that sets member variables to their default values.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   CollisionWorld::CollisionWorld() :
+      mCandidatePairCount(0), mAddedSinceStep(0), mFullSortNeeded(false), mSweepAlongY(false)
+   {
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: ~CollisionWorld
+   //
+   // Description:
+   //    Destructor for the collision world. The registered objects are not owned by the world and are not freed.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   CollisionWorld::~CollisionWorld()
+   {
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AddObject
+   //
+   // Description:
+   //    Registers an object to be checked for collisions. Objects already registered are ignored.
+   //
+   // Arguments:
+   //    apObject - The object being registered.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void CollisionWorld::AddObject(Objects::Object* apObject)
+   {
+      if (apObject == nullptr || mProxyIndices.insert(std::make_pair(apObject, mProxies.size())).second == false)
+      {
+         return;
+      }
+
+      Proxy proxy = {apObject, 0.0F, 0.0F, 0.0F, 0.0F, 0.0F, 0.0F, false};
+      UpdateBounds(proxy);
+      mProxies.push_back(proxy);
+      ++mAddedSinceStep;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: RemoveObject
+   //
+   // Description:
+   //    Removes a registered object from the collision world. The last proxy takes the place of the removed one, so
+   //    the sorted order is restored by a full sort on the next step.
+   //
+   // Arguments:
+   //    apObject - The object being removed.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void CollisionWorld::RemoveObject(Objects::Object* apObject)
+   {
+      auto iter = mProxyIndices.find(apObject);
+      if (iter == mProxyIndices.end())
+      {
+         return;
+      }
+
+      std::size_t index = iter->second;
+      mProxyIndices.erase(iter);
+
+      // Pairs from the last step that refer to the removed object are dropped together when the pairs are next asked
+      // for, so removing many objects searches the pairs once.
+      if (mProxies[index].collided == true)
+      {
+         mRemovedCollidedObjects.push_back(apObject);
+      }
+
+      if (index != mProxies.size() - 1)
+      {
+         mProxies[index] = mProxies.back();
+         mProxyIndices[mProxies[index].pObject] = index;
+         mFullSortNeeded = true;
+      }
+      mProxies.pop_back();
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetObjectCount
+   //
+   // Description:
+   //    Returns the number of objects registered in the collision world.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the number of registered objects.
+   //
+   //******************************************************************************************************************
+   unsigned int CollisionWorld::GetObjectCount() const
+   {
+      return static_cast<unsigned int>(mProxies.size());
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: Step
+   //
+   // Description:
+   //    Refreshes the bounding boxes of every registered object from their current positions, picks the axis the
+   //    objects are most spread out on to sweep along, restores the sorted order, and gathers the pairs of objects
+   //    that collide. The found pairs replace the pairs from the previous step.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void CollisionWorld::Step()
+   {
+      mCollisionPairs.clear();
+      mRemovedCollidedObjects.clear();
+      mCandidatePairCount = 0;
+
+      // Sum the centers of the boxes on each axis to find the axis the objects are most spread out on. Sweeping along
+      // it keeps the number of boxes that overlap on the sweep axis alone as low as possible.
+      double sumX = 0.0;
+      double sumY = 0.0;
+      double sumSquaresX = 0.0;
+      double sumSquaresY = 0.0;
+      for (auto iter = mProxies.begin(); iter != mProxies.end(); ++iter)
+      {
+         UpdateBounds(*iter);
+         iter->collided = false;
+
+         double centerX = (static_cast<double>(iter->minX) + iter->maxX) / 2.0;
+         double centerY = (static_cast<double>(iter->minY) + iter->maxY) / 2.0;
+         sumX += centerX;
+         sumY += centerY;
+         sumSquaresX += centerX * centerX;
+         sumSquaresY += centerY * centerY;
+      }
+
+      if (mProxies.empty() == false)
+      {
+         double count = static_cast<double>(mProxies.size());
+         double varianceX = sumSquaresX / count - (sumX / count) * (sumX / count);
+         double varianceY = sumSquaresY / count - (sumY / count) * (sumY / count);
+         bool sweepAlongY = varianceY > varianceX;
+         if (sweepAlongY != mSweepAlongY)
+         {
+            mSweepAlongY = sweepAlongY;
+            mFullSortNeeded = true;
+         }
+      }
+
+      for (auto iter = mProxies.begin(); iter != mProxies.end(); ++iter)
+      {
+         iter->sweepMin = (mSweepAlongY == true) ? iter->minY : iter->minX;
+         iter->sweepMax = (mSweepAlongY == true) ? iter->maxY : iter->maxX;
+      }
+
+      SortProxies();
+
+      // Sweep along the sweep axis. Once a proxy starts past the high edge of the current proxy no later proxy can
+      // overlap it, so the inner loop stops there.
+      const std::size_t proxyCount = mProxies.size();
+      for (std::size_t i = 0; i < proxyCount; ++i)
+      {
+         Proxy& current = mProxies[i];
+
+         for (std::size_t j = i + 1; j < proxyCount && mProxies[j].sweepMin <= current.sweepMax; ++j)
+         {
+            Proxy& other = mProxies[j];
+
+            // Reject proxies that do not overlap along both axes before doing the narrow phase.
+            if (other.minX > current.maxX || other.maxX < current.minX ||
+                other.minY > current.maxY || other.maxY < current.minY)
+            {
+               continue;
+            }
+
+            ++mCandidatePairCount;
+            if (NarrowPhase(current.pObject, other.pObject) == true)
+            {
+               mCollisionPairs.push_back(std::make_pair(current.pObject, other.pObject));
+               current.collided = true;
+               other.collided = true;
+            }
+         }
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetCollisionPairs
+   //
+   // Description:
+   //    Returns the pairs of objects found to be colliding during the last step. Pairs that refer to an object
+   //    removed since the step are dropped first.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the vector of colliding object pairs.
+   //
+   //******************************************************************************************************************
+   const std::vector<std::pair<Objects::Object*, Objects::Object*>>& CollisionWorld::GetCollisionPairs()
+   {
+      if (mRemovedCollidedObjects.empty() == false)
+      {
+         std::sort(mRemovedCollidedObjects.begin(), mRemovedCollidedObjects.end());
+         auto isRemoved = [this](Objects::Object* apObject)
+         {
+            return std::binary_search(mRemovedCollidedObjects.begin(), mRemovedCollidedObjects.end(), apObject);
+         };
+         mCollisionPairs.erase(std::remove_if(mCollisionPairs.begin(), mCollisionPairs.end(),
+                                              [&isRemoved](const std::pair<Objects::Object*, Objects::Object*>& aPair)
+                                              {
+                                                 return isRemoved(aPair.first) == true ||
+                                                        isRemoved(aPair.second) == true;
+                                              }),
+                               mCollisionPairs.end());
+         mRemovedCollidedObjects.clear();
+      }
+
+      return mCollisionPairs;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetCandidatePairCount
+   //
+   // Description:
+   //    Returns the number of pairs whose bounding boxes overlapped during the last step and were handed to the
+   //    narrow-phase checks.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the number of candidate pairs from the last step.
+   //
+   //******************************************************************************************************************
+   unsigned int CollisionWorld::GetCandidatePairCount() const
+   {
+      return mCandidatePairCount;
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: UpdateBounds
+   //
+   // Description:
+   //    Updates the bounding box of a proxy from the current position and size of its object.
+   //
+   // Arguments:
+   //    aProxy - The proxy being updated.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void CollisionWorld::UpdateBounds(Proxy& aProxy) const
+   {
+      const Objects::Object* object = aProxy.pObject;
+
+      if (object->GetObjectType() == Objects::ObjectType::RECTANGLE)
+      {
+         // Rectangle coordinates are the top left corner.
+         const Objects::RectangleObject* rectangle = static_cast<const Objects::RectangleObject*>(object);
+         aProxy.minX = rectangle->GetCoordinateX();
+         aProxy.minY = rectangle->GetCoordinateY();
+         aProxy.maxX = rectangle->GetCoordinateX() + rectangle->GetWidth();
+         aProxy.maxY = rectangle->GetCoordinateY() + rectangle->GetHeight();
+      }
+      else if (object->GetObjectType() == Objects::ObjectType::CIRCLE)
+      {
+         // Circle coordinates are the center point.
+         const Objects::CircleObject* circle = static_cast<const Objects::CircleObject*>(object);
+         aProxy.minX = circle->GetCoordinateX() - circle->GetRadius();
+         aProxy.minY = circle->GetCoordinateY() - circle->GetRadius();
+         aProxy.maxX = circle->GetCoordinateX() + circle->GetRadius();
+         aProxy.maxY = circle->GetCoordinateY() + circle->GetRadius();
+      }
+      else if (object->GetObjectType() == Objects::ObjectType::LINE_SEGMENT)
+      {
+         // Line segment coordinates are the start point, so the box spans both ends.
+         const Objects::LineSegmentObject* lineSegment = static_cast<const Objects::LineSegmentObject*>(object);
+         Math::Vector2D<float> startPoint = lineSegment->GetStartPoint();
+         Math::Vector2D<float> endPoint = lineSegment->GetEndPoint();
+         aProxy.minX = std::min(startPoint.GetComponentX(), endPoint.GetComponentX());
+         aProxy.minY = std::min(startPoint.GetComponentY(), endPoint.GetComponentY());
+         aProxy.maxX = std::max(startPoint.GetComponentX(), endPoint.GetComponentX());
+         aProxy.maxY = std::max(startPoint.GetComponentY(), endPoint.GetComponentY());
+      }
+      else if (object->GetObjectType() == Objects::ObjectType::POLYGON)
+      {
+         // Polygon points can lie on any side of the coordinates, so the box spans every point.
+         const Objects::PolygonObject* polygon = static_cast<const Objects::PolygonObject*>(object);
+         aProxy.minX = aProxy.maxX = polygon->GetCoordinateX();
+         aProxy.minY = aProxy.maxY = polygon->GetCoordinateY();
+         for (unsigned int i = 0; i < polygon->GetPointCount(); ++i)
+         {
+            Math::Vector2D<float> point = polygon->GetPoint(i);
+            aProxy.minX = std::min(aProxy.minX, point.GetComponentX());
+            aProxy.minY = std::min(aProxy.minY, point.GetComponentY());
+            aProxy.maxX = std::max(aProxy.maxX, point.GetComponentX());
+            aProxy.maxY = std::max(aProxy.maxY, point.GetComponentY());
+         }
+      }
+      else
+      {
+         // Fall back to the size described by the center points for any other object.
+         aProxy.minX = object->GetCoordinateX();
+         aProxy.minY = object->GetCoordinateY();
+         aProxy.maxX = object->GetCoordinateX() + (object->GetWidthCenterPoint() * 2);
+         aProxy.maxY = object->GetCoordinateY() + (object->GetHeightCenterPoint() * 2);
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: SortProxies
+   //
+   // Description:
+   //    Sorts the proxies by the low edge of their bounding box on the sweep axis and updates the index of each object.
+   //    An insertion sort is used since the order from the previous step is mostly correct, unless many objects were
+   //    added since the last step, an object was removed or the sweep axis changed.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void CollisionWorld::SortProxies()
+   {
+      bool orderChanged = false;
+      if (mFullSortNeeded == true || mAddedSinceStep > COLLISION_WORLD_INSERTION_SORT_LIMIT)
+      {
+         std::sort(mProxies.begin(), mProxies.end(), [](const Proxy& aLeft, const Proxy& aRight)
+         {
+            return aLeft.sweepMin < aRight.sweepMin;
+         });
+         orderChanged = true;
+      }
+      else
+      {
+         for (std::size_t i = 1; i < mProxies.size(); ++i)
+         {
+            Proxy proxy = mProxies[i];
+            std::size_t j = i;
+            while (j > 0 && mProxies[j - 1].sweepMin > proxy.sweepMin)
+            {
+               mProxies[j] = mProxies[j - 1];
+               --j;
+            }
+            mProxies[j] = proxy;
+            orderChanged = orderChanged || j != i;
+         }
+      }
+
+      if (orderChanged == true)
+      {
+         for (std::size_t i = 0; i < mProxies.size(); ++i)
+         {
+            mProxyIndices[mProxies[i].pObject] = i;
+         }
+      }
+
+      mAddedSinceStep = 0;
+      mFullSortNeeded = false;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: NarrowPhase
+   //
+   // Description:
+   //    Checks two objects whose bounding boxes overlap for an actual collision using the collision checker.
+   //    Object types the collision checker has no check for are not reported as colliding.
+   //
+   // Arguments:
+   //    apObjectOne - The first object being checked.
+   //    apObjectTwo - The second object being checked.
+   //
+   // Return:
+   //    True  - The objects collide.
+   //    False - The objects do not collide.
+   //
+   //******************************************************************************************************************
+   bool CollisionWorld::NarrowPhase(Objects::Object* apObjectOne, Objects::Object* apObjectTwo) const
+   {
+      Objects::ObjectType typeOne = apObjectOne->GetObjectType();
+      Objects::ObjectType typeTwo = apObjectTwo->GetObjectType();
+
+      // Line segments and polygons are checked against the other shapes with themselves as the first object.
+      if ((typeOne == Objects::ObjectType::RECTANGLE || typeOne == Objects::ObjectType::CIRCLE) &&
+          (typeTwo == Objects::ObjectType::LINE_SEGMENT || typeTwo == Objects::ObjectType::POLYGON))
+      {
+         return NarrowPhase(apObjectTwo, apObjectOne);
+      }
+
+      if (typeOne == Objects::ObjectType::RECTANGLE && typeTwo == Objects::ObjectType::RECTANGLE)
+      {
+         return RectangleRectangleCollision(static_cast<Objects::RectangleObject*>(apObjectOne),
+                                            static_cast<Objects::RectangleObject*>(apObjectTwo),
+                                            nullptr);
+      }
+      else if (typeOne == Objects::ObjectType::RECTANGLE && typeTwo == Objects::ObjectType::CIRCLE)
+      {
+         return RectangleCircleCollision(static_cast<Objects::RectangleObject*>(apObjectOne),
+                                         static_cast<Objects::CircleObject*>(apObjectTwo));
+      }
+      else if (typeOne == Objects::ObjectType::CIRCLE && typeTwo == Objects::ObjectType::RECTANGLE)
+      {
+         return RectangleCircleCollision(static_cast<Objects::RectangleObject*>(apObjectTwo),
+                                         static_cast<Objects::CircleObject*>(apObjectOne));
+      }
+      else if (typeOne == Objects::ObjectType::CIRCLE && typeTwo == Objects::ObjectType::CIRCLE)
+      {
+         return CircleCircleCollision(static_cast<Objects::CircleObject*>(apObjectOne),
+                                      static_cast<Objects::CircleObject*>(apObjectTwo),
+                                      nullptr);
+      }
+      else if (typeOne == Objects::ObjectType::LINE_SEGMENT)
+      {
+         const Objects::LineSegmentObject* lineSegment = static_cast<Objects::LineSegmentObject*>(apObjectOne);
+         if (typeTwo == Objects::ObjectType::RECTANGLE)
+         {
+            return LineSegmentRectangleCollision(lineSegment, static_cast<Objects::RectangleObject*>(apObjectTwo));
+         }
+         else if (typeTwo == Objects::ObjectType::CIRCLE)
+         {
+            return LineSegmentCircleCollision(lineSegment, static_cast<Objects::CircleObject*>(apObjectTwo));
+         }
+         else if (typeTwo == Objects::ObjectType::LINE_SEGMENT)
+         {
+            return LineLineSegmentCollision(lineSegment->GetStartPoint(),
+                                            lineSegment->GetEndPoint(),
+                                            static_cast<Objects::LineSegmentObject*>(apObjectTwo),
+                                            nullptr);
+         }
+         else if (typeTwo == Objects::ObjectType::POLYGON)
+         {
+            return LinePolygonCollision(lineSegment->GetStartPoint(),
+                                        lineSegment->GetEndPoint(),
+                                        static_cast<Objects::PolygonObject*>(apObjectTwo),
+                                        nullptr);
+         }
+      }
+      else if (typeOne == Objects::ObjectType::POLYGON)
+      {
+         const Objects::PolygonObject* polygon = static_cast<Objects::PolygonObject*>(apObjectOne);
+         if (typeTwo == Objects::ObjectType::RECTANGLE)
+         {
+            return PolygonRectangleCollision(polygon, static_cast<Objects::RectangleObject*>(apObjectTwo));
+         }
+         else if (typeTwo == Objects::ObjectType::CIRCLE)
+         {
+            return PolygonCircleCollision(polygon, static_cast<Objects::CircleObject*>(apObjectTwo));
+         }
+         else if (typeTwo == Objects::ObjectType::LINE_SEGMENT)
+         {
+            return NarrowPhase(apObjectTwo, apObjectOne);
+         }
+         else if (typeTwo == Objects::ObjectType::POLYGON)
+         {
+            return PolygonPolygonCollision(polygon, static_cast<Objects::PolygonObject*>(apObjectTwo));
+         }
+      }
+
+      // There is no narrow phase for other object types, so they are not reported as colliding.
+      return false;
+   }
+
+//*********************************************************************************************************************
+// Private Methods - End
+//*********************************************************************************************************************
+}}
@@ -0,0 +1,287 @@
+//*********************************************************************************************************************
+//
+// File: CollisionWorld.h
+//
+// Description:
+//    This class handles finding all overlapping pairs of registered objects. A sweep-and-prune broadphase keeps the
+//    objects sorted by the low edge of their bounding box along the axis they are most spread out on, so only objects
+//    whose boxes overlap are handed to the narrow-phase checks in the collision checker. Objects usually move a small
+//    amount between steps, so the sorted order is mostly kept and is repaired with an insertion sort.
+//
+//*********************************************************************************************************************
+
+#ifndef CollisionWorld_H
+#define CollisionWorld_H
+
+#include "../../Objects/Object.h"
+#include <vector>
+#include <unordered_map>
+#include <utility>
+
+namespace Bebop { namespace Math
+{
+   class CollisionWorld
+   {
+      //***************************************************************************************************************
+      // Methods - Start
+      //***************************************************************************************************************
+
+      public:
+
+         //************************************************************************************************************
+         //
+         // Method: CollisionWorld
+         //
+         // Description:
+         //    Constructor for the collision world that sets member variables to their default values.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         CollisionWorld();
+
+         //************************************************************************************************************
+         //
+         // Method: ~CollisionWorld
+         //
+         // Description:
+         //    Destructor for the collision world. The registered objects are not owned by the world and are not
+         //    freed.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         ~CollisionWorld();
+
+         //************************************************************************************************************
+         //
+         // Method: AddObject
+         //
+         // Description:
+         //    Registers an object to be checked for collisions. Objects already registered are ignored.
+         //
+         // Arguments:
+         //    apObject - The object being registered.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void AddObject(Objects::Object* apObject);
+
+         //************************************************************************************************************
+         //
+         // Method: RemoveObject
+         //
+         // Description:
+         //    Removes a registered object from the collision world. The last proxy takes the place of the removed
+         //    one, so the sorted order is restored by a full sort on the next step.
+         //
+         // Arguments:
+         //    apObject - The object being removed.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void RemoveObject(Objects::Object* apObject);
+
+         //************************************************************************************************************
+         //
+         // Method: GetObjectCount
+         //
+         // Description:
+         //    Returns the number of objects registered in the collision world.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the number of registered objects.
+         //
+         //************************************************************************************************************
+         unsigned int GetObjectCount() const;
+
+         //************************************************************************************************************
+         //
+         // Method: Step
+         //
+         // Description:
+         //    Refreshes the bounding boxes of every registered object from their current positions, picks the axis
+         //    the objects are most spread out on to sweep along, restores the sorted order, and gathers the pairs of
+         //    objects that collide. The found pairs replace the pairs from the previous step.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void Step();
+
+         //************************************************************************************************************
+         //
+         // Method: GetCollisionPairs
+         //
+         // Description:
+         //    Returns the pairs of objects found to be colliding during the last step. Pairs that refer to an object
+         //    removed since the step are dropped first.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the vector of colliding object pairs.
+         //
+         //************************************************************************************************************
+         const std::vector<std::pair<Objects::Object*, Objects::Object*>>& GetCollisionPairs();
+
+         //************************************************************************************************************
+         //
+         // Method: GetCandidatePairCount
+         //
+         // Description:
+         //    Returns the number of pairs whose bounding boxes overlapped during the last step and were handed to the
+         //    narrow-phase checks.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the number of candidate pairs from the last step.
+         //
+         //************************************************************************************************************
+         unsigned int GetCandidatePairCount() const;
+
+      protected:
+
+         // There are currently no protected methods for this class.
+
+      private:
+
+         // The bounding box of a registered object used by the broadphase, along with the edges of the box on the
+         // sweep axis and whether the object was part of a colliding pair in the last step.
+         struct Proxy
+         {
+            Objects::Object* pObject;
+            float minX;
+            float minY;
+            float maxX;
+            float maxY;
+            float sweepMin;
+            float sweepMax;
+            bool collided;
+         };
+
+         //************************************************************************************************************
+         //
+         // Method: UpdateBounds
+         //
+         // Description:
+         //    Updates the bounding box of a proxy from the current position and size of its object.
+         //
+         // Arguments:
+         //    aProxy - The proxy being updated.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void UpdateBounds(Proxy& aProxy) const;
+
+         //************************************************************************************************************
+         //
+         // Method: SortProxies
+         //
+         // Description:
+         //    Sorts the proxies by the low edge of their bounding box on the sweep axis and updates the index of each
+         //    object. An insertion sort is used since the order from the previous step is mostly correct, unless many
+         //    objects were added since the last step, an object was removed or the sweep axis changed.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void SortProxies();
+
+         //************************************************************************************************************
+         //
+         // Method: NarrowPhase
+         //
+         // Description:
+         //    Checks two objects whose bounding boxes overlap for an actual collision using the collision checker.
+         //    Object types the collision checker has no check for are not reported as colliding.
+         //
+         // Arguments:
+         //    apObjectOne - The first object being checked.
+         //    apObjectTwo - The second object being checked.
+         //
+         // Return:
+         //    True  - The objects collide.
+         //    False - The objects do not collide.
+         //
+         //************************************************************************************************************
+         bool NarrowPhase(Objects::Object* apObjectOne, Objects::Object* apObjectTwo) const;
+
+      //***************************************************************************************************************
+      // Methods - End
+      //***************************************************************************************************************
+
+      //***************************************************************************************************************
+      // Member Variables - Start
+      //***************************************************************************************************************
+
+      public:
+
+         // There are currently no public member variables for this class.
+
+      protected:
+
+         // There are currently no protected member variables for this class.
+
+      private:
+
+         // The proxies of the registered objects sorted by the low edge of their bounding box on the sweep axis.
+         std::vector<Proxy> mProxies;
+
+         // The index of the proxy of each registered object, used to reject duplicate registrations and to find the
+         // proxy of an object being removed.
+         std::unordered_map<Objects::Object*, std::size_t> mProxyIndices;
+
+         // The pairs of objects found to be colliding during the last step.
+         std::vector<std::pair<Objects::Object*, Objects::Object*>> mCollisionPairs;
+
+         // The objects removed since the last step that are part of a colliding pair from that step.
+         std::vector<Objects::Object*> mRemovedCollidedObjects;
+
+         // The number of pairs handed to the narrow phase during the last step.
+         unsigned int mCandidatePairCount;
+
+         // The number of objects added since the last step.
+         unsigned int mAddedSinceStep;
+
+         // Whether the proxies are out of order in a way an insertion sort is slow to repair.
+         bool mFullSortNeeded;
+
+         // Whether the sweep runs along the Y-Axis instead of the X-Axis.
+         bool mSweepAlongY;
+
+      //***************************************************************************************************************
+      // Member Variables - End
+      //***************************************************************************************************************
+   };
+}}
+
+#endif // CollisionWorld_H
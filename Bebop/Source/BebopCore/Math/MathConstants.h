@@ -12,6 +12,7 @@
 
 #define _USE_MATH_DEFINES
 #include <cmath>
+#include <limits>
 
 namespace Bebop { namespace Math
 {
@@ -43,6 +44,29 @@ namespace Bebop { namespace Math
 
    // The minimum size of a collision vector needed to check for collisions.
    const int MINIMUM_COLLISION_VECTOR_SIZE = 2;
+
+   // The number of objects that can be added to a collision world between steps before the broadphase does a full
+   // sort instead of repairing the previous order with an insertion sort.
+   const unsigned int COLLISION_WORLD_INSERTION_SORT_LIMIT = 64;
+
+   // The collision time reported by the batch line checks when a line does not collide. Valid collision times are
+   // between 0.0 (origin of the line) and 1.0 (end of the line).
+   const float NO_COLLISION_TIME = std::numeric_limits<float>::max();
+
+   // The smallest magnitude of a line direction component the slab checks divide by. Lines with smaller components
+   // are treated as running along the box edges on that axis.
+   const float MINIMUM_LINE_DIRECTION = 1.0e-20F;
+
+   // How far the entry time of a slab check may pass the exit time and still count as a collision. Lines that graze
+   // a corner of a box enter and leave it at the same time, which rounding can put either way round.
+   const float LINE_BOX_TIME_TOLERANCE = 1.0e-5F;
+
+   // The most points where the edges of two axis aligned rectangles can cross each other.
+   const unsigned int MAXIMUM_RECTANGLE_CONTACTS = 8;
+
+   // How far in radians the turns around a polygon may add up to away from a full circle for the polygon to still
+   // count as winding around once.
+   const float POLYGON_WINDING_TOLERANCE = 1.0e-3F;
 }}
 
 #endif // MathConstants_H
\ No newline at end of file
@@ -0,0 +1,28 @@
+//*********************************************************************************************************************
+//
+// File: SimdSupport.h
+//
+// Description:
+//    This file detects which SIMD instruction sets are available to the math namespace. Code that has a vector path
+//    checks BEBOP_SIMD_SSE or BEBOP_SIMD_NEON and keeps a scalar path for every other target.
+//
+//*********************************************************************************************************************
+
+#ifndef SimdSupport_H
+#define SimdSupport_H
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+   #define BEBOP_SIMD_SSE
+   #include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+   #define BEBOP_SIMD_NEON
+   #include <arm_neon.h>
+#endif
+
+namespace Bebop { namespace Math
+{
+   // The number of floats processed together by a SIMD lane group.
+   const unsigned int SIMD_LANE_WIDTH = 4;
+}}
+
+#endif // SimdSupport_H
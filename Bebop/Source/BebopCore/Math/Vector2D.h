@@ -12,13 +12,20 @@
 #ifndef Vector2D_H
 #define Vector2D_H
 
+#include "MathConstants.h"
+#include <cmath>
+
 namespace Bebop { namespace Math
 {
    template<class T> class Vector2D;
-   template<class T> Vector2D<T> operator+(Vector2D<T> aLeftVector, const Vector2D<T> aRightVector);
-   template<class T> Vector2D<T> operator-(Vector2D<T> aLeftVector, const Vector2D<T> aRightVector);
-   template<class T> Vector2D<T> operator*(Vector2D<T> aLeftVector, const Vector2D<T> aRightVector);
-   template<class T> Vector2D<T> operator/(Vector2D<T> aLeftVector, const Vector2D<T> aRightVector);
+   template<class T>
+   constexpr Vector2D<T> operator+(const Vector2D<T>& aLeftVector, const Vector2D<T>& aRightVector) noexcept;
+   template<class T>
+   constexpr Vector2D<T> operator-(const Vector2D<T>& aLeftVector, const Vector2D<T>& aRightVector) noexcept;
+   template<class T>
+   constexpr Vector2D<T> operator*(const Vector2D<T>& aLeftVector, const Vector2D<T>& aRightVector) noexcept;
+   template<class T>
+   constexpr Vector2D<T> operator/(const Vector2D<T>& aLeftVector, const Vector2D<T>& aRightVector) noexcept;
 
    template<class T>
    class Vector2D
@@ -34,7 +41,7 @@ namespace Bebop { namespace Math
          // Method: Vector2D
          //
          // Description:
-         //    
+         //    Constructor for a zero length vector.
          //
          // Arguments:
          //    N/A
@@ -43,7 +50,24 @@ namespace Bebop { namespace Math
          //    N/A
          //
          //************************************************************************************************************
-         Vector2D(const T aComponentX, const T aComponentY);
+         constexpr Vector2D() noexcept;
+
+         //************************************************************************************************************
+         //
+         // Method: Vector2D
+         //
+         // Description:
+         //    Constructor for the vector to set member variables to their default values.
+         //
+         // Arguments:
+         //    aComponentX - The X component of the vector.
+         //    aComponentY - The Y component of the vector.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         constexpr Vector2D(const T aComponentX, const T aComponentY) noexcept;
 
          //************************************************************************************************************
          //
@@ -60,7 +84,8 @@ namespace Bebop { namespace Math
          //    Returns the addition of two vectors.
          //
          //************************************************************************************************************
-         friend Vector2D<T> operator+ <>(Vector2D<T> aLeftVector, const Vector2D<T> aRightVector);
+         friend constexpr Vector2D<T> operator+ <>(const Vector2D<T>& aLeftVector,
+                                                   const Vector2D<T>& aRightVector) noexcept;
 
          //************************************************************************************************************
          //
@@ -77,7 +102,8 @@ namespace Bebop { namespace Math
          //    Returns the subtraction of two vectors.
          //
          //************************************************************************************************************
-         friend Vector2D<T> operator- <>(Vector2D<T> aLeftVector, const Vector2D<T> aRightVector);
+         friend constexpr Vector2D<T> operator- <>(const Vector2D<T>& aLeftVector,
+                                                   const Vector2D<T>& aRightVector) noexcept;
 
          //************************************************************************************************************
          //
@@ -94,7 +120,8 @@ namespace Bebop { namespace Math
          //    Returns the multiplication of two vectors.
          //
          //************************************************************************************************************
-         friend Vector2D<T> operator* <>(Vector2D<T> aLeftVector, const Vector2D<T> aRightVector);
+         friend constexpr Vector2D<T> operator* <>(const Vector2D<T>& aLeftVector,
+                                                   const Vector2D<T>& aRightVector) noexcept;
 
          //************************************************************************************************************
          //
@@ -111,7 +138,8 @@ namespace Bebop { namespace Math
          //    Returns the devision of two vectors.
          //
          //************************************************************************************************************
-         friend Vector2D<T> operator/ <>(Vector2D<T> aLeftVector, const Vector2D<T> aRightVector);
+         friend constexpr Vector2D<T> operator/ <>(const Vector2D<T>& aLeftVector,
+                                                   const Vector2D<T>& aRightVector) noexcept;
 
          //************************************************************************************************************
          //
@@ -127,7 +155,7 @@ namespace Bebop { namespace Math
          //    Returns the addition of this vector and the passed in vector.
          //
          //************************************************************************************************************
-         Vector2D<T>& operator+=(const Vector2D<T>& aRightVector);
+         constexpr Vector2D<T>& operator+=(const Vector2D<T>& aRightVector) noexcept;
 
          //************************************************************************************************************
          //
@@ -143,7 +171,7 @@ namespace Bebop { namespace Math
          //    Returns the subtraction of this vector and the passed in vector.
          //
          //************************************************************************************************************
-         Vector2D<T>& operator-=(const Vector2D<T>& aRightVector);
+         constexpr Vector2D<T>& operator-=(const Vector2D<T>& aRightVector) noexcept;
 
          //************************************************************************************************************
          //
@@ -159,7 +187,7 @@ namespace Bebop { namespace Math
          //    Returns the multiplication of this vector and the passed in vector.
          //
          //************************************************************************************************************
-         Vector2D<T>& operator*=(const Vector2D<T>& aRightVector);
+         constexpr Vector2D<T>& operator*=(const Vector2D<T>& aRightVector) noexcept;
 
          //************************************************************************************************************
          //
@@ -175,7 +203,7 @@ namespace Bebop { namespace Math
          //    Returns the division of this vector and the passed in vector.
          //
          //************************************************************************************************************
-         Vector2D<T>& operator/=(const Vector2D<T>& aRightVector);
+         constexpr Vector2D<T>& operator/=(const Vector2D<T>& aRightVector) noexcept;
 
          //************************************************************************************************************
          //
@@ -191,7 +219,7 @@ namespace Bebop { namespace Math
          //    Returns the X component of the vector.
          //
          //************************************************************************************************************
-         T GetComponentX() const;
+         constexpr T GetComponentX() const noexcept;
 
          //************************************************************************************************************
          //
@@ -207,7 +235,7 @@ namespace Bebop { namespace Math
          //    N/A
          //
          //************************************************************************************************************
-         void SetComponentX(const T aComponentX);
+         constexpr void SetComponentX(const T aComponentX) noexcept;
 
          //************************************************************************************************************
          //
@@ -223,7 +251,7 @@ namespace Bebop { namespace Math
          //    Returns the Y component of the vector.
          //
          //************************************************************************************************************
-         T GetComponentY() const;
+         constexpr T GetComponentY() const noexcept;
 
          //************************************************************************************************************
          //
@@ -239,7 +267,24 @@ namespace Bebop { namespace Math
          //    N/A
          //
          //************************************************************************************************************
-         void SetComponentY(const T aComponentY);
+         constexpr void SetComponentY(const T aComponentY) noexcept;
+
+         //************************************************************************************************************
+         //
+         // Method: GetMagnitudeSquared
+         //
+         // Description:
+         //    Returns the squared magnitude of the vector. x^2 + y^2 = m^2. This avoids the square root and should be
+         //    used when the magnitude is only compared against another magnitude.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the squared magnitude of the vector.
+         //
+         //************************************************************************************************************
+         constexpr T GetMagnitudeSquared() const noexcept;
 
          //************************************************************************************************************
          //
@@ -263,13 +308,13 @@ namespace Bebop { namespace Math
          //
          // Description:
          //    Returns the normalized x and y values of the vector. The normalized values of these is the assumption
-         //    that magnitude is of length 1.0 pixel.
+         //    that magnitude is of length 1.0 pixel. A zero length vector has no direction and is returned as is.
          //
          // Arguments:
          //    N/A
          //
          // Return:
-         //    N/A
+         //    Returns the vector with a magnitude of 1.0, or a zero vector if this vector has no length.
          //
          //************************************************************************************************************
          Vector2D<T> GetNormalized() const;
@@ -285,80 +330,84 @@ namespace Bebop { namespace Math
          //    aOther - The vector being used for the dot product against this vector
          //
          // Return:
-         //    Returns a float of the dot product of this vector against another vector.
+         //    Returns the dot product of this vector against another vector.
          //
          //************************************************************************************************************
-         float Dot(const Vector2D<T> aOther);
-
-      protected:
-
-         // There are currently no protected methods for this class.
-
-      private:
+         constexpr T Dot(const Vector2D<T>& aOther) const noexcept;
 
          //************************************************************************************************************
          //
-         // Method: Add
+         // Method: Cross
          //
          // Description:
-         //    Returns the vector value when this vector is added with another. 
+         //    Returns the cross product using the passed in vector. This is the Z component of the 3D cross product and
+         //    is positive when the other vector is clockwise from this vector on screen.
          //
          // Arguments:
-         //    aVector - The second vector that is added to this vector.
+         //    aOther - The vector being used for the cross product against this vector.
          //
          // Return:
-         //    Returns the vector of the added vectors.
+         //    Returns the cross product of this vector against another vector.
          //
          //************************************************************************************************************
-         Vector2D<T>& Add(const Vector2D<T>& aVector);
+         constexpr T Cross(const Vector2D<T>& aOther) const noexcept;
 
          //************************************************************************************************************
          //
-         // Method: Subtract
+         // Method: GetPerpendicular
          //
          // Description:
-         //    Returns the vector value when this vector is subtracted with another.   
+         //    Returns the vector rotated 90 degrees clockwise on screen.
          //
          // Arguments:
-         //    aVector - The second vector that is subtracted to this vector.
+         //    N/A
          //
          // Return:
-         //    Returns the vector of the subtracted vectors.
+         //    Returns the perpendicular vector.
          //
          //************************************************************************************************************
-         Vector2D<T>& Subtract(const Vector2D<T>& aVector);
+         constexpr Vector2D<T> GetPerpendicular() const noexcept;
 
          //************************************************************************************************************
          //
-         // Method: Multiply
+         // Method: Lerp
          //
          // Description:
-         //    Returns the vector value when this vector is multiplied with another.
+         //    Returns the vector linearly interpolated between this vector and the passed in vector.
          //
          // Arguments:
-         //    aVector - The second vector that is multiplied to this vector.
+         //    aTarget - The vector being interpolated towards.
+         //    aAmount - The amount to interpolate where 0.0 is this vector and 1.0 is the target vector.
          //
          // Return:
-         //    Returns the vector of the multiplied vectors.
+         //    Returns the interpolated vector.
          //
          //************************************************************************************************************
-         Vector2D<T>& Multiply(const Vector2D<T>& aVector);
+         constexpr Vector2D<T> Lerp(const Vector2D<T>& aTarget, const T aAmount) const noexcept;
 
          //************************************************************************************************************
          //
-         // Method: Divide
+         // Method: GetRotated
          //
          // Description:
-         //    Returns the vector value when this vector is divided with another.
+         //    Returns the vector rotated clockwise on screen by the passed in angle.
          //
          // Arguments:
-         //    aVector - The second vector that is divided to this vector.
+         //    aRotation - The rotation in degrees.
          //
          // Return:
-         //    Returns the vector of the divided vectors.
+         //    Returns the rotated vector.
          //
          //************************************************************************************************************
-         Vector2D<T>& Divide(const Vector2D<T>& aVector);
+         Vector2D<T> GetRotated(const float aRotation) const noexcept;
+
+      protected:
+
+         // There are currently no protected methods for this class.
+
+      private:
+
+         // There are currently no private methods for this class.
 
    //******************************************************************************************************************
    // Methods - End
@@ -378,8 +427,10 @@ namespace Bebop { namespace Math
 
       private:
 
+         // The X component of the vector.
          T mComponentX;
 
+         // The Y component of the vector.
          T mComponentY;
 
    //******************************************************************************************************************
@@ -391,6 +442,26 @@ namespace Bebop { namespace Math
 // Public Methods - Start
 //*********************************************************************************************************************
 
+   //******************************************************************************************************************
+   //
+   // Method: Vector2D
+   //
+   // Description:
+   //    Constructor for a zero length vector.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   template<class T>
+   constexpr Vector2D<T>::Vector2D() noexcept :
+      mComponentX(0), mComponentY(0)
+   {
+   }
+
    //******************************************************************************************************************
    //
    // Method: Vector2D
@@ -407,7 +478,7 @@ namespace Bebop { namespace Math
    //
    //******************************************************************************************************************
    template<class T>
-   Vector2D<T>::Vector2D(const T aComponentX, const T aComponentY) :
+   constexpr Vector2D<T>::Vector2D(const T aComponentX, const T aComponentY) noexcept :
       mComponentX(aComponentX), mComponentY(aComponentY)
    {
    }
@@ -428,9 +499,10 @@ namespace Bebop { namespace Math
    //
    //******************************************************************************************************************
    template<class T>
-   Vector2D<T> operator+(Vector2D<T> aLeftVector, const Vector2D<T> aRightVector)
+   constexpr Vector2D<T> operator+(const Vector2D<T>& aLeftVector, const Vector2D<T>& aRightVector) noexcept
    {
-      return aLeftVector.Add(aRightVector);
+      return Vector2D<T>(aLeftVector.mComponentX + aRightVector.mComponentX,
+                         aLeftVector.mComponentY + aRightVector.mComponentY);
    }
 
    //******************************************************************************************************************
@@ -449,9 +521,10 @@ namespace Bebop { namespace Math
    //
    //******************************************************************************************************************
    template<class T>
-   Vector2D<T> operator-(Vector2D<T> aLeftVector, const Vector2D<T> aRightVector)
+   constexpr Vector2D<T> operator-(const Vector2D<T>& aLeftVector, const Vector2D<T>& aRightVector) noexcept
    {
-      return aLeftVector.Subtract(aRightVector);
+      return Vector2D<T>(aLeftVector.mComponentX - aRightVector.mComponentX,
+                         aLeftVector.mComponentY - aRightVector.mComponentY);
    }
 
    //******************************************************************************************************************
@@ -470,9 +543,10 @@ namespace Bebop { namespace Math
    //
    //******************************************************************************************************************
    template<class T>
-   Vector2D<T> operator*(Vector2D<T> aLeftVector, const Vector2D<T> aRightVector)
+   constexpr Vector2D<T> operator*(const Vector2D<T>& aLeftVector, const Vector2D<T>& aRightVector) noexcept
    {
-      return aLeftVector.Multiply(aRightVector);
+      return Vector2D<T>(aLeftVector.mComponentX * aRightVector.mComponentX,
+                         aLeftVector.mComponentY * aRightVector.mComponentY);
    }
 
    //******************************************************************************************************************
@@ -491,9 +565,10 @@ namespace Bebop { namespace Math
    //
    //******************************************************************************************************************
    template<class T>
-   Vector2D<T> operator/(Vector2D<T> aLeftVector, const Vector2D<T> aRightVector)
+   constexpr Vector2D<T> operator/(const Vector2D<T>& aLeftVector, const Vector2D<T>& aRightVector) noexcept
    {
-      return aLeftVector.Divide(aRightVector);
+      return Vector2D<T>(aLeftVector.mComponentX / aRightVector.mComponentX,
+                         aLeftVector.mComponentY / aRightVector.mComponentY);
    }
 
    //******************************************************************************************************************
@@ -511,9 +586,12 @@ namespace Bebop { namespace Math
    //
    //******************************************************************************************************************
    template<class T>
-   Vector2D<T>& Vector2D<T>::operator+=(const Vector2D<T>& aRightVector)
+   constexpr Vector2D<T>& Vector2D<T>::operator+=(const Vector2D<T>& aRightVector) noexcept
    {
-      return Add(aRightVector);
+      mComponentX += aRightVector.mComponentX;
+      mComponentY += aRightVector.mComponentY;
+
+      return *this;
    }
 
    //******************************************************************************************************************
@@ -531,9 +609,12 @@ namespace Bebop { namespace Math
    //
    //******************************************************************************************************************
    template<class T>
-   Vector2D<T>& Vector2D<T>::operator-=(const Vector2D<T>& aRightVector)
+   constexpr Vector2D<T>& Vector2D<T>::operator-=(const Vector2D<T>& aRightVector) noexcept
    {
-      return Subtract(aRightVector);
+      mComponentX -= aRightVector.mComponentX;
+      mComponentY -= aRightVector.mComponentY;
+
+      return *this;
    }
 
    //******************************************************************************************************************
@@ -551,9 +632,12 @@ namespace Bebop { namespace Math
    //
    //******************************************************************************************************************
    template<class T>
-   Vector2D<T>& Vector2D<T>::operator*=(const Vector2D<T>& aRightVector)
+   constexpr Vector2D<T>& Vector2D<T>::operator*=(const Vector2D<T>& aRightVector) noexcept
    {
-      return Multiply(aRightVector);
+      mComponentX *= aRightVector.mComponentX;
+      mComponentY *= aRightVector.mComponentY;
+
+      return *this;
    }
 
    //******************************************************************************************************************
@@ -571,9 +655,12 @@ namespace Bebop { namespace Math
    //
    //******************************************************************************************************************
    template<class T>
-   Vector2D<T>& Vector2D<T>::operator/=(const Vector2D<T>& aRightVector)
+   constexpr Vector2D<T>& Vector2D<T>::operator/=(const Vector2D<T>& aRightVector) noexcept
    {
-      return Divide(aRightVector);
+      mComponentX /= aRightVector.mComponentX;
+      mComponentY /= aRightVector.mComponentY;
+
+      return *this;
    }
 
    //******************************************************************************************************************
@@ -591,7 +678,7 @@ namespace Bebop { namespace Math
    //
    //******************************************************************************************************************
    template<class T>
-   T Vector2D<T>::GetComponentX() const
+   constexpr T Vector2D<T>::GetComponentX() const noexcept
    {
       return mComponentX;
    }
@@ -611,7 +698,7 @@ namespace Bebop { namespace Math
    //
    //******************************************************************************************************************
    template<class T>
-   void Vector2D<T>::SetComponentX(const T aComponentX)
+   constexpr void Vector2D<T>::SetComponentX(const T aComponentX) noexcept
    {
       mComponentX = aComponentX;
    }
@@ -631,7 +718,7 @@ namespace Bebop { namespace Math
    //
    //******************************************************************************************************************
    template<class T>
-   T Vector2D<T>::GetComponentY() const
+   constexpr T Vector2D<T>::GetComponentY() const noexcept
    {
       return mComponentY;
    }
@@ -651,11 +738,32 @@ namespace Bebop { namespace Math
    //
    //******************************************************************************************************************
    template<class T>
-   void Vector2D<T>::SetComponentY(const T aComponentY)
+   constexpr void Vector2D<T>::SetComponentY(const T aComponentY) noexcept
    {
       mComponentY = aComponentY;
    }
 
+   //******************************************************************************************************************
+   //
+   // Method: GetMagnitudeSquared
+   //
+   // Description:
+   //    Returns the squared magnitude of the vector. x^2 + y^2 = m^2. This avoids the square root and should be used
+   //    when the magnitude is only compared against another magnitude.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the squared magnitude of the vector.
+   //
+   //******************************************************************************************************************
+   template<class T>
+   constexpr T Vector2D<T>::GetMagnitudeSquared() const noexcept
+   {
+      return (mComponentX * mComponentX) + (mComponentY * mComponentY);
+   }
+
    //******************************************************************************************************************
    //
    // Method: GetMagnitude
@@ -673,7 +781,7 @@ namespace Bebop { namespace Math
    template<class T>
    T Vector2D<T>::GetMagnitude() const
    {
-      return sqrtf((mComponentX * mComponentX) + (mComponentY * mComponentY));
+      return static_cast<T>(sqrtf(static_cast<float>(GetMagnitudeSquared())));
    }
 
    //******************************************************************************************************************
@@ -682,20 +790,25 @@ namespace Bebop { namespace Math
    //
    // Description:
    //    Returns the normalized x and y values of the vector. The normalized values of these is the assumption that
-   //    magnitude is of length 1.0 pixel.
+   //    magnitude is of length 1.0 pixel. A zero length vector has no direction and is returned as is.
    //
    // Arguments:
    //    N/A
    //
    // Return:
-   //    N/A
+   //    Returns the vector with a magnitude of 1.0, or a zero vector if this vector has no length.
    //
    //******************************************************************************************************************
    template<class T>
    Vector2D<T> Vector2D<T>::GetNormalized() const
    {
-      float length = GetMagnitude();
-      return Vector2D(mComponentX / length, mComponentY / length);
+      float length = sqrtf(static_cast<float>(GetMagnitudeSquared()));
+      if (length == 0.0F)
+      {
+         return Vector2D<T>();
+      }
+
+      return Vector2D<T>(static_cast<T>(mComponentX / length), static_cast<T>(mComponentY / length));
    }
 
    //******************************************************************************************************************
@@ -709,125 +822,122 @@ namespace Bebop { namespace Math
    //    aOther - The vector being used for the dot product against this vector
    //
    // Return:
-   //    Returns a float of the dot product of this vector against another vector.
+   //    Returns the dot product of this vector against another vector.
    //
    //******************************************************************************************************************
    template<class T>
-   float Vector2D<T>::Dot(const Vector2D<T> aOther)
+   constexpr T Vector2D<T>::Dot(const Vector2D<T>& aOther) const noexcept
    {
-      return mComponentX * aOther.GetComponentX() + mComponentY * aOther.GetComponentY();
+      return (mComponentX * aOther.mComponentX) + (mComponentY * aOther.mComponentY);
    }
 
-//*********************************************************************************************************************
-// Public Methods - End
-//*********************************************************************************************************************
-
-//*********************************************************************************************************************
-// Protected Methods - Start
-//*********************************************************************************************************************
-
-   // There are currently no protected methods for this class.
-
-//*********************************************************************************************************************
-// Protected Methods - End
-//*********************************************************************************************************************
-
-//*********************************************************************************************************************
-// Private Methods - Start
-//*********************************************************************************************************************
-
    //******************************************************************************************************************
    //
-   // Method: Add
+   // Method: Cross
    //
    // Description:
-   //    Returns the vector value when this vector is added with another. 
+   //    Returns the cross product using the passed in vector. This is the Z component of the 3D cross product and is
+   //    positive when the other vector is clockwise from this vector on screen.
    //
    // Arguments:
-   //    aVector - The second vector that is added to this vector.
+   //    aOther - The vector being used for the cross product against this vector.
    //
    // Return:
-   //    Returns the vector of the added vectors.
+   //    Returns the cross product of this vector against another vector.
    //
    //******************************************************************************************************************
    template<class T>
-   Vector2D<T>& Vector2D<T>::Add(const Vector2D<T>& aVector)
+   constexpr T Vector2D<T>::Cross(const Vector2D<T>& aOther) const noexcept
    {
-      mComponentX += aVector.mComponentX;
-      mComponentY += aVector.mComponentY;
-
-      return *this;
+      return (mComponentX * aOther.mComponentY) - (mComponentY * aOther.mComponentX);
    }
 
    //******************************************************************************************************************
    //
-   // Method: Subtract
+   // Method: GetPerpendicular
    //
    // Description:
-   //    Returns the vector value when this vector is subtracted with another.   
+   //    Returns the vector rotated 90 degrees clockwise on screen.
    //
    // Arguments:
-   //    aVector - The second vector that is subtracted to this vector.
+   //    N/A
    //
    // Return:
-   //    Returns the vector of the subtracted vectors.
+   //    Returns the perpendicular vector.
    //
    //******************************************************************************************************************
    template<class T>
-   Vector2D<T>& Vector2D<T>::Subtract(const Vector2D<T>& aVector)
+   constexpr Vector2D<T> Vector2D<T>::GetPerpendicular() const noexcept
    {
-      mComponentX -= aVector.mComponentX;
-      mComponentY -= aVector.mComponentY;
-
-      return *this;
+      return Vector2D<T>(-mComponentY, mComponentX);
    }
 
    //******************************************************************************************************************
    //
-   // Method: Multiply
+   // Method: Lerp
    //
    // Description:
-   //    Returns the vector value when this vector is multiplied with another.
+   //    Returns the vector linearly interpolated between this vector and the passed in vector.
    //
    // Arguments:
-   //    aVector - The second vector that is multiplied to this vector.
+   //    aTarget - The vector being interpolated towards.
+   //    aAmount - The amount to interpolate where 0.0 is this vector and 1.0 is the target vector.
    //
    // Return:
-   //    Returns the vector of the multiplied vectors.
+   //    Returns the interpolated vector.
    //
    //******************************************************************************************************************
    template<class T>
-   Vector2D<T>& Vector2D<T>::Multiply(const Vector2D<T>& aVector)
+   constexpr Vector2D<T> Vector2D<T>::Lerp(const Vector2D<T>& aTarget, const T aAmount) const noexcept
    {
-      mComponentX *= aVector.mComponentX;
-      mComponentY *= aVector.mComponentY;
-
-      return *this;
+      return Vector2D<T>(mComponentX + (aTarget.mComponentX - mComponentX) * aAmount,
+                         mComponentY + (aTarget.mComponentY - mComponentY) * aAmount);
    }
 
    //******************************************************************************************************************
    //
-   // Method: Divide
+   // Method: GetRotated
    //
    // Description:
-   //    Returns the vector value when this vector is divided with another.
+   //    Returns the vector rotated clockwise on screen by the passed in angle.
    //
    // Arguments:
-   //    aVector - The second vector that is divided to this vector.
+   //    aRotation - The rotation in degrees.
    //
    // Return:
-   //    Returns the vector of the divided vectors.
+   //    Returns the rotated vector.
    //
    //******************************************************************************************************************
    template<class T>
-   Vector2D<T>& Vector2D<T>::Divide(const Vector2D<T>& aVector)
+   Vector2D<T> Vector2D<T>::GetRotated(const float aRotation) const noexcept
    {
-      mComponentX /= aVector.mComponentX;
-      mComponentY /= aVector.mComponentY;
+      float cosine = cosf(aRotation * RADIANS_CONVERSION);
+      float sine = sinf(aRotation * RADIANS_CONVERSION);
 
-      return *this;
+      return Vector2D<T>(static_cast<T>(mComponentX * cosine - mComponentY * sine),
+                         static_cast<T>(mComponentX * sine + mComponentY * cosine));
    }
 
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no private methods for this class.
+
 //*********************************************************************************************************************
 // Private Methods - End
 //*********************************************************************************************************************
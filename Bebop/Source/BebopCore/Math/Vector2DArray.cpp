@@ -0,0 +1,486 @@
+//*********************************************************************************************************************
+//
+// File: Vector2DArray.cpp
+//
+// Description:
+//    This class stores many 2D vectors with the X components and the Y components in separate arrays. Keeping the
+//    components apart lets the bulk operations work on several vectors at once using SIMD lanes, which is useful for
+//    large groups of positions or velocities such as particles. Batch checks such as the collision checks of the rays
+//    swept by a light read the component arrays directly.
+//
+//*********************************************************************************************************************
+
+#include "Vector2DArray.h"
+#include "SimdSupport.h"
+
+namespace Bebop { namespace Math
+{
+//*********************************************************************************************************************
+// Public Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method: Vector2DArray
+   //
+   // Description:
+   //    Constructor for an empty array of vectors.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   Vector2DArray::Vector2DArray()
+   {
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: ~Vector2DArray
+   //
+   // Description:
+   //    Destructor for the array of vectors.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   Vector2DArray::~Vector2DArray()
+   {
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AddVector
+   //
+   // Description:
+   //    Adds a vector to the end of the array.
+   //
+   // Arguments:
+   //    aVector - The vector being added.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void Vector2DArray::AddVector(const Vector2D<float>& aVector)
+   {
+      mComponentsX.push_back(aVector.GetComponentX());
+      mComponentsY.push_back(aVector.GetComponentY());
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetVector
+   //
+   // Description:
+   //    Returns the vector stored at the passed in index.
+   //
+   // Arguments:
+   //    aIndex - The index of the vector.
+   //
+   // Return:
+   //    Returns the vector at the index.
+   //
+   //******************************************************************************************************************
+   Vector2D<float> Vector2DArray::GetVector(const unsigned int aIndex) const
+   {
+      return Vector2D<float>(mComponentsX[aIndex], mComponentsY[aIndex]);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: SetVector
+   //
+   // Description:
+   //    Updates the vector stored at the passed in index.
+   //
+   // Arguments:
+   //    aIndex  - The index of the vector.
+   //    aVector - The new value of the vector.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void Vector2DArray::SetVector(const unsigned int aIndex, const Vector2D<float>& aVector)
+   {
+      mComponentsX[aIndex] = aVector.GetComponentX();
+      mComponentsY[aIndex] = aVector.GetComponentY();
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetSize
+   //
+   // Description:
+   //    Returns the number of vectors in the array.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the number of vectors.
+   //
+   //******************************************************************************************************************
+   unsigned int Vector2DArray::GetSize() const
+   {
+      return static_cast<unsigned int>(mComponentsX.size());
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: Resize
+   //
+   // Description:
+   //    Changes the number of vectors in the array. New vectors are zero length.
+   //
+   // Arguments:
+   //    aSize - The new number of vectors.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void Vector2DArray::Resize(const unsigned int aSize)
+   {
+      mComponentsX.resize(aSize, 0.0F);
+      mComponentsY.resize(aSize, 0.0F);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: Clear
+   //
+   // Description:
+   //    Removes all vectors from the array.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void Vector2DArray::Clear()
+   {
+      mComponentsX.clear();
+      mComponentsY.clear();
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetComponentsX
+   //
+   // Description:
+   //    Returns the array of X components so the vectors can be passed to the batch collision checks.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns a pointer to the first X component.
+   //
+   //******************************************************************************************************************
+   const float* Vector2DArray::GetComponentsX() const
+   {
+      return mComponentsX.data();
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: GetComponentsY
+   //
+   // Description:
+   //    Returns the array of Y components so the vectors can be passed to the batch collision checks.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns a pointer to the first Y component.
+   //
+   //******************************************************************************************************************
+   const float* Vector2DArray::GetComponentsY() const
+   {
+      return mComponentsY.data();
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AddArray
+   //
+   // Description:
+   //    Adds each vector of the passed in array to the vector at the same index of this array.
+   //
+   // Arguments:
+   //    aOther - The array being added to this array.
+   //
+   // Return:
+   //    True  - The arrays were added.
+   //    False - The arrays are not the same size and nothing was changed.
+   //
+   //******************************************************************************************************************
+   bool Vector2DArray::AddArray(const Vector2DArray& aOther)
+   {
+      return AddScaledArray(aOther, 1.0F);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AddScaledArray
+   //
+   // Description:
+   //    Adds each vector of the passed in array multiplied by a scale to the vector at the same index of this array.
+   //    This is the usual way to move positions by velocities over an elapsed time.
+   //
+   // Arguments:
+   //    aOther - The array being added to this array.
+   //    aScale - The amount each vector of the other array is multiplied by before being added.
+   //
+   // Return:
+   //    True  - The arrays were added.
+   //    False - The arrays are not the same size and nothing was changed.
+   //
+   //******************************************************************************************************************
+   bool Vector2DArray::AddScaledArray(const Vector2DArray& aOther, const float aScale)
+   {
+      if (aOther.GetSize() != GetSize())
+      {
+         return false;
+      }
+
+      const unsigned int size = GetSize();
+      float* pX = mComponentsX.data();
+      float* pY = mComponentsY.data();
+      const float* pOtherX = aOther.mComponentsX.data();
+      const float* pOtherY = aOther.mComponentsY.data();
+      unsigned int index = 0;
+
+#if defined(BEBOP_SIMD_SSE)
+      const __m128 scale = _mm_set1_ps(aScale);
+      for (; index + SIMD_LANE_WIDTH <= size; index += SIMD_LANE_WIDTH)
+      {
+         _mm_storeu_ps(pX + index, _mm_add_ps(_mm_loadu_ps(pX + index),
+                                              _mm_mul_ps(_mm_loadu_ps(pOtherX + index), scale)));
+         _mm_storeu_ps(pY + index, _mm_add_ps(_mm_loadu_ps(pY + index),
+                                              _mm_mul_ps(_mm_loadu_ps(pOtherY + index), scale)));
+      }
+#elif defined(BEBOP_SIMD_NEON)
+      for (; index + SIMD_LANE_WIDTH <= size; index += SIMD_LANE_WIDTH)
+      {
+         vst1q_f32(pX + index, vmlaq_n_f32(vld1q_f32(pX + index), vld1q_f32(pOtherX + index), aScale));
+         vst1q_f32(pY + index, vmlaq_n_f32(vld1q_f32(pY + index), vld1q_f32(pOtherY + index), aScale));
+      }
+#endif
+
+      for (; index < size; ++index)
+      {
+         pX[index] += pOtherX[index] * aScale;
+         pY[index] += pOtherY[index] * aScale;
+      }
+
+      return true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: Scale
+   //
+   // Description:
+   //    Multiplies every vector in the array by a scale.
+   //
+   // Arguments:
+   //    aScale - The amount each vector is multiplied by.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void Vector2DArray::Scale(const float aScale)
+   {
+      const unsigned int size = GetSize();
+      float* pX = mComponentsX.data();
+      float* pY = mComponentsY.data();
+      unsigned int index = 0;
+
+#if defined(BEBOP_SIMD_SSE)
+      const __m128 scale = _mm_set1_ps(aScale);
+      for (; index + SIMD_LANE_WIDTH <= size; index += SIMD_LANE_WIDTH)
+      {
+         _mm_storeu_ps(pX + index, _mm_mul_ps(_mm_loadu_ps(pX + index), scale));
+         _mm_storeu_ps(pY + index, _mm_mul_ps(_mm_loadu_ps(pY + index), scale));
+      }
+#elif defined(BEBOP_SIMD_NEON)
+      for (; index + SIMD_LANE_WIDTH <= size; index += SIMD_LANE_WIDTH)
+      {
+         vst1q_f32(pX + index, vmulq_n_f32(vld1q_f32(pX + index), aScale));
+         vst1q_f32(pY + index, vmulq_n_f32(vld1q_f32(pY + index), aScale));
+      }
+#endif
+
+      for (; index < size; ++index)
+      {
+         pX[index] *= aScale;
+         pY[index] *= aScale;
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: Dot
+   //
+   // Description:
+   //    Finds the dot product of each vector in this array against the vector at the same index of the passed in
+   //    array.
+   //
+   // Arguments:
+   //    aOther    - The array being used for the dot products against this array.
+   //    apResults - Array of GetSize() values updated with the dot product of each pair of vectors.
+   //
+   // Return:
+   //    True  - The dot products were found.
+   //    False - The arrays are not the same size and no results were written.
+   //
+   //******************************************************************************************************************
+   bool Vector2DArray::Dot(const Vector2DArray& aOther, float* apResults) const
+   {
+      if (aOther.GetSize() != GetSize())
+      {
+         return false;
+      }
+
+      const unsigned int size = GetSize();
+      const float* pX = mComponentsX.data();
+      const float* pY = mComponentsY.data();
+      const float* pOtherX = aOther.mComponentsX.data();
+      const float* pOtherY = aOther.mComponentsY.data();
+      unsigned int index = 0;
+
+#if defined(BEBOP_SIMD_SSE)
+      for (; index + SIMD_LANE_WIDTH <= size; index += SIMD_LANE_WIDTH)
+      {
+         _mm_storeu_ps(apResults + index, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(pX + index),
+                                                                _mm_loadu_ps(pOtherX + index)),
+                                                     _mm_mul_ps(_mm_loadu_ps(pY + index),
+                                                                _mm_loadu_ps(pOtherY + index))));
+      }
+#elif defined(BEBOP_SIMD_NEON)
+      for (; index + SIMD_LANE_WIDTH <= size; index += SIMD_LANE_WIDTH)
+      {
+         vst1q_f32(apResults + index, vmlaq_f32(vmulq_f32(vld1q_f32(pX + index), vld1q_f32(pOtherX + index)),
+                                                vld1q_f32(pY + index), vld1q_f32(pOtherY + index)));
+      }
+#endif
+
+      for (; index < size; ++index)
+      {
+         apResults[index] = (pX[index] * pOtherX[index]) + (pY[index] * pOtherY[index]);
+      }
+
+      return true;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: Normalize
+   //
+   // Description:
+   //    Changes every vector in the array to have a magnitude of 1.0. Zero length vectors have no direction and are
+   //    left as is.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void Vector2DArray::Normalize()
+   {
+      const unsigned int size = GetSize();
+      float* pX = mComponentsX.data();
+      float* pY = mComponentsY.data();
+      unsigned int index = 0;
+
+#if defined(BEBOP_SIMD_SSE)
+      const __m128 zero = _mm_setzero_ps();
+      const __m128 one = _mm_set1_ps(1.0F);
+      for (; index + SIMD_LANE_WIDTH <= size; index += SIMD_LANE_WIDTH)
+      {
+         __m128 x = _mm_loadu_ps(pX + index);
+         __m128 y = _mm_loadu_ps(pY + index);
+         __m128 lengthSquared = _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y));
+         __m128 inverseLength = _mm_div_ps(one, _mm_sqrt_ps(lengthSquared));
+
+         // Only lanes with a length are changed so zero length vectors are left as is.
+         __m128 hasLength = _mm_cmpgt_ps(lengthSquared, zero);
+         _mm_storeu_ps(pX + index, _mm_or_ps(_mm_and_ps(hasLength, _mm_mul_ps(x, inverseLength)),
+                                             _mm_andnot_ps(hasLength, x)));
+         _mm_storeu_ps(pY + index, _mm_or_ps(_mm_and_ps(hasLength, _mm_mul_ps(y, inverseLength)),
+                                             _mm_andnot_ps(hasLength, y)));
+      }
+#elif defined(BEBOP_SIMD_NEON)
+      const float32x4_t zero = vdupq_n_f32(0.0F);
+      for (; index + SIMD_LANE_WIDTH <= size; index += SIMD_LANE_WIDTH)
+      {
+         float32x4_t x = vld1q_f32(pX + index);
+         float32x4_t y = vld1q_f32(pY + index);
+         float32x4_t lengthSquared = vmlaq_f32(vmulq_f32(x, x), y, y);
+
+         // Refine the reciprocal square root estimate twice to get close to full float precision.
+         float32x4_t inverseLength = vrsqrteq_f32(lengthSquared);
+         inverseLength = vmulq_f32(inverseLength,
+                                   vrsqrtsq_f32(vmulq_f32(lengthSquared, inverseLength), inverseLength));
+         inverseLength = vmulq_f32(inverseLength,
+                                   vrsqrtsq_f32(vmulq_f32(lengthSquared, inverseLength), inverseLength));
+
+         // Only lanes with a length are changed so zero length vectors are left as is.
+         uint32x4_t hasLength = vcgtq_f32(lengthSquared, zero);
+         vst1q_f32(pX + index, vbslq_f32(hasLength, vmulq_f32(x, inverseLength), x));
+         vst1q_f32(pY + index, vbslq_f32(hasLength, vmulq_f32(y, inverseLength), y));
+      }
+#endif
+
+      for (; index < size; ++index)
+      {
+         float lengthSquared = (pX[index] * pX[index]) + (pY[index] * pY[index]);
+         if (lengthSquared > 0.0F)
+         {
+            float inverseLength = 1.0F / sqrtf(lengthSquared);
+            pX[index] *= inverseLength;
+            pY[index] *= inverseLength;
+         }
+      }
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no private methods for this class.
+
+//*********************************************************************************************************************
+// Private Methods - End
+//*********************************************************************************************************************
+}}
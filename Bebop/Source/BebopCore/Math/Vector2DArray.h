@@ -0,0 +1,316 @@
+//*********************************************************************************************************************
+//
+// File: Vector2DArray.h
+//
+// Description:
+//    This class stores many 2D vectors with the X components and the Y components in separate arrays. Keeping the
+//    components apart lets the bulk operations work on several vectors at once using SIMD lanes, which is useful for
+//    large groups of positions or velocities such as particles. Batch checks such as the collision checks of the rays
+//    swept by a light read the component arrays directly.
+//
+//*********************************************************************************************************************
+
+#ifndef Vector2DArray_H
+#define Vector2DArray_H
+
+#include "Vector2D.h"
+#include <vector>
+
+namespace Bebop { namespace Math
+{
+   class Vector2DArray
+   {
+   //******************************************************************************************************************
+   // Methods - Start
+   //******************************************************************************************************************
+
+      public:
+
+         //************************************************************************************************************
+         //
+         // Method: Vector2DArray
+         //
+         // Description:
+         //    Constructor for an empty array of vectors.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         Vector2DArray();
+
+         //************************************************************************************************************
+         //
+         // Method: ~Vector2DArray
+         //
+         // Description:
+         //    Destructor for the array of vectors.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         ~Vector2DArray();
+
+         //************************************************************************************************************
+         //
+         // Method: AddVector
+         //
+         // Description:
+         //    Adds a vector to the end of the array.
+         //
+         // Arguments:
+         //    aVector - The vector being added.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void AddVector(const Vector2D<float>& aVector);
+
+         //************************************************************************************************************
+         //
+         // Method: GetVector
+         //
+         // Description:
+         //    Returns the vector stored at the passed in index.
+         //
+         // Arguments:
+         //    aIndex - The index of the vector.
+         //
+         // Return:
+         //    Returns the vector at the index.
+         //
+         //************************************************************************************************************
+         Vector2D<float> GetVector(const unsigned int aIndex) const;
+
+         //************************************************************************************************************
+         //
+         // Method: SetVector
+         //
+         // Description:
+         //    Updates the vector stored at the passed in index.
+         //
+         // Arguments:
+         //    aIndex  - The index of the vector.
+         //    aVector - The new value of the vector.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void SetVector(const unsigned int aIndex, const Vector2D<float>& aVector);
+
+         //************************************************************************************************************
+         //
+         // Method: GetSize
+         //
+         // Description:
+         //    Returns the number of vectors in the array.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the number of vectors.
+         //
+         //************************************************************************************************************
+         unsigned int GetSize() const;
+
+         //************************************************************************************************************
+         //
+         // Method: Resize
+         //
+         // Description:
+         //    Changes the number of vectors in the array. New vectors are zero length.
+         //
+         // Arguments:
+         //    aSize - The new number of vectors.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void Resize(const unsigned int aSize);
+
+         //************************************************************************************************************
+         //
+         // Method: Clear
+         //
+         // Description:
+         //    Removes all vectors from the array.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void Clear();
+
+         //************************************************************************************************************
+         //
+         // Method: GetComponentsX
+         //
+         // Description:
+         //    Returns the array of X components so the vectors can be passed to the batch collision checks.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns a pointer to the first X component.
+         //
+         //************************************************************************************************************
+         const float* GetComponentsX() const;
+
+         //************************************************************************************************************
+         //
+         // Method: GetComponentsY
+         //
+         // Description:
+         //    Returns the array of Y components so the vectors can be passed to the batch collision checks.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns a pointer to the first Y component.
+         //
+         //************************************************************************************************************
+         const float* GetComponentsY() const;
+
+         //************************************************************************************************************
+         //
+         // Method: AddArray
+         //
+         // Description:
+         //    Adds each vector of the passed in array to the vector at the same index of this array.
+         //
+         // Arguments:
+         //    aOther - The array being added to this array.
+         //
+         // Return:
+         //    True  - The arrays were added.
+         //    False - The arrays are not the same size and nothing was changed.
+         //
+         //************************************************************************************************************
+         bool AddArray(const Vector2DArray& aOther);
+
+         //************************************************************************************************************
+         //
+         // Method: AddScaledArray
+         //
+         // Description:
+         //    Adds each vector of the passed in array multiplied by a scale to the vector at the same index of this
+         //    array. This is the usual way to move positions by velocities over an elapsed time.
+         //
+         // Arguments:
+         //    aOther - The array being added to this array.
+         //    aScale - The amount each vector of the other array is multiplied by before being added.
+         //
+         // Return:
+         //    True  - The arrays were added.
+         //    False - The arrays are not the same size and nothing was changed.
+         //
+         //************************************************************************************************************
+         bool AddScaledArray(const Vector2DArray& aOther, const float aScale);
+
+         //************************************************************************************************************
+         //
+         // Method: Scale
+         //
+         // Description:
+         //    Multiplies every vector in the array by a scale.
+         //
+         // Arguments:
+         //    aScale - The amount each vector is multiplied by.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void Scale(const float aScale);
+
+         //************************************************************************************************************
+         //
+         // Method: Dot
+         //
+         // Description:
+         //    Finds the dot product of each vector in this array against the vector at the same index of the passed in
+         //    array.
+         //
+         // Arguments:
+         //    aOther    - The array being used for the dot products against this array.
+         //    apResults - Array of GetSize() values updated with the dot product of each pair of vectors.
+         //
+         // Return:
+         //    True  - The dot products were found.
+         //    False - The arrays are not the same size and no results were written.
+         //
+         //************************************************************************************************************
+         bool Dot(const Vector2DArray& aOther, float* apResults) const;
+
+         //************************************************************************************************************
+         //
+         // Method: Normalize
+         //
+         // Description:
+         //    Changes every vector in the array to have a magnitude of 1.0. Zero length vectors have no direction and
+         //    are left as is.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void Normalize();
+
+      protected:
+
+         // There are currently no protected methods for this class.
+
+      private:
+
+         // There are currently no private methods for this class.
+
+   //******************************************************************************************************************
+   // Methods - End
+   //******************************************************************************************************************
+
+   //******************************************************************************************************************
+   // Member Variables - Start
+   //******************************************************************************************************************
+
+      public:
+
+         // There are currently no public member variables for this class.
+
+      protected:
+
+         // There are currently no protected member variables for this class.
+
+      private:
+
+         // The X component of each vector.
+         std::vector<float> mComponentsX;
+
+         // The Y component of each vector.
+         std::vector<float> mComponentsY;
+
+   //******************************************************************************************************************
+   // Member Variables - End
+   //******************************************************************************************************************
+   };
+}}
+
+#endif // Vector2DArray_H
@@ -28,15 +28,15 @@ namespace Bebop { namespace Objects
    //    aCoordinateX  - The X-Coordinate the circular object is to be displayed on the window.
    //    aCoordinateY  - The Y-Coordinate the circular object is to be displayed on the window. 
    //    aRadius       - The radius of the circular object.
-   //    apColor       - The color of the rectangle object.
+   //    aColor        - The color of the circular object. A clear color draws nothing.
    //
    // Return:
    //    N/A
    //
    //************************************************************************************************************
    CircleObject::CircleObject(const Math::Vector2D<float> aCoordinates, const int aRadius,
-                              Graphics::Color* const apColor) :
-      Object(aCoordinates, aRadius, aRadius, apColor, ObjectType::CIRCLE),
+                              const Graphics::Color aColor) :
+      Object(aCoordinates, aRadius, aRadius, aColor, ObjectType::CIRCLE),
       mRadius(aRadius)
    {
    }
@@ -76,11 +76,10 @@ namespace Bebop { namespace Objects
    //******************************************************************************************************************
    void CircleObject::Draw() const
    {
-      if (mpColor != nullptr)
+      if (mColor.IsClear() == false)
       {
          al_draw_filled_circle(mCoordinates.GetComponentX(), mCoordinates.GetComponentY(),
-                               mRadius-1, al_map_rgba(mpColor->GetRedColor(), mpColor->GetGreenColor(),
-                                                      mpColor->GetBlueColor(), mpColor->GetAlpha()));
+                               mRadius-1, mColor.ToAllegroColor());
       }
    }
 
@@ -104,6 +103,51 @@ namespace Bebop { namespace Objects
                             al_map_rgba(Graphics::NO_COLOR, Graphics::NO_COLOR, Graphics::NO_COLOR, aAlpha));
    }
 
+   //******************************************************************************************************************
+   //
+   // Method: AddToBatch
+   //
+   // Description:
+   //    Adds the current circular object configuration to a batch of shapes drawn together later.
+   //
+   // Arguments:
+   //    apBatch - Pointer to the batch the circular object is added to.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void CircleObject::AddToBatch(Graphics::ShapeBatch* apBatch) const
+   {
+      if (mColor.IsClear() == false)
+      {
+         apBatch->AddCircle(mCoordinates.GetComponentX(), mCoordinates.GetComponentY(),
+                            static_cast<float>(mRadius - 1), mColor.ToAllegroColor());
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AddToBatchForLightBlocking
+   //
+   // Description:
+   //    Adds the current circular object without any color and using a passed in alpha to a batch of shapes drawn
+   //    together later.
+   //
+   // Arguments:
+   //    apBatch - Pointer to the batch the circular object is added to.
+   //    aAlpha  - The alpha for the color of the object.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void CircleObject::AddToBatchForLightBlocking(Graphics::ShapeBatch* apBatch, unsigned int aAlpha) const
+   {
+      apBatch->AddCircle(mCoordinates.GetComponentX(), mCoordinates.GetComponentY(), static_cast<float>(mRadius),
+                         al_map_rgba(Graphics::NO_COLOR, Graphics::NO_COLOR, Graphics::NO_COLOR, aAlpha));
+   }
+
 //*********************************************************************************************************************
 // Public Methods - End
 //*********************************************************************************************************************
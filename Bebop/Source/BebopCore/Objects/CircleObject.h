@@ -33,14 +33,14 @@ namespace Bebop { namespace Objects
          //    aCoordinateX  - The X-Coordinate the circular object is to be displayed on the window.
          //    aCoordinateY  - The Y-Coordinate the circular object is to be displayed on the window. 
          //    aRadius       - The radius of the circular object.
-         //    apColor       - The color of the rectangle object.
+         //    aColor        - The color of the circular object. A clear color draws nothing.
          //
          // Return:
          //    N/A
          //
          //************************************************************************************************************
          CircleObject(const Math::Vector2D<float> aCoordinates, const int aRadius,
-                      Graphics::Color* const apColor);
+                      const Graphics::Color aColor);
       
          //************************************************************************************************************
          //
@@ -91,6 +91,40 @@ namespace Bebop { namespace Objects
          //************************************************************************************************************
          void DrawForLightBlocking(unsigned int aAlpha) const override;
 
+         //************************************************************************************************************
+         //
+         // Method: AddToBatch
+         //
+         // Description:
+         //    Adds the current circular object configuration to a batch of shapes drawn together later.
+         //
+         // Arguments:
+         //    apBatch - Pointer to the batch the circular object is added to.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void AddToBatch(Graphics::ShapeBatch* apBatch) const override;
+
+         //************************************************************************************************************
+         //
+         // Method: AddToBatchForLightBlocking
+         //
+         // Description:
+         //    Adds the current circular object without any color and using a passed in alpha to a batch of shapes drawn
+         //    together later.
+         //
+         // Arguments:
+         //    apBatch - Pointer to the batch the circular object is added to.
+         //    aAlpha  - The alpha for the color of the object.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void AddToBatchForLightBlocking(Graphics::ShapeBatch* apBatch, unsigned int aAlpha) const override;
+
       protected:
       
          // There are currently no protected methods for this class.
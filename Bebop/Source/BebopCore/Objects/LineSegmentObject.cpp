@@ -0,0 +1,202 @@
+//*********************************************************************************************************************
+//
+// File: LineSegmentObject.cpp
+//
+// Description:
+//    This class handles the functionality for a line segment object, such as a thin diagonal wall that blocks light.
+//    The coordinates of the object are the start point of the line and the end point is kept relative to it, so
+//    moving the object moves the whole line.
+//
+//*********************************************************************************************************************
+
+#include "LineSegmentObject.h"
+#include <allegro5/allegro_primitives.h>
+#include "../Graphics/GraphicsConstants.h"
+#include <cmath>
+
+namespace Bebop { namespace Objects
+{
+//*********************************************************************************************************************
+// Public Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method Name: LineSegmentObject
+   //
+   // Description:
+   //    Constructor that sets default values for member variables.
+   //
+   // Arguments:
+   //    aStartPoint - The point the line segment starts at.
+   //    aEndPoint   - The point the line segment ends at.
+   //    aColor      - The color of the line segment object. A clear color draws nothing.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   LineSegmentObject::LineSegmentObject(const Math::Vector2D<float> aStartPoint,
+                                        const Math::Vector2D<float> aEndPoint, const Graphics::Color aColor) :
+      Object(aStartPoint,
+             static_cast<int>(std::fabs(aEndPoint.GetComponentX() - aStartPoint.GetComponentX()) / 2.0F),
+             static_cast<int>(std::fabs(aEndPoint.GetComponentY() - aStartPoint.GetComponentY()) / 2.0F),
+             aColor, ObjectType::LINE_SEGMENT),
+      mEndOffset(aEndPoint - aStartPoint)
+   {
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: GetStartPoint
+   //
+   // Description:
+   //    Returns the point the line segment starts at.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the start point of the line segment.
+   //
+   //******************************************************************************************************************
+   Math::Vector2D<float> LineSegmentObject::GetStartPoint() const
+   {
+      return mCoordinates;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: GetEndPoint
+   //
+   // Description:
+   //    Returns the point the line segment ends at.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the end point of the line segment.
+   //
+   //******************************************************************************************************************
+   Math::Vector2D<float> LineSegmentObject::GetEndPoint() const
+   {
+      return mCoordinates + mEndOffset;
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: Draw
+   //
+   // Description:
+   //    The drawing call to handle drawing the current line segment object configuration on the window.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void LineSegmentObject::Draw() const
+   {
+      if (mColor.IsClear() == false)
+      {
+         Math::Vector2D<float> endPoint = GetEndPoint();
+         al_draw_line(mCoordinates.GetComponentX(), mCoordinates.GetComponentY(), endPoint.GetComponentX(),
+                      endPoint.GetComponentY(), mColor.ToAllegroColor(), Graphics::LINE_SEGMENT_THICKNESS);
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: DrawForLightBlocking
+   //
+   // Description:
+   //    The drawing call to handle drawing the current line segment object without any color and using a passed in
+   //    alpha.
+   //
+   // Arguments:
+   //    aAlpha - The alpha for the color of the object.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void LineSegmentObject::DrawForLightBlocking(unsigned int aAlpha) const
+   {
+      Math::Vector2D<float> endPoint = GetEndPoint();
+      al_draw_line(mCoordinates.GetComponentX(), mCoordinates.GetComponentY(), endPoint.GetComponentX(),
+                   endPoint.GetComponentY(),
+                   al_map_rgba(Graphics::NO_COLOR, Graphics::NO_COLOR, Graphics::NO_COLOR, aAlpha),
+                   Graphics::LINE_SEGMENT_THICKNESS);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AddToBatch
+   //
+   // Description:
+   //    Adds the current line segment object configuration to a batch of shapes drawn together later.
+   //
+   // Arguments:
+   //    apBatch - Pointer to the batch the line segment object is added to.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void LineSegmentObject::AddToBatch(Graphics::ShapeBatch* apBatch) const
+   {
+      if (mColor.IsClear() == false)
+      {
+         apBatch->AddLine(mCoordinates, GetEndPoint(), Graphics::LINE_SEGMENT_THICKNESS, mColor.ToAllegroColor());
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AddToBatchForLightBlocking
+   //
+   // Description:
+   //    Adds the current line segment object without any color and using a passed in alpha to a batch of shapes
+   //    drawn together later.
+   //
+   // Arguments:
+   //    apBatch - Pointer to the batch the line segment object is added to.
+   //    aAlpha  - The alpha for the color of the object.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void LineSegmentObject::AddToBatchForLightBlocking(Graphics::ShapeBatch* apBatch, unsigned int aAlpha) const
+   {
+      apBatch->AddLine(mCoordinates, GetEndPoint(), Graphics::LINE_SEGMENT_THICKNESS,
+                       al_map_rgba(Graphics::NO_COLOR, Graphics::NO_COLOR, Graphics::NO_COLOR, aAlpha));
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no private methods for this class.
+
+//*********************************************************************************************************************
+// Private Methods - End
+//*********************************************************************************************************************
+}}
@@ -0,0 +1,180 @@
+//*********************************************************************************************************************
+//
+// File: LineSegmentObject.h
+//
+// Description:
+//    This class handles the functionality for a line segment object, such as a thin diagonal wall that blocks light.
+//    The coordinates of the object are the start point of the line and the end point is kept relative to it, so
+//    moving the object moves the whole line.
+//
+//*********************************************************************************************************************
+
+#ifndef LineSegmentObject_h
+#define LineSegmentObject_h
+
+#include "Object.h"
+
+namespace Bebop { namespace Objects
+{
+   class LineSegmentObject : public Object
+   {
+   //******************************************************************************************************************
+   // Methods - Start
+   //******************************************************************************************************************
+
+      public:
+
+         //************************************************************************************************************
+         //
+         // Method Name: LineSegmentObject
+         //
+         // Description:
+         //    Constructor that sets default values for member variables.
+         //
+         // Arguments:
+         //    aStartPoint - The point the line segment starts at.
+         //    aEndPoint   - The point the line segment ends at.
+         //    aColor      - The color of the line segment object. A clear color draws nothing.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         LineSegmentObject(const Math::Vector2D<float> aStartPoint, const Math::Vector2D<float> aEndPoint,
+                           const Graphics::Color aColor);
+
+         //************************************************************************************************************
+         //
+         // Method Name: GetStartPoint
+         //
+         // Description:
+         //    Returns the point the line segment starts at.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the start point of the line segment.
+         //
+         //************************************************************************************************************
+         Math::Vector2D<float> GetStartPoint() const;
+
+         //************************************************************************************************************
+         //
+         // Method Name: GetEndPoint
+         //
+         // Description:
+         //    Returns the point the line segment ends at.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the end point of the line segment.
+         //
+         //************************************************************************************************************
+         Math::Vector2D<float> GetEndPoint() const;
+
+         //************************************************************************************************************
+         //
+         // Method: Draw
+         //
+         // Description:
+         //    The drawing call to handle drawing the current line segment object configuration on the window.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void Draw() const override;
+
+         //************************************************************************************************************
+         //
+         // Method: DrawForLightBlocking
+         //
+         // Description:
+         //    The drawing call to handle drawing the current line segment object without any color and using a
+         //    passed in alpha.
+         //
+         // Arguments:
+         //    aAlpha - The alpha for the color of the object.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void DrawForLightBlocking(unsigned int aAlpha) const override;
+
+         //************************************************************************************************************
+         //
+         // Method: AddToBatch
+         //
+         // Description:
+         //    Adds the current line segment object configuration to a batch of shapes drawn together later.
+         //
+         // Arguments:
+         //    apBatch - Pointer to the batch the line segment object is added to.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void AddToBatch(Graphics::ShapeBatch* apBatch) const override;
+
+         //************************************************************************************************************
+         //
+         // Method: AddToBatchForLightBlocking
+         //
+         // Description:
+         //    Adds the current line segment object without any color and using a passed in alpha to a batch of
+         //    shapes drawn together later.
+         //
+         // Arguments:
+         //    apBatch - Pointer to the batch the line segment object is added to.
+         //    aAlpha  - The alpha for the color of the object.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void AddToBatchForLightBlocking(Graphics::ShapeBatch* apBatch, unsigned int aAlpha) const override;
+
+      protected:
+
+         // There are currently no protected methods for this class.
+
+      private:
+
+         // There are currently no private methods for this class.
+
+   //******************************************************************************************************************
+   // Methods - End
+   //******************************************************************************************************************
+
+   //******************************************************************************************************************
+   // Member Variables - Start
+   //******************************************************************************************************************
+
+      public:
+
+         // There are currently no public member variables for this class.
+
+      protected:
+
+         // There are currently no protected member variables for this class.
+
+      private:
+
+         // The end point of the line segment relative to its start point.
+         Math::Vector2D<float> mEndOffset;
+
+   //******************************************************************************************************************
+   // Member Variables - End
+   //******************************************************************************************************************
+   };
+}}
+
+#endif // LineSegmentObject_h
@@ -26,7 +26,7 @@ namespace Bebop { namespace Objects
    //    aCoorindateY       - The Y-Coordinate to place the object upon creation.
    //    aWidthCenterPoint  - The center point of the width of the object.
    //    aHeightCenterPoint - The center point of the height of the object.
-   //    apColor            - The color of the rectangle object.
+   //    aColor             - The color of the object. A clear color draws nothing.
    //    aObjectType        - Determines what kind of object is created (rectangle, circle, etc.)
    //
    // Return:
@@ -34,10 +34,10 @@ namespace Bebop { namespace Objects
    //
    //******************************************************************************************************************
    Object::Object(const Math::Vector2D<float> aCoordinates, const int aWidthCenterPoint,
-                  const int aHeightCenterPoint, Graphics::Color* const apColor, const ObjectType aObjectType) :
+                  const int aHeightCenterPoint, const Graphics::Color aColor, const ObjectType aObjectType) :
       mCoordinates(aCoordinates), mWidthCenterPoint(aWidthCenterPoint),
       mHeightCenterPoint(aHeightCenterPoint), mStartingCoordinates(aCoordinates),
-      mpColor(apColor), mObjectType(aObjectType)
+      mColor(aColor), mObjectType(aObjectType)
    {
    }
 
@@ -57,7 +57,6 @@ namespace Bebop { namespace Objects
    //******************************************************************************************************************
    Object::~Object()
    {
-      delete mpColor;
    }
    
    //******************************************************************************************************************
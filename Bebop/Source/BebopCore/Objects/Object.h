@@ -11,6 +11,7 @@
 #define Object_h
 
 #include "../Graphics/Color.h"
+#include "../Graphics/ShapeBatch.h"
 #include "../Math/Vector2D.h"
 
 namespace Bebop { namespace Objects
@@ -19,6 +20,8 @@ namespace Bebop { namespace Objects
    {
       RECTANGLE,
       CIRCLE,
+      LINE_SEGMENT,
+      POLYGON,
       NONE
    };
 
@@ -41,7 +44,7 @@ namespace Bebop { namespace Objects
          //    aCoorindateY       - The Y-Coordinate to place the object upon creation.
          //    aWidthCenterPoint  - The center point of the width of the object.
          //    aHeightCenterPoint - The center point of the height of the object.
-         //    apColor            - The color of the rectangle object.
+         //    aColor             - The color of the object. A clear color draws nothing.
          //    aObjectType        - Determines what kind of object is created (rectangle, circle, etc.)
          //
          // Return:
@@ -49,14 +52,15 @@ namespace Bebop { namespace Objects
          //
          //************************************************************************************************************
          Object(const Math::Vector2D<float> aCoordinates, const int aWidthCenterPoint,
-                const int aHeightCenterPoint, Graphics::Color* const apColor, const ObjectType aObjectType);
+                const int aHeightCenterPoint, const Graphics::Color aColor, const ObjectType aObjectType);
 
          //************************************************************************************************************
          //
          // Method Name: ~Object
          //
          // Description:
-         //    Descturctor to free any memory usage before the object is completely destroyed.
+         //    Descturctor to free any memory usage before the object is completely destroyed. Virtual so objects
+         //    holding their own memory, such as polygons, are freed when deleted through an object pointer.
          //
          // Arguments:
          //    N/A
@@ -65,7 +69,7 @@ namespace Bebop { namespace Objects
          //    N/A
          //
          //************************************************************************************************************
-         ~Object();
+         virtual ~Object();
       
          //************************************************************************************************************
          //
@@ -275,6 +279,40 @@ namespace Bebop { namespace Objects
          //************************************************************************************************************
          virtual void DrawForLightBlocking(unsigned int aAlpha) const = 0;
 
+         //************************************************************************************************************
+         //
+         // Method: AddToBatch
+         //
+         // Description:
+         //    Adds the current object configuration to a batch of shapes drawn together later.
+         //
+         // Arguments:
+         //    apBatch - Pointer to the batch the object is added to.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         virtual void AddToBatch(Graphics::ShapeBatch* apBatch) const = 0;
+
+         //************************************************************************************************************
+         //
+         // Method: AddToBatchForLightBlocking
+         //
+         // Description:
+         //    Adds the current object without any color and using a passed in alpha to a batch of shapes drawn
+         //    together later.
+         //
+         // Arguments:
+         //    apBatch - Pointer to the batch the object is added to.
+         //    aAlpha  - The alpha for the color of the object.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         virtual void AddToBatchForLightBlocking(Graphics::ShapeBatch* apBatch, unsigned int aAlpha) const = 0;
+
       protected:
       
          //************************************************************************************************************
@@ -339,8 +377,8 @@ namespace Bebop { namespace Objects
          // The center point along the height of an object.
          int mHeightCenterPoint;
 
-         // The color of the object.
-         Graphics::Color* mpColor;
+         // The color of the object, stored in place.
+         Graphics::Color mColor;
 
          // The type of object (e.g., circle, rectangle, etc.).
          ObjectType mObjectType;
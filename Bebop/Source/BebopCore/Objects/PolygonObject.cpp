@@ -0,0 +1,346 @@
+//*********************************************************************************************************************
+//
+// File: PolygonObject.cpp
+//
+// Description:
+//    This class handles the functionality for a convex polygon object, such as a slanted wall that blocks light. The
+//    points of the polygon are kept relative to the coordinates of the object, so moving the object moves the whole
+//    polygon. The points must be in order around the polygon, in either direction, and form a convex shape.
+//
+//*********************************************************************************************************************
+
+#include "PolygonObject.h"
+#include <allegro5/allegro_primitives.h>
+#include "../Graphics/GraphicsConstants.h"
+#include "../Math/MathConstants.h"
+#include <algorithm>
+
+namespace Bebop { namespace Objects
+{
+   namespace
+   {
+      //***************************************************************************************************************
+      //
+      // Method Name: GetHalfExtent
+      //
+      // Description:
+      //    Finds half of the distance the points of a polygon span along one axis.
+      //
+      // Arguments:
+      //    aPoints - The points of the polygon.
+      //    aAlongX - True  = Measure along the X-Axis.
+      //              False = Measure along the Y-Axis.
+      //
+      // Return:
+      //    Returns half of the span, rounded down.
+      //
+      //***************************************************************************************************************
+      int GetHalfExtent(const std::vector<Math::Vector2D<float>>& aPoints, const bool aAlongX)
+      {
+         if (aPoints.empty() == true)
+         {
+            return 0;
+         }
+
+         float minimum = aAlongX == true ? aPoints.front().GetComponentX() : aPoints.front().GetComponentY();
+         float maximum = minimum;
+         for (auto iterator = aPoints.begin(); iterator != aPoints.end(); ++iterator)
+         {
+            float value = aAlongX == true ? iterator->GetComponentX() : iterator->GetComponentY();
+            minimum = std::min(minimum, value);
+            maximum = std::max(maximum, value);
+         }
+
+         return static_cast<int>((maximum - minimum) / 2.0F);
+      }
+
+      //***************************************************************************************************************
+      //
+      // Method Name: IsConvex
+      //
+      // Description:
+      //    Checks if points in order around a polygon form a convex shape. Every corner must turn the same way, and
+      //    the turns must add up to a single circle, which rules out shapes such as a star that turn the same way at
+      //    every corner but wind around more than once.
+      //
+      // Arguments:
+      //    aPoints - The points of the polygon.
+      //
+      // Return:
+      //    True  - The points form a convex polygon wound one way.
+      //    False - There are fewer than three points, the points are not convex, turn both ways, repeat a point or
+      //            all lie on a line.
+      //
+      //***************************************************************************************************************
+      bool IsConvex(const std::vector<Math::Vector2D<float>>& aPoints)
+      {
+         const unsigned int pointCount = static_cast<unsigned int>(aPoints.size());
+         if (pointCount < 3)
+         {
+            return false;
+         }
+
+         bool hasPositiveTurn = false;
+         bool hasNegativeTurn = false;
+         float totalTurn = 0.0F;
+         for (unsigned int i = 0; i < pointCount; ++i)
+         {
+            const Math::Vector2D<float> edge = aPoints[(i + 1) % pointCount] - aPoints[i];
+            const Math::Vector2D<float> nextEdge = aPoints[(i + 2) % pointCount] - aPoints[(i + 1) % pointCount];
+            const float cross = edge.Cross(nextEdge);
+            const float dot = edge.Dot(nextEdge);
+
+            // Points on a line are allowed as long as the edge carries straight on, rather than doubling back or
+            // repeating a point.
+            if (cross == 0.0F && dot <= 0.0F)
+            {
+               return false;
+            }
+
+            hasPositiveTurn = hasPositiveTurn || cross > 0.0F;
+            hasNegativeTurn = hasNegativeTurn || cross < 0.0F;
+            totalTurn += std::atan2(cross, dot);
+         }
+
+         return hasPositiveTurn != hasNegativeTurn &&
+                std::abs(std::abs(totalTurn) - Math::CIRCLE_RADIANS) <= Math::POLYGON_WINDING_TOLERANCE;
+      }
+   }
+
+//*********************************************************************************************************************
+// Public Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method Name: PolygonObject
+   //
+   // Description:
+   //    Constructor that sets default values for member variables. Points that do not form a convex polygon wound one
+   //    way are rejected and leave the polygon with no points, so it draws nothing, blocks no light and collides with
+   //    nothing. A point count of zero after construction shows the points were rejected.
+   //
+   // Arguments:
+   //    aCoordinates - The coordinates the points of the polygon are relative to.
+   //    aPoints      - The points of the convex polygon, in order around it, relative to the coordinates.
+   //    aColor       - The color of the polygon object. A clear color draws nothing.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   PolygonObject::PolygonObject(const Math::Vector2D<float> aCoordinates,
+                                const std::vector<Math::Vector2D<float>>& aPoints, const Graphics::Color aColor) :
+      Object(aCoordinates, GetHalfExtent(aPoints, true), GetHalfExtent(aPoints, false), aColor, ObjectType::POLYGON),
+      mPoints(aPoints)
+   {
+      // The light and collision checks rely on every edge of the polygon facing out the same way.
+      if (IsConvex(mPoints) == false)
+      {
+         mPoints.clear();
+         SetWidthCenterPoint(0);
+         SetHeightCenterPoint(0);
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: GetPointCount
+   //
+   // Description:
+   //    Returns the number of points of the polygon, which is also its number of edges.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    Returns the number of points.
+   //
+   //******************************************************************************************************************
+   unsigned int PolygonObject::GetPointCount() const
+   {
+      return static_cast<unsigned int>(mPoints.size());
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: GetPoint
+   //
+   // Description:
+   //    Returns a point of the polygon at its current position. The edges of the polygon run from each point to the
+   //    next, with the last point joining back to the first.
+   //
+   // Arguments:
+   //    aIndex - The index of the point. Must be less than the point count.
+   //
+   // Return:
+   //    Returns the point.
+   //
+   //******************************************************************************************************************
+   Math::Vector2D<float> PolygonObject::GetPoint(const unsigned int aIndex) const
+   {
+      return mCoordinates + mPoints[aIndex];
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: Draw
+   //
+   // Description:
+   //    The drawing call to handle drawing the current polygon object configuration on the window.
+   //
+   // Arguments:
+   //    N/A
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void PolygonObject::Draw() const
+   {
+      if (mColor.IsClear() == false)
+      {
+         DrawFilled(mColor.ToAllegroColor());
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: DrawForLightBlocking
+   //
+   // Description:
+   //    The drawing call to handle drawing the current polygon object without any color and using a passed in alpha.
+   //
+   // Arguments:
+   //    aAlpha - The alpha for the color of the object.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void PolygonObject::DrawForLightBlocking(unsigned int aAlpha) const
+   {
+      DrawFilled(al_map_rgba(Graphics::NO_COLOR, Graphics::NO_COLOR, Graphics::NO_COLOR, aAlpha));
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AddToBatch
+   //
+   // Description:
+   //    Adds the current polygon object configuration to a batch of shapes drawn together later.
+   //
+   // Arguments:
+   //    apBatch - Pointer to the batch the polygon object is added to.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void PolygonObject::AddToBatch(Graphics::ShapeBatch* apBatch) const
+   {
+      if (mColor.IsClear() == false)
+      {
+         AddFilledToBatch(apBatch, mColor.ToAllegroColor());
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AddToBatchForLightBlocking
+   //
+   // Description:
+   //    Adds the current polygon object without any color and using a passed in alpha to a batch of shapes drawn
+   //    together later.
+   //
+   // Arguments:
+   //    apBatch - Pointer to the batch the polygon object is added to.
+   //    aAlpha  - The alpha for the color of the object.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void PolygonObject::AddToBatchForLightBlocking(Graphics::ShapeBatch* apBatch, unsigned int aAlpha) const
+   {
+      AddFilledToBatch(apBatch, al_map_rgba(Graphics::NO_COLOR, Graphics::NO_COLOR, Graphics::NO_COLOR, aAlpha));
+   }
+
+//*********************************************************************************************************************
+// Public Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Protected Methods - Start
+//*********************************************************************************************************************
+
+   // There are currently no protected methods for this class.
+
+//*********************************************************************************************************************
+// Protected Methods - End
+//*********************************************************************************************************************
+
+//*********************************************************************************************************************
+// Private Methods - Start
+//*********************************************************************************************************************
+
+   //******************************************************************************************************************
+   //
+   // Method Name: DrawFilled
+   //
+   // Description:
+   //    Draws the polygon filled with a color as a fan of triangles from its first point.
+   //
+   // Arguments:
+   //    aColor - The color to fill the polygon with.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void PolygonObject::DrawFilled(const ALLEGRO_COLOR aColor) const
+   {
+      if (mPoints.size() < 3)
+      {
+         return;
+      }
+
+      std::vector<ALLEGRO_VERTEX> vertices;
+      vertices.reserve(mPoints.size());
+      for (unsigned int i = 0; i < mPoints.size(); ++i)
+      {
+         Math::Vector2D<float> point = GetPoint(i);
+         ALLEGRO_VERTEX vertex = {point.GetComponentX(), point.GetComponentY(), 0, 0, 0, aColor};
+         vertices.push_back(vertex);
+      }
+
+      al_draw_prim(vertices.data(), NULL, NULL, 0, static_cast<int>(vertices.size()), ALLEGRO_PRIM_TRIANGLE_FAN);
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method Name: AddFilledToBatch
+   //
+   // Description:
+   //    Adds the polygon filled with a color to a batch as a fan of triangles from its first point.
+   //
+   // Arguments:
+   //    apBatch - Pointer to the batch the polygon object is added to.
+   //    aColor  - The color to fill the polygon with.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void PolygonObject::AddFilledToBatch(Graphics::ShapeBatch* apBatch, const ALLEGRO_COLOR aColor) const
+   {
+      for (unsigned int i = 2; i < mPoints.size(); ++i)
+      {
+         apBatch->AddTriangle(GetPoint(0), GetPoint(i - 1), GetPoint(i), aColor);
+      }
+   }
+
+//*********************************************************************************************************************
+// Private Methods - End
+//*********************************************************************************************************************
+}}
@@ -0,0 +1,215 @@
+//*********************************************************************************************************************
+//
+// File: PolygonObject.h
+//
+// Description:
+//    This class handles the functionality for a convex polygon object, such as a slanted wall that blocks light. The
+//    points of the polygon are kept relative to the coordinates of the object, so moving the object moves the whole
+//    polygon. The points must be in order around the polygon, in either direction, and form a convex shape.
+//
+//*********************************************************************************************************************
+
+#ifndef PolygonObject_h
+#define PolygonObject_h
+
+#include "Object.h"
+#include <vector>
+
+namespace Bebop { namespace Objects
+{
+   class PolygonObject : public Object
+   {
+   //******************************************************************************************************************
+   // Methods - Start
+   //******************************************************************************************************************
+
+      public:
+
+         //************************************************************************************************************
+         //
+         // Method Name: PolygonObject
+         //
+         // Description:
+         //    Constructor that sets default values for member variables. Points that do not form a convex polygon
+         //    wound one way are rejected and leave the polygon with no points, so it draws nothing, blocks no light
+         //    and collides with nothing. A point count of zero after construction shows the points were rejected.
+         //
+         // Arguments:
+         //    aCoordinates - The coordinates the points of the polygon are relative to.
+         //    aPoints      - The points of the convex polygon, in order around it, relative to the coordinates.
+         //    aColor       - The color of the polygon object. A clear color draws nothing.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         PolygonObject(const Math::Vector2D<float> aCoordinates, const std::vector<Math::Vector2D<float>>& aPoints,
+                       const Graphics::Color aColor);
+
+         //************************************************************************************************************
+         //
+         // Method Name: GetPointCount
+         //
+         // Description:
+         //    Returns the number of points of the polygon, which is also its number of edges.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    Returns the number of points.
+         //
+         //************************************************************************************************************
+         unsigned int GetPointCount() const;
+
+         //************************************************************************************************************
+         //
+         // Method Name: GetPoint
+         //
+         // Description:
+         //    Returns a point of the polygon at its current position. The edges of the polygon run from each point to
+         //    the next, with the last point joining back to the first.
+         //
+         // Arguments:
+         //    aIndex - The index of the point. Must be less than the point count.
+         //
+         // Return:
+         //    Returns the point.
+         //
+         //************************************************************************************************************
+         Math::Vector2D<float> GetPoint(const unsigned int aIndex) const;
+
+         //************************************************************************************************************
+         //
+         // Method: Draw
+         //
+         // Description:
+         //    The drawing call to handle drawing the current polygon object configuration on the window.
+         //
+         // Arguments:
+         //    N/A
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void Draw() const override;
+
+         //************************************************************************************************************
+         //
+         // Method: DrawForLightBlocking
+         //
+         // Description:
+         //    The drawing call to handle drawing the current polygon object without any color and using a passed in
+         //    alpha.
+         //
+         // Arguments:
+         //    aAlpha - The alpha for the color of the object.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void DrawForLightBlocking(unsigned int aAlpha) const override;
+
+         //************************************************************************************************************
+         //
+         // Method: AddToBatch
+         //
+         // Description:
+         //    Adds the current polygon object configuration to a batch of shapes drawn together later.
+         //
+         // Arguments:
+         //    apBatch - Pointer to the batch the polygon object is added to.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void AddToBatch(Graphics::ShapeBatch* apBatch) const override;
+
+         //************************************************************************************************************
+         //
+         // Method: AddToBatchForLightBlocking
+         //
+         // Description:
+         //    Adds the current polygon object without any color and using a passed in alpha to a batch of shapes
+         //    drawn together later.
+         //
+         // Arguments:
+         //    apBatch - Pointer to the batch the polygon object is added to.
+         //    aAlpha  - The alpha for the color of the object.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void AddToBatchForLightBlocking(Graphics::ShapeBatch* apBatch, unsigned int aAlpha) const override;
+
+      protected:
+
+         // There are currently no protected methods for this class.
+
+      private:
+
+         //************************************************************************************************************
+         //
+         // Method Name: DrawFilled
+         //
+         // Description:
+         //    Draws the polygon filled with a color as a fan of triangles from its first point.
+         //
+         // Arguments:
+         //    aColor - The color to fill the polygon with.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void DrawFilled(const ALLEGRO_COLOR aColor) const;
+
+         //************************************************************************************************************
+         //
+         // Method Name: AddFilledToBatch
+         //
+         // Description:
+         //    Adds the polygon filled with a color to a batch as a fan of triangles from its first point.
+         //
+         // Arguments:
+         //    apBatch - Pointer to the batch the polygon object is added to.
+         //    aColor  - The color to fill the polygon with.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void AddFilledToBatch(Graphics::ShapeBatch* apBatch, const ALLEGRO_COLOR aColor) const;
+
+   //******************************************************************************************************************
+   // Methods - End
+   //******************************************************************************************************************
+
+   //******************************************************************************************************************
+   // Member Variables - Start
+   //******************************************************************************************************************
+
+      public:
+
+         // There are currently no public member variables for this class.
+
+      protected:
+
+         // There are currently no protected member variables for this class.
+
+      private:
+
+         // The points of the polygon relative to the coordinates of the object.
+         std::vector<Math::Vector2D<float>> mPoints;
+
+   //******************************************************************************************************************
+   // Member Variables - End
+   //******************************************************************************************************************
+   };
+}}
+
+#endif // PolygonObject_h
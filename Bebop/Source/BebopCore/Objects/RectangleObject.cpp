@@ -29,15 +29,15 @@ namespace Bebop { namespace Objects
    //    aCoordinateY  - The Y-Coordinate the rectangular object is to be displayed on the window. 
    //    aWidth        - The width of the rectangular object.
    //    aHeight       - The height of the rectangular object.
-   //    apColor       - The color of the rectangle object.
+   //    aColor        - The color of the rectangle object. A clear color draws nothing.
    //
    // Return:
    //    N/A
    //
    //******************************************************************************************************************
    RectangleObject::RectangleObject(const Math::Vector2D<float> aCoordinates, const int aWidth,
-                                    const int aHeight, Graphics::Color* const apColor) :
-      Object(aCoordinates, (aWidth / 2), (aHeight / 2), apColor, ObjectType::RECTANGLE),
+                                    const int aHeight, const Graphics::Color aColor) :
+      Object(aCoordinates, (aWidth / 2), (aHeight / 2), aColor, ObjectType::RECTANGLE),
       mWidth(aWidth), mHeight(aHeight),
       mTopLeftPoint(aCoordinates),
       mTopRightPoint(GetCoordinateX() + aWidth, GetCoordinateY()),
@@ -256,12 +256,11 @@ namespace Bebop { namespace Objects
    //******************************************************************************************************************
    void RectangleObject::Draw() const
    {
-      if (mpColor != nullptr)
+      if (mColor.IsClear() == false)
       {
          al_draw_filled_rectangle(mCoordinates.GetComponentX(), mCoordinates.GetComponentY(),
                                   mCoordinates.GetComponentX() + mWidth, mCoordinates.GetComponentY() + mHeight,
-                                  al_map_rgba(mpColor->GetRedColor(), mpColor->GetGreenColor(), mpColor->GetBlueColor(),
-                                              mpColor->GetAlpha()));
+                                  mColor.ToAllegroColor());
       }
    }
 
@@ -287,6 +286,53 @@ namespace Bebop { namespace Objects
                                al_map_rgba(Graphics::NO_COLOR , Graphics::NO_COLOR, Graphics::NO_COLOR, aAlpha));
    }
 
+   //******************************************************************************************************************
+   //
+   // Method: AddToBatch
+   //
+   // Description:
+   //    Adds the current rectangular object configuration to a batch of shapes drawn together later.
+   //
+   // Arguments:
+   //    apBatch - Pointer to the batch the rectangular object is added to.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void RectangleObject::AddToBatch(Graphics::ShapeBatch* apBatch) const
+   {
+      if (mColor.IsClear() == false)
+      {
+         apBatch->AddRectangle(mCoordinates.GetComponentX(), mCoordinates.GetComponentY(),
+                               mCoordinates.GetComponentX() + mWidth, mCoordinates.GetComponentY() + mHeight,
+                               mColor.ToAllegroColor());
+      }
+   }
+
+   //******************************************************************************************************************
+   //
+   // Method: AddToBatchForLightBlocking
+   //
+   // Description:
+   //    Adds the current rectangular object without any color and using a passed in alpha to a batch of shapes drawn
+   //    together later.
+   //
+   // Arguments:
+   //    apBatch - Pointer to the batch the rectangular object is added to.
+   //    aAlpha  - The alpha for the color of the object.
+   //
+   // Return:
+   //    N/A
+   //
+   //******************************************************************************************************************
+   void RectangleObject::AddToBatchForLightBlocking(Graphics::ShapeBatch* apBatch, unsigned int aAlpha) const
+   {
+      apBatch->AddRectangle(mCoordinates.GetComponentX(), mCoordinates.GetComponentY(),
+                            mCoordinates.GetComponentX() + mWidth, mCoordinates.GetComponentY() + mHeight,
+                            al_map_rgba(Graphics::NO_COLOR, Graphics::NO_COLOR, Graphics::NO_COLOR, aAlpha));
+   }
+
 //*********************************************************************************************************************
 // Public Methods - End
 //*********************************************************************************************************************
@@ -34,14 +34,14 @@ namespace Bebop { namespace Objects
          //    aCoordinateY  - The Y-Coordinate the rectangular object is to be displayed on the window. 
          //    aWidth        - The width of the rectangular object.
          //    aHeight       - The height of the rectangular object.
-         //    apColor       - The color of the rectangle object.
+         //    aColor        - The color of the rectangle object. A clear color draws nothing.
          //
          // Return:
          //    N/A
          //
          //************************************************************************************************************
          RectangleObject(const Math::Vector2D<float> aCoordinates, const int aWidth, const int aHeight,
-                         Graphics::Color* const apColor);
+                         const Graphics::Color aColor);
       
          //************************************************************************************************************
          //
@@ -236,6 +236,40 @@ namespace Bebop { namespace Objects
          //************************************************************************************************************
          void DrawForLightBlocking(unsigned int aAlpha) const override;
 
+         //************************************************************************************************************
+         //
+         // Method: AddToBatch
+         //
+         // Description:
+         //    Adds the current rectangular object configuration to a batch of shapes drawn together later.
+         //
+         // Arguments:
+         //    apBatch - Pointer to the batch the rectangular object is added to.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void AddToBatch(Graphics::ShapeBatch* apBatch) const override;
+
+         //************************************************************************************************************
+         //
+         // Method: AddToBatchForLightBlocking
+         //
+         // Description:
+         //    Adds the current rectangular object without any color and using a passed in alpha to a batch of shapes
+         //    drawn together later.
+         //
+         // Arguments:
+         //    apBatch - Pointer to the batch the rectangular object is added to.
+         //    aAlpha  - The alpha for the color of the object.
+         //
+         // Return:
+         //    N/A
+         //
+         //************************************************************************************************************
+         void AddToBatchForLightBlocking(Graphics::ShapeBatch* apBatch, unsigned int aAlpha) const override;
+
       protected:
       
          // There are currently no protected methods for this class.